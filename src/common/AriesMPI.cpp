@@ -277,6 +277,26 @@ namespace ARIES
         return rval;
     }
 
+    int AriesMPI::Startall(int count, Request* reqs)
+    {
+#ifndef ARIES_HAVE_MPI
+        NULL_USE(count);
+        NULL_USE(reqs);
+#endif
+        int rval = MPI_SUCCESS;
+        if (!d_mpiIsInitialized)
+        {
+            ARIES_ERROR("AriesMPI::Startall is a no-op without run-time MPI!");
+        }
+#ifdef ARIES_HAVE_MPI
+        else
+        {
+            rval = MPI_Startall(count, reqs);
+        }
+#endif
+        return rval;
+    }
+
     int AriesMPI::Test(Request* request, int* flag, Status* status)
     {
 #ifndef ARIES_HAVE_MPI
@@ -505,6 +525,65 @@ namespace ARIES
         return rval;
     }
     
+    int AriesMPI::Alltoall(void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf, int recvcount, Datatype recvtype) const
+    {
+#ifndef ARIES_HAVE_MPI
+        NULL_USE(sendbuf);
+        NULL_USE(sendcount);
+        NULL_USE(sendtype);
+        NULL_USE(recvbuf);
+        NULL_USE(recvcount);
+        NULL_USE(recvtype);
+#endif
+        int rval = MPI_SUCCESS;
+        if (!d_mpiIsInitialized)
+        {
+            ARIES_ERROR("AriesMPI::Alltoall is a no-op without run-time MPI!");
+        }
+#ifdef ARIES_HAVE_MPI
+        else
+        {
+            rval = MPI_Alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, d_comm);
+        }
+#endif
+        return rval;
+    }
+
+    int AriesMPI::Alltoallv(void* sendbuf, int* sendcounts, int* sdispls, Datatype sendtype,
+                            void* recvbuf, int* recvcounts, int* rdispls, Datatype recvtype) const
+    {
+#ifndef ARIES_HAVE_MPI
+        NULL_USE(sendbuf);
+        NULL_USE(sendcounts);
+        NULL_USE(sdispls);
+        NULL_USE(sendtype);
+        NULL_USE(recvbuf);
+        NULL_USE(recvcounts);
+        NULL_USE(rdispls);
+        NULL_USE(recvtype);
+#endif
+        int rval = MPI_SUCCESS;
+        if (!d_mpiIsInitialized)
+        {
+            ARIES_ERROR("AriesMPI::Alltoallv is a no-op without run-time MPI!");
+        }
+#ifdef ARIES_HAVE_MPI
+        else
+        {
+            rval = MPI_Alltoallv(sendbuf,
+                                 sendcounts,
+                                 sdispls,
+                                 sendtype,
+                                 recvbuf,
+                                 recvcounts,
+                                 rdispls,
+                                 recvtype,
+                                 d_comm);
+        }
+#endif
+        return rval;
+    }
+
     int AriesMPI::Attr_get(int keyval, void* attribute_val, int* flag) const
     {
 #ifndef ARIES_HAVE_MPI
@@ -755,6 +834,56 @@ namespace ARIES
         return rval;
     }
 
+    int AriesMPI::Send_init(void* buf, int count, Datatype datatype,
+                            int dest, int tag, Request* req) const
+    {
+#ifndef ARIES_HAVE_MPI
+        NULL_USE(buf);
+        NULL_USE(count);
+        NULL_USE(datatype);
+        NULL_USE(dest);
+        NULL_USE(tag);
+        NULL_USE(req);
+#endif
+        int rval = MPI_SUCCESS;
+        if (!d_mpiIsInitialized)
+        {
+            ARIES_ERROR("AriesMPI::Send_init is a no-op without run-time MPI!");
+        }
+#ifdef ARIES_HAVE_MPI
+        else
+        {
+            rval = MPI_Send_init(buf, count, datatype, dest, tag, d_comm, req);
+        }
+#endif
+        return rval;
+    }
+
+    int AriesMPI::Recv_init(void* buf, int count, Datatype datatype,
+                            int source, int tag, Request* request) const
+    {
+#ifndef ARIES_HAVE_MPI
+        NULL_USE(buf);
+        NULL_USE(count);
+        NULL_USE(datatype);
+        NULL_USE(source);
+        NULL_USE(tag);
+        NULL_USE(request);
+#endif
+        int rval = MPI_SUCCESS;
+        if (!d_mpiIsInitialized)
+        {
+            ARIES_ERROR("AriesMPI::Recv_init is a no-op without run-time MPI!");
+        }
+#ifdef ARIES_HAVE_MPI
+        else
+        {
+            rval = MPI_Recv_init(buf, count, datatype, source, tag, d_comm, request);
+        }
+#endif
+        return rval;
+    }
+
     int AriesMPI::Probe(int source, int tag, Status* status) const
     {
 #ifndef ARIES_HAVE_MPI
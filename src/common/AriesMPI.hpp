@@ -51,6 +51,7 @@ enum
     MPI_FLOAT,
     MPI_INT,
     MPI_LONG,
+    MPI_UNSIGNED_LONG,
     MPI_C_DOUBLE_COMPLEX,
     MPI_2INT,
     MPI_DOUBLE_INT,
@@ -260,7 +261,7 @@ namespace ARIES
         {
 #ifdef ARIES_HAVE_MPI
             int compareResult = CompareCommunicator(other);
-            return compareRresult == MPI_CONGRUENT || compareResult == MPI_IDENT;
+            return compareResult == MPI_CONGRUENT || compareResult == MPI_IDENT;
 
 #else
             return d_comm != MPI_COMM_NULL && d_comm == other.d_comm;
@@ -298,6 +299,7 @@ namespace ARIES
         static int Finalized(int* flag);
         static int Get_count(Status* status, Datatype datatype, int* count);
         static int Request_free(Request* request);
+        static int Startall(int count, Request* reqs);
         static int Test(Request* request, int* flag, Status* status);
         static int Test_cancelled(Status* status, int* flag);
         static int Wait(Request* request, Status* status);
@@ -312,6 +314,8 @@ namespace ARIES
         int Allgather(void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf, int recvcount, Datatype recvtype) const;
         int Allgatherv(void* sendbuf, int sendcvount, Datatype sendtype, void* recvbuf, int* recvcounts, int* displs, Datatype recvtype) const;
         int Allreduce(void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op) const;
+        int Alltoall(void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf, int recvcount, Datatype recvtype) const;
+        int Alltoallv(void* sendbuf, int* sendcounts, int* sdispls, Datatype sendtype, void* recvbuf, int* recvcounts, int* rdispls, Datatype recvtype) const;
         int Attr_get(int keyval, void* attribute_val, int* flag) const;
         int Barrier() const;
         int Bcast(void* buffer, int count, Datatype datatype, int root) const;
@@ -323,6 +327,8 @@ namespace ARIES
         int Iprobe(int source, int tag, int* flag, Status* status) const;
         int Isend(void* buf, int count, Datatype datatype, int dest, int tag, Request* req) const;
         int Irecv(void* buf, int count, Datatype datatype, int source, int tag, Request* request) const;
+        int Send_init(void* buf, int count, Datatype datatype, int dest, int tag, Request* req) const;
+        int Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Request* request) const;
         int Probe(int source, int tag, Status* status) const;
         int Recv(void* buf, int count, Datatype datatype, int source, int tag, Status* status) const;
         int Reduce( void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, int root) const;
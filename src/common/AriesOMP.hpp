@@ -40,6 +40,7 @@
 
 #define ARIES_omp_get_num_threads() omp_get_num_threads()
 #define ARIES_omp_get_max_threads() omp_get_max_threads()
+#define ARIES_omp_get_thread_num() omp_get_thread_num()
 
 #define ARIES_IF_SINGLE_THREAD(CODE)            \
     {                                           \
@@ -85,6 +86,7 @@
 
 #define ARIES_omp_get_num_threads() (1)
 #define ARIES_omp_get_max_threads() (1)
+#define ARIES_omp_get_thread_num() (0)
 
 #define ARIES_IF_SINGLE_THREAD(CODE) { CODE }
 #define ARIES_IF_MULTI_THREAD(CODE)
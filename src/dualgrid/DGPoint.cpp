@@ -26,6 +26,9 @@ namespace ARIES
         d_elem.clear(); 
         d_point.clear(); 
         d_edge.clear();
+        d_elemList = NULL;
+        d_pointList = NULL;
+        d_edgeList = NULL;
 
         /*
          *  Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume
@@ -103,6 +106,9 @@ namespace ARIES
         d_elem.clear(); 
         d_point.clear(); 
         d_edge.clear();
+        d_elemList = NULL;
+        d_pointList = NULL;
+        d_edgeList = NULL;
 
         /*
          *  Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume
@@ -181,6 +187,9 @@ namespace ARIES
         d_elem.clear(); 
         d_point.clear(); 
         d_edge.clear();
+        d_elemList = NULL;
+        d_pointList = NULL;
+        d_edgeList = NULL;
 
         /*
          *  Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume
@@ -282,14 +291,20 @@ namespace ARIES
 
     void DGPoint::SetElem(unsigned long val_elem) 
     { 
+        /*--- Take a copy of a shared list before growing it ---*/
+        if (d_numElem > 0 && (d_elem.empty() || d_elemList != &d_elem[0]))
+            d_elem.assign(d_elemList, d_elemList + d_numElem);
+
         d_elem.push_back(val_elem); 
         d_numElem = d_elem.size(); 
+        d_elemList = &d_elem[0];
     }
 
     void DGPoint::ResetElem()
     {
         d_elem.clear();
         d_numElem = 0;
+        d_elemList = NULL;
     }
     
     void DGPoint::SetPoint(unsigned long val_point) 
@@ -300,7 +315,7 @@ namespace ARIES
         /*--- Look for the point in the list ---*/
         new_point = true;
         for (iPoint = 0; iPoint < d_numPoint; iPoint++)
-            if (d_point[iPoint] == val_point) 
+            if (d_pointList[iPoint] == val_point) 
             {
                 new_point = false;
                 break;
@@ -309,9 +324,18 @@ namespace ARIES
         /*--- Store the point structure and dimensionalizate edge structure ---*/
         if (new_point) 
         {
+            /*--- Take a copy of shared lists before growing them ---*/
+            if (d_numPoint > 0 && (d_point.empty() || d_pointList != &d_point[0]))
+            {
+                d_point.assign(d_pointList, d_pointList + d_numPoint);
+                d_edge.assign(d_edgeList, d_edgeList + d_numPoint);
+            }
+
             d_point.push_back(val_point);
             d_edge.push_back(-1);
             d_numPoint = d_point.size();
+            d_pointList = &d_point[0];
+            d_edgeList = &d_edge[0];
         }
     }
 
@@ -320,6 +344,21 @@ namespace ARIES
         d_point.clear();
         d_edge.clear();
         d_numPoint = 0;
+        d_pointList = NULL;
+        d_edgeList = NULL;
+    }
+
+    void DGPoint::SetAdjacency(const unsigned long* val_elem, unsigned short val_numElem, const unsigned long* val_point, long* val_edge, unsigned short val_numPoint)
+    {
+        d_elem.clear();
+        d_point.clear();
+        d_edge.clear();
+
+        d_elemList = val_elem;
+        d_numElem = val_numElem;
+        d_pointList = val_point;
+        d_edgeList = val_edge;
+        d_numPoint = val_numPoint;
     }
 
     long DGPoint::GetVertex(unsigned short val_iVertex)
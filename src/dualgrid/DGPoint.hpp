@@ -74,16 +74,23 @@ namespace ARIES
         void SetCoord(unsigned short val_dim, double val_coord) { d_coord[val_dim]  = val_coord; };
         void AddCoord(unsigned short val_dim, double val_coord) { d_coord[val_dim] += val_coord; };
         
-        unsigned long GetElem(unsigned short val_elem) { return d_elem[val_elem]; };
+        unsigned long GetElem(unsigned short val_elem) { return d_elemList[val_elem]; };
         void SetElem(unsigned long val_elem);
         void ResetElem();
 
-        unsigned long GetPoint(unsigned short val_point) { return d_point[val_point]; };
+        unsigned long GetPoint(unsigned short val_point) { return d_pointList[val_point]; };
         void SetPoint(unsigned long val_point);
         void ResetPoint();
 
-        long GetEdge(unsigned short val_iEdge) { return d_edge[val_iEdge]; };
-        void SetEdge(long val_edge, unsigned short val_iEdge) { d_edge[val_iEdge] = val_edge; };
+        long GetEdge(unsigned short val_iEdge) { return d_edgeList[val_iEdge]; };
+        void SetEdge(long val_edge, unsigned short val_iEdge) { d_edgeList[val_iEdge] = val_edge; };
+
+        /*!
+         * \brief Read the surrounding elements, neighbors and edges from rows of flat (CSR) storage
+         *        owned by the geometry instead of lists grown one entry at a time. SetElem and
+         *        SetPoint still work afterwards, on a private copy.
+         */
+        void SetAdjacency(const unsigned long* val_elem, unsigned short val_numElem, const unsigned long* val_point, long* val_edge, unsigned short val_numPoint);
         
         long GetVertex(unsigned short val_iVertex);
         void SetVertex(long val_vertex, unsigned short val_iVertex);
@@ -163,7 +170,10 @@ namespace ARIES
                                                         
         vector<unsigned long> d_elem;		            /*!< \brief Elements that set up a control volume around a node. */
         vector<unsigned long> d_point;	                /*!< \brief Points surrounding the central node of the control volume. */
-        vector<unsigned long> d_edge;		            /*!< \brief Edges that set up a control volume. */
+        vector<long> d_edge;		                    /*!< \brief Edges that set up a control volume. */
+        const unsigned long* d_elemList;                /*!< \brief Elements in use, d_elem or a row of shared storage. */
+        const unsigned long* d_pointList;               /*!< \brief Points in use, d_point or a row of shared storage. */
+        long* d_edgeList;                               /*!< \brief Edges in use, d_edge or a row of shared storage. */
                                                         
         vector<double> d_volume;	                    /*!< \brief Volume or Area of the control volume in 3D and 2D. */
                                                         
@@ -241,6 +241,10 @@ namespace ARIES
             //		}
         }
 
+        void GEOM_Geometry::SetRestricted_Geometry(TBOX::TBOX_Config *config, GEOM_Geometry *fine_grid)
+        {
+        }
+
         void GEOM_Geometry::TestGeometry(void)
         {
             std::ofstream para_file;
@@ -355,6 +355,13 @@ namespace ARIES
              */
             virtual void SetRestricted_GridVelocity(GEOM_Geometry *fine_mesh, TBOX::TBOX_Config *config);
 
+            /*!
+             * \brief A virtual member.
+             * \param[in] config - Definition of the particular problem.
+             * \param[in] fine_grid - Geometry of the fine mesh.
+             */
+            virtual void SetRestricted_Geometry(TBOX::TBOX_Config *config, GEOM_Geometry *fine_grid);
+
             /*!
              * \brief Find and store all vertices on a sharp corner in the geometry.
              * \param[in] config - Definition of the particular problem.
@@ -433,6 +440,12 @@ namespace ARIES
              */
             virtual unsigned short GetGlobal_to_Local_Marker(unsigned short val_imarker);
 
+            /*!
+             * \brief A virtual member.
+             * \param[in] val_time - Wall time of the solver on this rank.
+             */
+            virtual void SetPartition_Timing(double val_time);
+
 
 
 
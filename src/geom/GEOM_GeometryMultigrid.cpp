@@ -5,6 +5,9 @@
 
 #include "GEOM_GeometryMultigrid.hpp"
 #include "GEOM_GeometryMultigridQueue.hpp"
+#include "GeomAgglomeration.hpp"
+
+#include <cstdlib>
 
 namespace ARIES
 {
@@ -21,7 +24,8 @@ namespace ARIES
             unsigned long iPoint, Index_CoarseCV, CVPoint, iElem, iVertex, jPoint, iteration, nVertexS, nVertexR, nBufferS_vector, nBufferR_vector, iParent, jVertex, *Buffer_Receive_Parent = NULL, *Buffer_Send_Parent = NULL, *Buffer_Receive_Children = NULL, *Buffer_Send_Children = NULL, *Parent_Remote = NULL, *Children_Remote = NULL, *Parent_Local = NULL, *Children_Local = NULL, Local_nPointCoarse, Local_nPointFine, Global_nPointCoarse, Global_nPointFine;;
             short marker_seed;
             bool agglomerate_seed = true;
-            unsigned short nChildren, iNode, counter, iMarker, jMarker, priority, MarkerS, MarkerR, *nChildren_MPI;
+            unsigned long iNode;
+            unsigned short nChildren, counter, iMarker, jMarker, priority, MarkerS, MarkerR, *nChildren_MPI;
             std::vector<unsigned long> Suitable_Indirect_Neighbors, Aux_Parent;
             std::vector<unsigned long>::iterator it;
             int rank;
@@ -222,6 +226,15 @@ namespace ARIES
                     }
                 }
 
+            /*--- In the stretched regions (boundary layers) the points are agglomerated two by two
+            along the lines of strong coupling, so that the coarse grids keep the anisotropy ---*/
+            SetSemiCoarsening(fine_grid, config, Index_CoarseCV);
+
+            /*--- The domain nodes are agglomerated by rounds of independent seeds, whatever the number of
+            threads so the coarse grids do not depend on it; the queue below then only sees the nodes
+            left out (those that fail the geometrical check) ---*/
+            SetParallelAgglomeration(fine_grid, config, Index_CoarseCV);
+
             /*--- Update the queue with the results from the boundary agglomeration ---*/
             for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint++)
             {
@@ -599,16 +612,56 @@ namespace ARIES
             /*--- Update the number of points after the MPI agglomeration ---*/
             nPoint = Index_CoarseCV;
 
+            /*--- Flat transfer operators between the fine grid and this level ---*/
+            SetTransfer_Operator(fine_grid);
+
             /*--- Console output with the summary of the agglomeration ---*/
             Local_nPointCoarse = nPoint;
             Local_nPointFine = fine_grid->GetnPoint();
 
+            /*--- Aspect ratio of the coarse control volumes of the domain (box around the children) ---*/
+            double *Coord_Fine = new double[Local_nPointFine*nDim], *Volume_Fine = new double[Local_nPointFine];
+            double Local_Aspect_Sum = 0.0, Local_Aspect_Max = 1.0, Global_Aspect_Sum, Global_Aspect_Max;
+            unsigned long Local_nAspect = 0, Global_nAspect;
+            long iPoint_Long;
+
+#pragma omp parallel for schedule(static)
+            for (iPoint_Long = 0; iPoint_Long < long(Local_nPointFine); iPoint_Long++)
+            {
+                for (unsigned short iDim = 0; iDim < nDim; iDim++)
+                    Coord_Fine[iPoint_Long*nDim + iDim] = fine_grid->node[iPoint_Long]->GetCoord(iDim);
+                Volume_Fine[iPoint_Long] = fine_grid->node[iPoint_Long]->GetVolume();
+            }
+
+#pragma omp parallel for schedule(dynamic, 256) reduction(+:Local_Aspect_Sum, Local_nAspect) reduction(max:Local_Aspect_Max)
+            for (iPoint_Long = 0; iPoint_Long < long(nPointDomain); iPoint_Long++)
+            {
+                unsigned short nChildren_Aspect = node[iPoint_Long]->GetnChildren_CV();
+                if (nChildren_Aspect == 0) continue;
+                std::vector<unsigned long> Children_Aspect(nChildren_Aspect);
+                for (unsigned short iChildren_Aspect = 0; iChildren_Aspect < nChildren_Aspect; iChildren_Aspect++)
+                    Children_Aspect[iChildren_Aspect] = node[iPoint_Long]->GetChildren_CV(iChildren_Aspect);
+                double Aspect = GeomAgglomeration::GetAspectRatio(nDim, nChildren_Aspect, &Children_Aspect[0], Coord_Fine, Volume_Fine);
+                Local_Aspect_Sum += Aspect;
+                Local_Aspect_Max = std::max(Local_Aspect_Max, Aspect);
+                Local_nAspect++;
+            }
+
+            delete[] Coord_Fine;
+            delete[] Volume_Fine;
+
 #ifdef HAVE_MPI
             MPI_Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
             MPI_Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+            MPI_Allreduce(&Local_nAspect, &Global_nAspect, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+            MPI_Allreduce(&Local_Aspect_Sum, &Global_Aspect_Sum, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+            MPI_Allreduce(&Local_Aspect_Max, &Global_Aspect_Max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #else
             Global_nPointCoarse = Local_nPointCoarse;
             Global_nPointFine = Local_nPointFine;
+            Global_nAspect = Local_nAspect;
+            Global_Aspect_Sum = Local_Aspect_Sum;
+            Global_Aspect_Max = Local_Aspect_Max;
 #endif
 
             double Coeff = 1.0, CFL = 0.0, factor = 1.5;
@@ -632,10 +685,23 @@ namespace ARIES
                 if (rank == TBOX::MASTER_NODE)
                 {
                     if (iMesh == 1) std::cout << "MG level: " << iMesh - 1 << " -> CVs: " << Global_nPointFine << ". Agglomeration rate 1/1.00. CFL " << config->GetCFL(iMesh - 1) << "." << std::endl;
-                    std::cout << "MG level: " << iMesh << " -> CVs: " << Global_nPointCoarse << ". Agglomeration rate 1/" << ratio << ". CFL " << CFL << "." << std::endl;
+                    std::cout << "MG level: " << iMesh << " -> CVs: " << Global_nPointCoarse << ". Agglomeration rate 1/" << ratio << ". CFL " << CFL << ".";
+                    std::cout << " Aspect ratio " << Global_Aspect_Sum / std::max(Global_nAspect, 1UL) << " (max " << Global_Aspect_Max << ")." << std::endl;
                 }
             }
 
+            /*--- With ARIES_BENCHMARK set in the environment, time the V-cycle transfers between
+            the fine grid and this level on the flow variables, summed over the ranks ---*/
+            if (getenv("ARIES_BENCHMARK") != NULL)
+            {
+                double Local_Rate = Transfer.Benchmark(nDim + 2, 10), Global_Rate = Local_Rate;
+#ifdef HAVE_MPI
+                MPI_Allreduce(&Local_Rate, &Global_Rate, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+                if (rank == TBOX::MASTER_NODE)
+                    std::cout << "MG level: " << iMesh << " -> V-cycle transfers: " << Global_Rate << " fine point values per second." << std::endl;
+            }
+
             delete[] copy_marker;
         }
 
@@ -751,11 +817,304 @@ namespace ARIES
             return (Stretching && Volume);
         }
 
+        void GEOM_GeometryMultigrid::SetParallelAgglomeration(GEOM_Geometry *fine_grid, TBOX::TBOX_Config *config, unsigned long &Index_CoarseCV)
+        {
+            unsigned long nPointFine = fine_grid->GetnPoint(), iPoint, nCoarse;
+            long iPoint_Long, iCoarse;
+
+            /*--- Flat neighbors and status of the fine points ---*/
+            std::vector<unsigned long> Point_Ptr(nPointFine + 1, 0), Point_List;
+            std::vector<unsigned short> Status(nPointFine);
+            bool *Indirect = new bool[nPointFine];
+
+            for (iPoint = 0; iPoint < nPointFine; iPoint++)
+                Point_Ptr[iPoint + 1] = Point_Ptr[iPoint] + fine_grid->node[iPoint]->GetnPoint();
+            Point_List.resize(Point_Ptr[nPointFine]);
+
+#pragma omp parallel for schedule(static)
+            for (iPoint_Long = 0; iPoint_Long < long(nPointFine); iPoint_Long++)
+            {
+                GRID::GRID_DGPoint *Point = fine_grid->node[iPoint_Long];
+                for (unsigned short iNode = 0; iNode < Point->GetnPoint(); iNode++)
+                    Point_List[Point_Ptr[iPoint_Long] + iNode] = Point->GetPoint(iNode);
+
+                if (Point->GetAgglomerate()) Status[iPoint_Long] = GeomAgglomeration::Status_Agglomerated;
+                else if (!Point->GetDomain()) Status[iPoint_Long] = GeomAgglomeration::Status_Excluded;
+                else if (GeometricalCheck(iPoint_Long, fine_grid, config)) Status[iPoint_Long] = GeomAgglomeration::Status_Free;
+                else Status[iPoint_Long] = GeomAgglomeration::Status_IndirectOnly;
+                Indirect[iPoint_Long] = Point->GetAgglomerate_Indirect();
+            }
+
+            GeomAgglomeration Agglomeration;
+            nCoarse = Agglomeration.Agglomerate(nPointFine, &Point_Ptr[0], &Point_List[0], &Status[0], Indirect);
+
+            /*--- Copy the parents and the children (the seed first) to the control volumes ---*/
+#pragma omp parallel for schedule(static)
+            for (iCoarse = 0; iCoarse < long(nCoarse); iCoarse++)
+            {
+                unsigned long Coarse_CV = Index_CoarseCV + iCoarse, CVPoint;
+                unsigned short nChildren = Agglomeration.GetNumChildren(iCoarse), iChildren;
+                for (iChildren = 0; iChildren < nChildren; iChildren++)
+                {
+                    CVPoint = Agglomeration.GetChildren(iCoarse)[iChildren];
+                    fine_grid->node[CVPoint]->SetParent_CV(Coarse_CV);
+                    node[Coarse_CV]->SetChildren_CV(iChildren, CVPoint);
+
+                    /*--- We set the indirect agglomeration information ---*/
+                    if (Agglomeration.GetIndirect(CVPoint) && fine_grid->node[CVPoint]->GetAgglomerate_Indirect())
+                        node[Coarse_CV]->SetAgglomerate_Indirect(true);
+                }
+                node[Coarse_CV]->SetnChildren_CV(nChildren);
+            }
+
+            Index_CoarseCV += nCoarse;
+            delete[] Indirect;
+        }
+
+        void GEOM_GeometryMultigrid::SetTransfer_Operator(GEOM_Geometry *fine_grid)
+        {
+            unsigned long nPointFine = fine_grid->GetnPoint();
+            long iPoint_Long;
+
+            std::vector<unsigned long> Parent(nPointFine);
+            std::vector<double> Volume(nPointFine);
+
+#pragma omp parallel for schedule(static)
+            for (iPoint_Long = 0; iPoint_Long < long(nPointFine); iPoint_Long++)
+            {
+                Parent[iPoint_Long] = fine_grid->node[iPoint_Long]->GetParent_CV();
+                Volume[iPoint_Long] = fine_grid->node[iPoint_Long]->GetVolume();
+            }
+
+            Transfer.SetTopology(nPointFine, nPoint, Parent.empty() ? NULL : &Parent[0]);
+            Transfer.SetVolume(Volume.empty() ? NULL : &Volume[0]);
+        }
+
+        void GEOM_GeometryMultigrid::SetTransfer_FaceMaps(GEOM_Geometry *fine_grid)
+        {
+            unsigned long iCoarsePoint, iFinePoint, iFinePoint_Neighbor, iParent, iVertex, Vertex_Coarse_Begin = 0, nVertexCoarse = 0;
+            unsigned short iMarker, iChildren, iNode;
+            long FineVertex;
+            std::vector<unsigned long> Coarse_Entry, Fine_Entry, Vertex_Fine_Ptr(nMarker + 1, 0);
+            std::vector<short> Sign_Entry;
+
+            /*--- Fine edges of the coarse edges, with the orientation used by SetControlVolume ---*/
+            for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++)
+                for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren++)
+                {
+                    iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+                    for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode++)
+                    {
+                        iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
+                        iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
+                        if ((iParent != iCoarsePoint) && (iParent < iCoarsePoint))
+                        {
+                            Coarse_Entry.push_back(FindEdge(iParent, iCoarsePoint));
+                            Fine_Entry.push_back(fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor));
+                            Sign_Entry.push_back((iFinePoint < iFinePoint_Neighbor) ? -1 : 1);
+                        }
+                    }
+                }
+
+            Transfer.SetEdgeMap(nEdge, Coarse_Entry.size(), Coarse_Entry.empty() ? NULL : &Coarse_Entry[0], Fine_Entry.empty() ? NULL : &Fine_Entry[0], Sign_Entry.empty() ? NULL : &Sign_Entry[0]);
+
+            /*--- Fine vertices of the coarse vertices, numbered over all the markers ---*/
+            for (iMarker = 0; iMarker < nMarker; iMarker++)
+            {
+                Vertex_Fine_Ptr[iMarker + 1] = Vertex_Fine_Ptr[iMarker] + fine_grid->GetnVertex(iMarker);
+                nVertexCoarse += nVertex[iMarker];
+            }
+
+            Coarse_Entry.clear(); Fine_Entry.clear();
+            for (iMarker = 0; iMarker < nMarker; iMarker++)
+            {
+                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+                {
+                    iCoarsePoint = vertex[iMarker][iVertex]->GetNode();
+                    for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren++)
+                    {
+                        iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+                        FineVertex = fine_grid->node[iFinePoint]->GetVertex(iMarker);
+                        if (FineVertex != -1)
+                        {
+                            Coarse_Entry.push_back(Vertex_Coarse_Begin + iVertex);
+                            Fine_Entry.push_back(Vertex_Fine_Ptr[iMarker] + FineVertex);
+                        }
+                    }
+                }
+                Vertex_Coarse_Begin += nVertex[iMarker];
+            }
+
+            Transfer.SetVertexMap(nVertexCoarse, Coarse_Entry.size(), Coarse_Entry.empty() ? NULL : &Coarse_Entry[0], Fine_Entry.empty() ? NULL : &Fine_Entry[0]);
+        }
+
+        void GEOM_GeometryMultigrid::SetRestricted_Geometry(TBOX::TBOX_Config *config, GEOM_Geometry *fine_grid)
+        {
+            unsigned long nPointFine = fine_grid->GetnPoint(), nEdgeFine = fine_grid->GetnEdge(), nVertexFine = 0, nVertexCoarse = 0;
+            unsigned short iMarker;
+            long iPoint_Long, iEdge_Long, iVertex_Long;
+            bool grid_movement = config->GetGrid_Movement();
+
+            std::vector<unsigned long> Vertex_Fine_Ptr(nMarker + 1, 0), Vertex_Coarse_Ptr(nMarker + 1, 0);
+            for (iMarker = 0; iMarker < nMarker; iMarker++)
+            {
+                Vertex_Fine_Ptr[iMarker + 1] = Vertex_Fine_Ptr[iMarker] + fine_grid->GetnVertex(iMarker);
+                Vertex_Coarse_Ptr[iMarker + 1] = Vertex_Coarse_Ptr[iMarker] + nVertex[iMarker];
+            }
+            nVertexFine = Vertex_Fine_Ptr[nMarker]; nVertexCoarse = Vertex_Coarse_Ptr[nMarker];
+
+            /*--- The maps only depend on the agglomeration, they are set once ---*/
+            if ((Transfer.GetNumCoarseEdge() != nEdge) || (Transfer.GetNumCoarseVertex() != nVertexCoarse))
+                SetTransfer_FaceMaps(fine_grid);
+
+            /*--- Flat copies of the fine level ---*/
+            std::vector<double> Volume_Fine(nPointFine), Coord_Fine(nPointFine * nDim), GridVel_Fine, Normal_Fine(nEdgeFine * nDim), Vertex_Normal_Fine(nVertexFine * nDim);
+            std::vector<double> Coord(nPoint * nDim), GridVel, Normal(nEdge * nDim), Vertex_Normal(nVertexCoarse * nDim);
+            if (grid_movement)
+            {
+                GridVel_Fine.resize(nPointFine * nDim);
+                GridVel.resize(nPoint * nDim);
+            }
+
+#pragma omp parallel for schedule(static)
+            for (iPoint_Long = 0; iPoint_Long < long(nPointFine); iPoint_Long++)
+            {
+                Volume_Fine[iPoint_Long] = fine_grid->node[iPoint_Long]->GetVolume();
+                for (unsigned short iDim = 0; iDim < nDim; iDim++)
+                {
+                    Coord_Fine[iPoint_Long * nDim + iDim] = fine_grid->node[iPoint_Long]->GetCoord(iDim);
+                    if (grid_movement) GridVel_Fine[iPoint_Long * nDim + iDim] = fine_grid->node[iPoint_Long]->GetGridVel()[iDim];
+                }
+            }
+
+#pragma omp parallel for schedule(static)
+            for (iEdge_Long = 0; iEdge_Long < long(nEdgeFine); iEdge_Long++)
+                fine_grid->edge[iEdge_Long]->GetNormal(&Normal_Fine[iEdge_Long * nDim]);
+
+            for (iMarker = 0; iMarker < nMarker; iMarker++)
+            {
+#pragma omp parallel for schedule(static)
+                for (iVertex_Long = 0; iVertex_Long < long(fine_grid->GetnVertex(iMarker)); iVertex_Long++)
+                    fine_grid->vertex[iMarker][iVertex_Long]->GetNormal(&Vertex_Normal_Fine[(Vertex_Fine_Ptr[iMarker] + iVertex_Long) * nDim]);
+            }
+
+            /*--- Coarse volumes and weights, then the volume-weighted coordinates and velocities, and the summed faces ---*/
+            Transfer.SetVolume(Volume_Fine.empty() ? NULL : &Volume_Fine[0]);
+            Transfer.Restrict(nDim, Coord_Fine.empty() ? NULL : &Coord_Fine[0], Coord.empty() ? NULL : &Coord[0]);
+            if (grid_movement) Transfer.Restrict(nDim, GridVel_Fine.empty() ? NULL : &GridVel_Fine[0], GridVel.empty() ? NULL : &GridVel[0]);
+            Transfer.RestrictEdgeNormal(nDim, Normal_Fine.empty() ? NULL : &Normal_Fine[0], Normal.empty() ? NULL : &Normal[0]);
+            Transfer.RestrictVertexNormal(nDim, Vertex_Normal_Fine.empty() ? NULL : &Vertex_Normal_Fine[0], Vertex_Normal.empty() ? NULL : &Vertex_Normal[0]);
+
+            /*--- Copy back to the coarse level ---*/
+#pragma omp parallel for schedule(static)
+            for (iPoint_Long = 0; iPoint_Long < long(nPoint); iPoint_Long++)
+            {
+                node[iPoint_Long]->SetVolume(Transfer.GetCoarseVolume(iPoint_Long));
+                for (unsigned short iDim = 0; iDim < nDim; iDim++)
+                {
+                    node[iPoint_Long]->SetCoord(iDim, Coord[iPoint_Long * nDim + iDim]);
+                    if (grid_movement) node[iPoint_Long]->SetGridVel(iDim, GridVel[iPoint_Long * nDim + iDim]);
+                }
+            }
+
+#pragma omp parallel for schedule(static)
+            for (iEdge_Long = 0; iEdge_Long < long(nEdge); iEdge_Long++)
+                edge[iEdge_Long]->SetNormal(&Normal[iEdge_Long * nDim]);
+
+            for (iMarker = 0; iMarker < nMarker; iMarker++)
+            {
+#pragma omp parallel for schedule(static)
+                for (iVertex_Long = 0; iVertex_Long < long(nVertex[iMarker]); iVertex_Long++)
+                    vertex[iMarker][iVertex_Long]->SetNormal(&Vertex_Normal[(Vertex_Coarse_Ptr[iMarker] + iVertex_Long) * nDim]);
+            }
+        }
+
+        void GEOM_GeometryMultigrid::SetSemiCoarsening(GEOM_Geometry *fine_grid, TBOX::TBOX_Config *config, unsigned long &Index_CoarseCV)
+        {
+            unsigned long nPointFine = fine_grid->GetnPoint(), nEdgeFine = fine_grid->GetnEdge(), iVertex, iLine, iPoint, First_Point = 0;
+            unsigned long iLinePoint, nPending = 0;
+            unsigned short iMarker;
+            long iPoint_Long, iEdge_Long;
+
+            /*--- Ratio between the strongest and the weakest coupling of a stretched point (cell aspect ratio about 2) ---*/
+            double Line_Threshold = 4.0;
+
+            /*--- Flat edges and points of the fine grid ---*/
+            std::vector<unsigned long> Edge_Node(2 * nEdgeFine);
+            std::vector<double> Edge_Normal(nDim * nEdgeFine), Coord(nDim * nPointFine);
+            bool *Wall_Point = new bool[nPointFine], *Domain_Point = new bool[nPointFine];
+
+#pragma omp parallel for schedule(static)
+            for (iEdge_Long = 0; iEdge_Long < long(nEdgeFine); iEdge_Long++)
+            {
+                Edge_Node[2 * iEdge_Long] = fine_grid->edge[iEdge_Long]->GetNode(0);
+                Edge_Node[2 * iEdge_Long + 1] = fine_grid->edge[iEdge_Long]->GetNode(1);
+                fine_grid->edge[iEdge_Long]->GetNormal(&Edge_Normal[nDim * iEdge_Long]);
+            }
+
+#pragma omp parallel for schedule(static)
+            for (iPoint_Long = 0; iPoint_Long < long(nPointFine); iPoint_Long++)
+            {
+                for (unsigned short iDim = 0; iDim < nDim; iDim++)
+                    Coord[nDim * iPoint_Long + iDim] = fine_grid->node[iPoint_Long]->GetCoord(iDim);
+                Wall_Point[iPoint_Long] = false;
+                Domain_Point[iPoint_Long] = fine_grid->node[iPoint_Long]->GetDomain();
+            }
+
+            for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+                if ((config->GetMarker_All_KindBC(iMarker) == TBOX::HEAT_FLUX) ||
+                    (config->GetMarker_All_KindBC(iMarker) == TBOX::HEAT_FLUX_CATALYTIC) ||
+                    (config->GetMarker_All_KindBC(iMarker) == TBOX::HEAT_FLUX_NONCATALYTIC) ||
+                    (config->GetMarker_All_KindBC(iMarker) == TBOX::ISOTHERMAL) ||
+                    (config->GetMarker_All_KindBC(iMarker) == TBOX::ISOTHERMAL_CATALYTIC) ||
+                    (config->GetMarker_All_KindBC(iMarker) == TBOX::ISOTHERMAL_NONCATALYTIC))
+                    for (iVertex = 0; iVertex < fine_grid->GetnVertex(iMarker); iVertex++)
+                        Wall_Point[fine_grid->vertex[iMarker][iVertex]->GetNode()] = true;
+
+            Fine_Lines.Build(nDim, nPointFine, nEdgeFine, &Edge_Node[0], &Edge_Normal[0], &Coord[0], Wall_Point, Domain_Point, Line_Threshold);
+
+            delete[] Wall_Point;
+            delete[] Domain_Point;
+
+            /*--- Pair the consecutive free points of every line (the wall points are already agglomerated) ---*/
+            for (iLine = 0; iLine < Fine_Lines.GetNumLine(); iLine++)
+            {
+                nPending = 0;
+                for (iLinePoint = 0; iLinePoint < Fine_Lines.GetNumLinePoint(iLine); iLinePoint++)
+                {
+                    iPoint = Fine_Lines.GetLinePoint(iLine)[iLinePoint];
+
+                    if ((fine_grid->node[iPoint]->GetAgglomerate() == true) ||
+                        (GeometricalCheck(iPoint, fine_grid, config) == false))
+                    {
+                        nPending = 0;
+                        continue;
+                    }
+
+                    if (nPending == 0)
+                    {
+                        First_Point = iPoint;
+                        nPending = 1;
+                        continue;
+                    }
+
+                    fine_grid->node[First_Point]->SetParent_CV(Index_CoarseCV);
+                    fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
+                    node[Index_CoarseCV]->SetChildren_CV(0, First_Point);
+                    node[Index_CoarseCV]->SetChildren_CV(1, iPoint);
+                    node[Index_CoarseCV]->SetnChildren_CV(2);
+                    Index_CoarseCV++;
+                    nPending = 0;
+                }
+            }
+        }
+
         void GEOM_GeometryMultigrid::SetSuitableNeighbors(std::vector<unsigned long> *Suitable_Indirect_Neighbors, unsigned long iPoint, unsigned long Index_CoarseCV, GEOM_Geometry *fine_grid)
         {
 
             unsigned long jPoint, kPoint, lPoint;
-            unsigned short iNode, jNode, iNeighbor, jNeighbor, kNode;
+            unsigned short iNode, kNode;
+            unsigned long jNode, iNeighbor, jNeighbor;
             bool SecondNeighborSeed, ThirdNeighborSeed;
             std::vector<unsigned long>::iterator it;
 
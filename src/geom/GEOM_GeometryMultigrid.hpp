@@ -16,6 +16,8 @@
 
 #include "../Common/TBOX_Config.hpp"
 #include "GEOM_Geometry.hpp"
+#include "GeomImplicitLines.hpp"
+#include "GeomTransferOperator.hpp"
 
 namespace ARIES
 {
@@ -67,6 +69,53 @@ namespace ARIES
             */
             void SetSuitableNeighbors(std::vector<unsigned long> *Suitable_Indirect_Neighbors, unsigned long iPoint, unsigned long Index_CoarseCV, GEOM_Geometry *fine_grid);
 
+            /*!
+            * \brief Agglomerate the domain nodes with threads, by rounds of independent seeds (see GeomAgglomeration).
+            * \param[in] fine_grid - Geometrical definition of the problem.
+            * \param[in] config - Definition of the particular problem.
+            * \param[in,out] Index_CoarseCV - Index of the next agglomerated point.
+            */
+            void SetParallelAgglomeration(GEOM_Geometry *fine_grid, TBOX::TBOX_Config *config, unsigned long &Index_CoarseCV);
+
+            /*!
+            * \brief Build the lines of strong coupling of the fine grid, from the viscous walls, and agglomerate
+            *        their points two by two (semi-coarsening across the boundary layer).
+            * \param[in] fine_grid - Geometrical definition of the problem.
+            * \param[in] config - Definition of the particular problem.
+            * \param[in,out] Index_CoarseCV - Index of the next agglomerated point.
+            */
+            void SetSemiCoarsening(GEOM_Geometry *fine_grid, TBOX::TBOX_Config *config, unsigned long &Index_CoarseCV);
+
+            /*!
+            * \brief Get the lines of the finer level along which this level was semi-coarsened (for line-implicit smoothing).
+            */
+            const GeomImplicitLines& GetFine_Lines(void) const;
+
+            /*!
+            * \brief Set the restriction/prolongation operators between the finer level and this level.
+            * \param[in] fine_grid - Geometrical definition of the finer level.
+            */
+            void SetTransfer_Operator(GEOM_Geometry *fine_grid);
+
+            /*!
+            * \brief Get the restriction/prolongation operators between the finer level and this level.
+            */
+            const GeomTransferOperator& GetTransfer_Operator(void) const;
+
+            /*!
+            * \brief Set the maps of the coarse edges and boundary vertices to the fine ones (after SetControlVolume).
+            * \param[in] fine_grid - Geometrical definition of the finer level.
+            */
+            void SetTransfer_FaceMaps(GEOM_Geometry *fine_grid);
+
+            /*!
+            * \brief Update volumes, coordinates, normals and grid velocities after the fine mesh moved,
+            *        through the transfer maps and without rebuilding the agglomeration.
+            * \param[in] config - Definition of the particular problem.
+            * \param[in] fine_grid - Geometrical definition of the finer level.
+            */
+            void SetRestricted_Geometry(TBOX::TBOX_Config *config, GEOM_Geometry *fine_grid);
+
             /*!
             * \brief Set boundary vertex.
             * \param[in] geometry - Geometrical definition of the problem.
@@ -181,6 +230,10 @@ namespace ARIES
             * \brief Get all points on a geometrical plane in the mesh
             */
             std::vector<std::vector<unsigned long> > GetPlanarPoints();
+
+        protected:
+            GeomImplicitLines Fine_Lines;	/*!< \brief Lines of strong coupling of the finer level. */
+            GeomTransferOperator Transfer;	/*!< \brief Transfer operators from and to the finer level. */
         };
     }
 }
@@ -22,6 +22,10 @@ namespace ARIES
         inline std::vector<std::vector<double> > GEOM_GeometryMultigrid::GetZCoord() { return Zcoord_plane; }
 
         inline std::vector<std::vector<unsigned long> > GEOM_GeometryMultigrid::GetPlanarPoints() { return Plane_points; }
+
+        inline const GeomImplicitLines& GEOM_GeometryMultigrid::GetFine_Lines(void) const { return Fine_Lines; }
+
+        inline const GeomTransferOperator& GEOM_GeometryMultigrid::GetTransfer_Operator(void) const { return Transfer; }
     }
 }
 
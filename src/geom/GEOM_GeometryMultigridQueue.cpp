@@ -17,15 +17,28 @@ namespace ARIES
             Priority = new short[nPoint];
             RightCV = new bool[nPoint];
 
-            QueueCV.resize(1);
+            First_QueueCV.assign(1, -1);
+            Last_QueueCV.assign(1, -1);
+            Next_QueueCV.resize(nPoint);
+            Prev_QueueCV.resize(nPoint);
 
             /*--- Queue initialization with all the points in the finer grid ---*/
             for (iPoint = 0; iPoint < nPoint; iPoint++) 
             {
-                QueueCV[0].push_back(iPoint);
+                Prev_QueueCV[iPoint] = long(iPoint) - 1;
+                Next_QueueCV[iPoint] = (iPoint + 1 < nPoint) ? long(iPoint + 1) : -1;
                 Priority[iPoint] = 0;
                 RightCV[iPoint] = true;
             }
+            if (nPoint > 0)
+            {
+                First_QueueCV[0] = 0;
+                Last_QueueCV[0] = nPoint - 1;
+            }
+
+            Max_Priority = 0;
+            nQueueCV = nPoint;
+            nRightCV_Zero = nPoint;
         }
 
         GEOM_GeometryMultigridQueue::~GEOM_GeometryMultigridQueue(void) 
@@ -36,38 +49,44 @@ namespace ARIES
 
         void GEOM_GeometryMultigridQueue::AddCV(unsigned long val_new_point, unsigned short val_number_neighbors) 
         {
-            unsigned short Max_Neighbors = QueueCV.size() - 1;
-
             /*--- Basic check ---*/
-            if (val_new_point > nPoint)
+            if (val_new_point >= nPoint)
             {
                 std::cout << "The index of the CV is greater than the size of the priority list." << std::endl;
                 exit(EXIT_FAILURE);
             }
 
-            /*--- Resize the list ---*/
-            if (val_number_neighbors > Max_Neighbors)
-                QueueCV.resize(val_number_neighbors + 1);
+            /*--- Already in the queue with this priority ---*/
+            if (Priority[val_new_point] == val_number_neighbors) return;
 
-            /*--- Find the point in the queue ---*/
-            bool InQueue = false;
-            if (Priority[val_new_point] == val_number_neighbors) InQueue = true;
+            /*--- Queued with another priority: move it ---*/
+            if (Priority[val_new_point] != -1) RemoveCV(val_new_point);
 
-            if (!InQueue) 
+            /*--- Resize the list ---*/
+            if (val_number_neighbors >= First_QueueCV.size())
             {
-                /*--- Add the control volume, and update the priority list ---*/
-                QueueCV[val_number_neighbors].push_back(val_new_point);
-                Priority[val_new_point] = val_number_neighbors;
+                First_QueueCV.resize(val_number_neighbors + 1, -1);
+                Last_QueueCV.resize(val_number_neighbors + 1, -1);
             }
+
+            /*--- Add the control volume at the end of its priority, and update the priority list ---*/
+            long Last = Last_QueueCV[val_number_neighbors];
+            Prev_QueueCV[val_new_point] = Last;
+            Next_QueueCV[val_new_point] = -1;
+            if (Last != -1) Next_QueueCV[Last] = val_new_point;
+            else First_QueueCV[val_number_neighbors] = val_new_point;
+            Last_QueueCV[val_number_neighbors] = val_new_point;
+
+            Priority[val_new_point] = val_number_neighbors;
+            nQueueCV++;
+            if ((val_number_neighbors == 0) && RightCV[val_new_point]) nRightCV_Zero++;
+            if (short(val_number_neighbors) > Max_Priority) Max_Priority = val_number_neighbors;
         }
 
         void GEOM_GeometryMultigridQueue::RemoveCV(unsigned long val_remove_point) 
         {
-            unsigned short iPoint;
-            bool check;
-
             /*--- Basic check ---*/
-            if (val_remove_point > nPoint) 
+            if (val_remove_point >= nPoint) 
             {
                 std::cout << "The index of the CV is greater than the size of the priority list." << std::endl;
                 exit(EXIT_FAILURE);
@@ -81,31 +100,27 @@ namespace ARIES
                 exit(EXIT_FAILURE);
             }
 
-            /*--- Find the point in the queue ---*/
-            std::vector<unsigned long>::iterator ItQueue = find(QueueCV[Number_Neighbors].begin(),
-                QueueCV[Number_Neighbors].end(),
-                val_remove_point);
-            if (ItQueue != QueueCV[Number_Neighbors].end()) QueueCV[Number_Neighbors].erase(ItQueue);
+            /*--- Unlink the point from its priority ---*/
+            long Prev = Prev_QueueCV[val_remove_point], Next = Next_QueueCV[val_remove_point];
+            if (Prev != -1) Next_QueueCV[Prev] = Next;
+            else First_QueueCV[Number_Neighbors] = Next;
+            if (Next != -1) Prev_QueueCV[Next] = Prev;
+            else Last_QueueCV[Number_Neighbors] = Prev;
 
             Priority[val_remove_point] = -1;
+            nQueueCV--;
+            if ((Number_Neighbors == 0) && RightCV[val_remove_point]) nRightCV_Zero--;
 
-            /*--- Check that the size of the queue is the right one ---*/
-            unsigned short Size_QueueCV = 0;
-            check = false;
-            for (iPoint = 0; iPoint < QueueCV.size(); iPoint++)
-                if (QueueCV[iPoint].size() != 0) 
-                { 
-                    Size_QueueCV = iPoint; check = true; 
-                }
-
-            /*--- Resize the queue, if check = false, the queue is empty, at least
-            we need one element in the queue ---*/
-            if (check) QueueCV.resize(Size_QueueCV + 1);
-            else QueueCV.resize(1);
+            /*--- Lower the highest priority past the empty lists, the list
+            of priority 0 always exists ---*/
+            while ((Max_Priority > 0) && (First_QueueCV[Max_Priority] == -1)) Max_Priority--;
         }
 
         void GEOM_GeometryMultigridQueue::MoveCV(unsigned long val_move_point, short val_number_neighbors) 
         {
+            /*--- Remove the control volume ---*/
+            RemoveCV(val_move_point);
+
             if (val_number_neighbors < 0) 
             {
                 val_number_neighbors = 0;
@@ -116,9 +131,6 @@ namespace ARIES
                 RightCV[val_move_point] = true;
             }
 
-            /*--- Remove the control volume ---*/
-            RemoveCV(val_move_point);
-
             /*--- Add a new control volume ---*/
             AddCV(val_move_point, val_number_neighbors);
         }
@@ -162,16 +174,16 @@ namespace ARIES
 
         void GEOM_GeometryMultigridQueue::VisualizeQueue(void) 
         {
-            unsigned short iPoint;
-            unsigned long jPoint;
+            short iPriority;
+            long jPoint;
 
             std::cout << std::endl;
-            for (iPoint = 0; iPoint < QueueCV.size(); iPoint++) 
+            for (iPriority = 0; iPriority <= Max_Priority; iPriority++) 
             {
-                std::cout << "Number of neighbors " << iPoint << ": ";
-                for (jPoint = 0; jPoint < QueueCV[iPoint].size(); jPoint++) 
+                std::cout << "Number of neighbors " << iPriority << ": ";
+                for (jPoint = First_QueueCV[iPriority]; jPoint != -1; jPoint = Next_QueueCV[jPoint]) 
                 {
-                    std::cout << QueueCV[iPoint][jPoint] << " ";
+                    std::cout << jPoint << " ";
                 }
                 std::cout << std::endl;
             }
@@ -187,47 +199,22 @@ namespace ARIES
 
         long GEOM_GeometryMultigridQueue::NextCV(void)
         {
-            if (QueueCV.size() != 0) return QueueCV[QueueCV.size() - 1][0];
+            /*--- Oldest control volume of the highest priority ---*/
+            if (nQueueCV != 0) return First_QueueCV[Max_Priority];
             else return -1;
         }
 
         bool GEOM_GeometryMultigridQueue::EmptyQueue(void) 
         {
-            unsigned short iPoint;
-
             /*--- In case there is only the no agglomerated elements,
             check if they can be agglomerated or we have already finished ---*/
-            bool check = true;
-
-            if (QueueCV.size() == 1) 
-            {
-                for (iPoint = 0; iPoint < QueueCV[0].size(); iPoint++) 
-                {
-                    if (RightCV[QueueCV[0][iPoint]]) { check = false; break; }
-                }
-            }
-            else 
-            {
-                for (iPoint = 1; iPoint < QueueCV.size(); iPoint++)
-                    if (QueueCV[iPoint].size() != 0) { check = false; break; }
-            }
-
-            return check;
+            if (Max_Priority == 0) return (nRightCV_Zero == 0);
+            else return false;
         }
 
         unsigned long GEOM_GeometryMultigridQueue::TotalCV(void) 
         {
-            unsigned short iPoint;
-            unsigned long TotalCV;
-
-            TotalCV = 0;
-            for (iPoint = 0; iPoint < QueueCV.size(); iPoint++)
-                if (QueueCV[iPoint].size() != 0) 
-                { 
-                    TotalCV += QueueCV[iPoint].size();
-                }
-
-            return TotalCV;
+            return nQueueCV;
         }
 
         void GEOM_GeometryMultigridQueue::Update(unsigned long iPoint, GEOM_Geometry *fine_grid) 
@@ -20,9 +20,21 @@ namespace ARIES
 {
     namespace GEOM
     {
+        /*!
+        * \brief Control volumes bucketed by priority. Every bucket is a doubly-linked list threaded
+        *        through two arrays indexed by the point, so adding, removing or moving a control volume
+        *        is O(1) and keeps the order of arrival inside a bucket; the highest non-empty priority,
+        *        the size of the queue and the agglomerable volumes of priority 0 are kept up to date.
+        */
         class GEOM_GeometryMultigridQueue 
         {
-            std::vector<std::vector<unsigned long> > QueueCV; /*!< \brief Queue structure to choose the next control volume in the agglomeration process. */
+            std::vector<long> First_QueueCV;	/*!< \brief First (oldest) control volume of every priority, -1 if there is none. */
+            std::vector<long> Last_QueueCV;	/*!< \brief Last control volume of every priority, -1 if there is none. */
+            std::vector<long> Next_QueueCV;	/*!< \brief Next control volume with the same priority, -1 at the end. */
+            std::vector<long> Prev_QueueCV;	/*!< \brief Previous control volume with the same priority, -1 at the beginning. */
+            short Max_Priority;	/*!< \brief Highest priority with control volumes, 0 if the queue is empty. */
+            unsigned long nQueueCV;	/*!< \brief Number of control volumes in the queue. */
+            unsigned long nRightCV_Zero;	/*!< \brief Control volumes of priority 0 that can still be agglomerated. */
             short *Priority;	/*!< \brief The priority is based on the number of pre-agglomerated neighbors. */
             bool *RightCV;	/*!< \brief In the lowest priority there are some CV that can not be agglomerated, this is the way to identify them */
             unsigned long nPoint; /*!< \brief Total number of points. */
@@ -4,6 +4,16 @@
 
 
 #include "GEOM_GeometryPhysical.hpp"
+#include "GeomPartitioner.hpp"
+#include "GeomCostModel.hpp"
+#include "GeomPointLocator.hpp"
+#include "GeomZoneTransfer.hpp"
+#include "GeomHaloExchange.hpp"
+#include "GeomSmoother.hpp"
+#include "GeomPeriodicMatcher.hpp"
+#include "GeomGeometryCache.hpp"
+
+#include <cstdlib>
 
 #include "../Grid/GRID_DualGrid.hpp"
 
@@ -25,6 +35,9 @@ namespace ARIES
             Global_to_Local_Point = NULL;
             Local_to_Global_Point = NULL;
             Local_to_Global_Marker = NULL;
+            ZoneTransfer = NULL;
+            MeshQuality = NULL;
+            HaloExchange = NULL;
             Global_to_Local_Marker = NULL;
         }
 
@@ -33,6 +46,9 @@ namespace ARIES
             Global_to_Local_Point = NULL;
             Local_to_Global_Point = NULL;
             Local_to_Global_Marker = NULL;
+            ZoneTransfer = NULL;
+            MeshQuality = NULL;
+            HaloExchange = NULL;
             Global_to_Local_Marker = NULL;
 
             std::string text_line, Marker_Tag;
@@ -146,6 +162,9 @@ namespace ARIES
             Global_to_Local_Point = NULL;
             Local_to_Global_Point = NULL;
             Local_to_Global_Marker = NULL;
+            ZoneTransfer = NULL;
+            MeshQuality = NULL;
+            HaloExchange = NULL;
             Global_to_Local_Marker = NULL;
 
             unsigned long iter, iPoint, jPoint, iElem, jElem, iVertex;
@@ -1364,6 +1383,9 @@ namespace ARIES
             Global_to_Local_Point = NULL;
             Local_to_Global_Point = NULL;
             Local_to_Global_Marker = NULL;
+            ZoneTransfer = NULL;
+            MeshQuality = NULL;
+            HaloExchange = NULL;
             Global_to_Local_Marker = NULL;
 
             unsigned long iter, iPoint, jPoint, iElem, iVertex;
@@ -4316,6 +4338,12 @@ namespace ARIES
                 delete[] Global_to_Local_Marker;
             if (Local_to_Global_Marker != NULL)
                 delete[] Local_to_Global_Marker;
+            if (ZoneTransfer != NULL)
+                delete ZoneTransfer;
+            if (MeshQuality != NULL)
+                delete MeshQuality;
+            if (HaloExchange != NULL)
+                delete HaloExchange;
         }
 
         void GEOM_GeometryPhysical::SetSendReceive(TBOX::TBOX_Config *config)
@@ -4496,6 +4524,13 @@ namespace ARIES
                 }
             }
             delete[] nVertexDomain;
+
+            /*--- The halo exchange is set up again from the final send/receive vertices on first use ---*/
+            if (HaloExchange != NULL)
+            {
+                delete HaloExchange;
+                HaloExchange = NULL;
+            }
         }
 
         void GEOM_GeometryPhysical::SetBoundaries(TBOX::TBOX_Config *config)
@@ -5485,51 +5520,29 @@ namespace ARIES
 
         void GEOM_GeometryPhysical::SetPoint_Connectivity(void) 
         {
-            unsigned short Node_Neighbor, iNode, iNeighbor;
-            unsigned long jElem, Point_Neighbor, iPoint, iElem;
+            unsigned short iNode;
+            unsigned long iPoint, iElem;
+
+            /*--- Flatten the element connectivity ---*/
+            std::vector<unsigned short> VTK_Type(nElem + 1);
+            std::vector<unsigned long> ElemPtr(nElem + 1, 0), ElemNode;
 
-            /*--- Loop over all the elements ---*/
             for (iElem = 0; iElem < nElem; iElem++)
             {
-                /*--- Loop over all the nodes of an element ---*/
+                VTK_Type[iElem] = elem[iElem]->GetVTK_Type();
                 for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
-                {
-                    iPoint = elem[iElem]->GetNode(iNode);
-
-                    /*--- Store the element into the point ---*/
-                    node[iPoint]->SetElem(iElem);
-                }
+                    ElemNode.push_back(elem[iElem]->GetNode(iNode));
+                ElemPtr[iElem + 1] = ElemNode.size();
             }
+            ElemNode.push_back(0);
 
-            /*--- Loop over all the points ---*/
+            /*--- Elements and neighbors of every point in two flat arrays each
+            (count, then fill), the points read their rows in place ---*/
+            Adjacency.Build(nPoint, nElem, &VTK_Type[0], &ElemPtr[0], &ElemNode[0]);
 
             for (iPoint = 0; iPoint < nPoint; iPoint++)
-            {
-                /*--- Loop over all elements shared by the point ---*/
-                for (iElem = 0; iElem < node[iPoint]->GetnElem(); iElem++)
-                {
-
-                    jElem = node[iPoint]->GetElem(iElem);
-
-                    /*--- If we find the point iPoint in the surronding element ---*/
-
-                    for (iNode = 0; iNode < elem[jElem]->GetnNodes(); iNode++)
-                    {
-                        if (elem[jElem]->GetNode(iNode) == iPoint)
-                        {
-                            /*--- Localize the local index of the neighbor of iPoint in the element ---*/
-                            for (iNeighbor = 0; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++)
-                            {
-                                Node_Neighbor = elem[jElem]->GetNeighbor_Nodes(iNode, iNeighbor);
-                                Point_Neighbor = elem[jElem]->GetNode(Node_Neighbor);
-
-                                /*--- Store the point into the point ---*/
-                                node[iPoint]->SetPoint(Point_Neighbor);
-                            }
-                        }
-                    }
-                }
-            }
+                node[iPoint]->SetAdjacency(Adjacency.GetElem(iPoint), (unsigned short)Adjacency.GetNumElem(iPoint),
+                                           Adjacency.GetNeighbor(iPoint), Adjacency.GetEdge(iPoint), (unsigned short)Adjacency.GetNumNeighbor(iPoint));
 
             /*--- Set the number of neighbors variable, this is
             important for JST and multigrid in parallel ---*/
@@ -5735,36 +5748,35 @@ namespace ARIES
 
         void GEOM_GeometryPhysical::SetElement_Connectivity(void)
         {
-            unsigned short first_elem_face, second_elem_face, iFace, iNode, jElem;
-            unsigned long face_point, Test_Elem, iElem;
+            unsigned short iFace, iNode;
+            unsigned long iElem;
+            long Neighbor_Elem;
 
-            /*--- Loop over all the elements, faces and nodes ---*/
+            /*--- Flatten the faces of all the elements (as points) ---*/
+            std::vector<unsigned long> ElemFacePtr(nElem + 1, 0), FaceNodePtr(1, 0), FaceNode;
 
             for (iElem = 0; iElem < nElem; iElem++)
             {
                 for (iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++)
                 {
                     for (iNode = 0; iNode < elem[iElem]->GetnNodesFace(iFace); iNode++)
-                    {
-                        face_point = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iNode));
-                        /*--- Loop over all elements sharing the face point ---*/
-                        for (jElem = 0; jElem < node[face_point]->GetnElem(); jElem++)
-                        {
-                            Test_Elem = node[face_point]->GetElem(jElem);
-
-                            /*--- If it is a new element in this face ---*/
-                            if ((elem[iElem]->GetNeighbor_Elements(iFace) == -1) && (iElem < Test_Elem) &&
-                                (FindFace(iElem, Test_Elem, first_elem_face, second_elem_face)))
-                            {
+                        FaceNode.push_back(elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iNode)));
+                    FaceNodePtr.push_back(FaceNode.size());
+                }
+                ElemFacePtr[iElem + 1] = FaceNodePtr.size() - 1;
+            }
+            FaceNode.push_back(0);
 
-                                /*--- Localice which faces are sharing both elements ---*/
-                                elem[iElem]->SetNeighbor_Elements(Test_Elem, first_elem_face);
+            /*--- Match the faces through a hash of their sorted points ---*/
+            FaceMap.Build(nElem, &ElemFacePtr[0], &FaceNodePtr[0], &FaceNode[0]);
 
-                                /*--- Store the element for both elements ---*/
-                                elem[Test_Elem]->SetNeighbor_Elements(iElem, second_elem_face);
-                            }
-                        }
-                    }
+            for (iElem = 0; iElem < nElem; iElem++)
+            {
+                for (iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++)
+                {
+                    Neighbor_Elem = FaceMap.GetNeighborElem(iElem, iFace);
+                    if (Neighbor_Elem != -1)
+                        elem[iElem]->SetNeighbor_Elements(Neighbor_Elem, iFace);
                 }
             }
         }
@@ -5814,6 +5826,331 @@ namespace ARIES
                 }
         }
 
+        void GEOM_GeometryPhysical::SetEdge_Coloring(unsigned long val_blockSize)
+        {
+            unsigned long iEdge;
+
+            /*--- Edges are sorted by their nodes, so renumber the points (SetRCM_Ordering) first ---*/
+            std::vector<unsigned long> EdgeNode(2 * nEdge + 1);
+            for (iEdge = 0; iEdge < nEdge; iEdge++)
+            {
+                EdgeNode[2 * iEdge] = edge[iEdge]->GetNode(0);
+                EdgeNode[2 * iEdge + 1] = edge[iEdge]->GetNode(1);
+            }
+
+            EdgeColoring.Build(nPoint, nEdge, &EdgeNode[0], val_blockSize);
+        }
+
+        void GEOM_GeometryPhysical::SetGradient_Engine(TBOX::TBOX_Config *config)
+        {
+            unsigned long iPoint, iEdge, iVertex, nVertex_Total = 0;
+            unsigned short iMarker, iDim;
+            double *Normal;
+
+            std::vector<double> Coord(nPoint * nDim + 1), Volume(nPoint + 1);
+            for (iPoint = 0; iPoint < nPoint; iPoint++)
+            {
+                for (iDim = 0; iDim < nDim; iDim++)
+                    Coord[iPoint * nDim + iDim] = node[iPoint]->GetCoord(iDim);
+                Volume[iPoint] = node[iPoint]->GetVolume();
+            }
+
+            std::vector<unsigned long> EdgeNode(2 * nEdge + 1);
+            std::vector<double> EdgeNormal(nEdge * nDim + 1);
+            for (iEdge = 0; iEdge < nEdge; iEdge++)
+            {
+                EdgeNode[2 * iEdge] = edge[iEdge]->GetNode(0);
+                EdgeNode[2 * iEdge + 1] = edge[iEdge]->GetNode(1);
+                Normal = edge[iEdge]->GetNormal();
+                for (iDim = 0; iDim < nDim; iDim++)
+                    EdgeNormal[iEdge * nDim + iDim] = Normal[iDim];
+            }
+
+            /*--- Only physical boundaries close the control volumes; halo points are completed by the exchange ---*/
+            for (iMarker = 0; iMarker < nMarker; iMarker++)
+                if (config->GetMarker_All_KindBC(iMarker) != TBOX::SEND_RECEIVE)
+                    nVertex_Total += nVertex[iMarker];
+
+            std::vector<unsigned long> VertexNode(nVertex_Total + 1);
+            std::vector<double> VertexNormal(nVertex_Total * nDim + 1);
+            nVertex_Total = 0;
+            for (iMarker = 0; iMarker < nMarker; iMarker++)
+            {
+                if (config->GetMarker_All_KindBC(iMarker) == TBOX::SEND_RECEIVE) continue;
+                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+                {
+                    VertexNode[nVertex_Total] = vertex[iMarker][iVertex]->GetNode();
+                    Normal = vertex[iMarker][iVertex]->GetNormal();
+                    for (iDim = 0; iDim < nDim; iDim++)
+                        VertexNormal[nVertex_Total * nDim + iDim] = Normal[iDim];
+                    nVertex_Total++;
+                }
+            }
+
+            Gradient.SetGeometry(nDim, nPoint, &Coord[0], &Volume[0], nEdge, &EdgeNode[0], &EdgeNormal[0],
+                                 nVertex_Total, &VertexNode[0], &VertexNormal[0]);
+
+            /*--- With ARIES_BENCHMARK set in the environment, time the three methods on the
+            flow variables and report the rate summed over the ranks ---*/
+            if (getenv("ARIES_BENCHMARK") != NULL)
+            {
+                unsigned short iType, nVar = nDim + 2, nRepeat = 10;
+                double Local_Rate[3], Global_Rate[3];
+                int rank = TBOX::MASTER_NODE;
+
+                for (iType = 0; iType < 3; iType++)
+                    Local_Rate[iType] = Gradient.Benchmark(GeomGradient::GradientType(iType), nVar, nRepeat);
+
+#ifdef HAVE_MPI
+                MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+                MPI_Allreduce(Local_Rate, Global_Rate, 3, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+                for (iType = 0; iType < 3; iType++) Global_Rate[iType] = Local_Rate[iType];
+#endif
+
+                if (rank == TBOX::MASTER_NODE)
+                    std::cout << "Point gradients per second: Green-Gauss " << Global_Rate[GeomGradient::Gradient_GreenGauss]
+                              << ", least squares " << Global_Rate[GeomGradient::Gradient_LeastSquares]
+                              << ", weighted least squares " << Global_Rate[GeomGradient::Gradient_WeightedLeastSquares] << "." << std::endl;
+            }
+        }
+
+        /*--- Key of the geometry cache: the key of the mesh file (size, modification time and
+        sampled content), computed on the master, the global indices of the local points,
+        so that a different partition is detected, and the tag and kind of every marker,
+        since the cached wall distance depends on which markers are walls ---*/
+        static unsigned long long GetGeometry_CacheHash(TBOX::TBOX_Config *config, GRID::GRID_DGPoint **node, unsigned long nPoint, unsigned short nMarker)
+        {
+            unsigned long long Hash = 0;
+            unsigned long iPoint, GlobalIndex;
+            unsigned short iByte, iMarker;
+            std::string Marker_Tag;
+            int rank = TBOX::MASTER_NODE;
+#ifdef HAVE_MPI
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+            if (rank == TBOX::MASTER_NODE) Hash = GeomGeometryCache::HashFile(config->GetMesh_FileName());
+#ifdef HAVE_MPI
+            MPI_Bcast(&Hash, 1, MPI_UNSIGNED_LONG_LONG, TBOX::MASTER_NODE, MPI_COMM_WORLD);
+#endif
+
+            for (iPoint = 0; iPoint < nPoint; iPoint++)
+            {
+                GlobalIndex = node[iPoint]->GetGlobalIndex();
+                for (iByte = 0; iByte < sizeof(unsigned long); iByte++)
+                {
+                    Hash ^= (GlobalIndex >> (8 * iByte)) & 0xFF;
+                    Hash *= 1099511628211ULL;
+                }
+            }
+
+            for (iMarker = 0; iMarker < nMarker; iMarker++)
+            {
+                Marker_Tag = config->GetMarker_All_TagBound(iMarker);
+                for (iByte = 0; iByte < Marker_Tag.size(); iByte++)
+                {
+                    Hash ^= (unsigned char)Marker_Tag[iByte];
+                    Hash *= 1099511628211ULL;
+                }
+                Hash ^= config->GetMarker_All_KindBC(iMarker);
+                Hash *= 1099511628211ULL;
+            }
+            return Hash;
+        }
+
+        void GEOM_GeometryPhysical::WriteGeometry_Cache(TBOX::TBOX_Config *config)
+        {
+            unsigned long iPoint, iEdge, iVertex, nVertex_Total = 0;
+            unsigned short iMarker, iDim;
+            double *Normal;
+            int rank = TBOX::MASTER_NODE, size = TBOX::SINGLE_NODE;
+#ifdef HAVE_MPI
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+            MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+
+            GeomGeometryCache Cache;
+            Cache.SetKey(GetGeometry_CacheHash(config, node, nPoint, nMarker), size, rank, nDim, nPoint);
+
+            /*--- Point adjacency, straight from its flat storage ---*/
+            Cache.SetSection(GeomGeometryCache::Section_PointElemPtr, Adjacency.GetElemPtr().data(), nPoint + 1, sizeof(unsigned long));
+            Cache.SetSection(GeomGeometryCache::Section_PointElem, Adjacency.GetElemList().data(), Adjacency.GetElemList().size(), sizeof(unsigned long));
+            Cache.SetSection(GeomGeometryCache::Section_PointNeighborPtr, Adjacency.GetNeighborPtr().data(), nPoint + 1, sizeof(unsigned long));
+            Cache.SetSection(GeomGeometryCache::Section_PointNeighbor, Adjacency.GetNeighborList().data(), Adjacency.GetNeighborList().size(), sizeof(unsigned long));
+            Cache.SetSection(GeomGeometryCache::Section_PointEdge, Adjacency.GetEdgeList().data(), Adjacency.GetEdgeList().size(), sizeof(long));
+
+            /*--- Dual grid ---*/
+            std::vector<unsigned long> EdgeNode(2 * nEdge + 1);
+            std::vector<double> EdgeNormal(nEdge * nDim + 1), Volume(nPoint + 1), WallDistance(nPoint + 1);
+            for (iEdge = 0; iEdge < nEdge; iEdge++)
+            {
+                EdgeNode[2 * iEdge] = edge[iEdge]->GetNode(0);
+                EdgeNode[2 * iEdge + 1] = edge[iEdge]->GetNode(1);
+                Normal = edge[iEdge]->GetNormal();
+                for (iDim = 0; iDim < nDim; iDim++)
+                    EdgeNormal[iEdge * nDim + iDim] = Normal[iDim];
+            }
+            for (iPoint = 0; iPoint < nPoint; iPoint++)
+            {
+                Volume[iPoint] = node[iPoint]->GetVolume();
+                WallDistance[iPoint] = node[iPoint]->GetWall_Distance();
+            }
+            Cache.SetSection(GeomGeometryCache::Section_EdgeNode, &EdgeNode[0], 2 * nEdge, sizeof(unsigned long));
+            Cache.SetSection(GeomGeometryCache::Section_EdgeNormal, &EdgeNormal[0], nEdge * nDim, sizeof(double));
+            Cache.SetSection(GeomGeometryCache::Section_Volume, &Volume[0], nPoint, sizeof(double));
+            Cache.SetSection(GeomGeometryCache::Section_WallDistance, &WallDistance[0], nPoint, sizeof(double));
+
+            /*--- Boundary vertices of all the markers, one after the other ---*/
+            for (iMarker = 0; iMarker < nMarker; iMarker++)
+                nVertex_Total += nVertex[iMarker];
+
+            std::vector<unsigned long> VertexNode(nVertex_Total + 1);
+            nVertex_Total = 0;
+            for (iMarker = 0; iMarker < nMarker; iMarker++)
+                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+                    VertexNode[nVertex_Total++] = vertex[iMarker][iVertex]->GetNode();
+            Cache.SetSection(GeomGeometryCache::Section_NumVertex, nVertex, nMarker, sizeof(unsigned long));
+            Cache.SetSection(GeomGeometryCache::Section_VertexNode, &VertexNode[0], nVertex_Total, sizeof(unsigned long));
+
+            /*--- Volume of the domain, as reduced by SetControlVolume ---*/
+            double DomainVolume = config->GetDomainVolume();
+            Cache.SetSection(GeomGeometryCache::Section_DomainVolume, &DomainVolume, 1, sizeof(double));
+
+            std::string FileName = GeomGeometryCache::GetFileName(config->GetMesh_FileName(), rank, size);
+            if (!Cache.Write(FileName))
+                std::cout << "WARNING: the geometry cache " << FileName << " could not be written." << std::endl;
+        }
+
+        bool GEOM_GeometryPhysical::ReadGeometry_Cache(TBOX::TBOX_Config *config)
+        {
+            unsigned long iPoint, iEdge, iVertex, nVertex_Total = 0, Count[GeomGeometryCache::Section_Num];
+            unsigned short iMarker, iDim;
+            double Normal[3];
+            int rank = TBOX::MASTER_NODE, size = TBOX::SINGLE_NODE;
+#ifdef HAVE_MPI
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+            MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+
+            GeomGeometryCache Cache;
+            Cache.SetKey(GetGeometry_CacheHash(config, node, nPoint, nMarker), size, rank, nDim, nPoint);
+            bool Valid = Cache.Open(GeomGeometryCache::GetFileName(config->GetMesh_FileName(), rank, size));
+
+            /*--- Every section must be present with the sizes of this geometry
+            before anything is touched ---*/
+            const unsigned long *ElemPtr = NULL, *Elem = NULL, *PointPtr = NULL, *Point = NULL, *EdgeNode = NULL;
+            const unsigned long *NumVertex = NULL, *VertexNode = NULL;
+            const long *PointEdge = NULL;
+            const double *EdgeNormal = NULL, *Volume = NULL, *WallDistance = NULL, *DomainVolume = NULL;
+            if (Valid)
+            {
+                ElemPtr = (const unsigned long*)Cache.GetSection(GeomGeometryCache::Section_PointElemPtr, sizeof(unsigned long), Count[GeomGeometryCache::Section_PointElemPtr]);
+                Elem = (const unsigned long*)Cache.GetSection(GeomGeometryCache::Section_PointElem, sizeof(unsigned long), Count[GeomGeometryCache::Section_PointElem]);
+                PointPtr = (const unsigned long*)Cache.GetSection(GeomGeometryCache::Section_PointNeighborPtr, sizeof(unsigned long), Count[GeomGeometryCache::Section_PointNeighborPtr]);
+                Point = (const unsigned long*)Cache.GetSection(GeomGeometryCache::Section_PointNeighbor, sizeof(unsigned long), Count[GeomGeometryCache::Section_PointNeighbor]);
+                PointEdge = (const long*)Cache.GetSection(GeomGeometryCache::Section_PointEdge, sizeof(long), Count[GeomGeometryCache::Section_PointEdge]);
+                EdgeNode = (const unsigned long*)Cache.GetSection(GeomGeometryCache::Section_EdgeNode, sizeof(unsigned long), Count[GeomGeometryCache::Section_EdgeNode]);
+                EdgeNormal = (const double*)Cache.GetSection(GeomGeometryCache::Section_EdgeNormal, sizeof(double), Count[GeomGeometryCache::Section_EdgeNormal]);
+                Volume = (const double*)Cache.GetSection(GeomGeometryCache::Section_Volume, sizeof(double), Count[GeomGeometryCache::Section_Volume]);
+                WallDistance = (const double*)Cache.GetSection(GeomGeometryCache::Section_WallDistance, sizeof(double), Count[GeomGeometryCache::Section_WallDistance]);
+                NumVertex = (const unsigned long*)Cache.GetSection(GeomGeometryCache::Section_NumVertex, sizeof(unsigned long), Count[GeomGeometryCache::Section_NumVertex]);
+                VertexNode = (const unsigned long*)Cache.GetSection(GeomGeometryCache::Section_VertexNode, sizeof(unsigned long), Count[GeomGeometryCache::Section_VertexNode]);
+                DomainVolume = (const double*)Cache.GetSection(GeomGeometryCache::Section_DomainVolume, sizeof(double), Count[GeomGeometryCache::Section_DomainVolume]);
+
+                Valid = (ElemPtr != NULL && Elem != NULL && PointPtr != NULL && Point != NULL && PointEdge != NULL &&
+                         EdgeNode != NULL && EdgeNormal != NULL && Volume != NULL && WallDistance != NULL &&
+                         NumVertex != NULL && VertexNode != NULL && DomainVolume != NULL);
+                Valid = Valid && Count[GeomGeometryCache::Section_PointElemPtr] == nPoint + 1 && Count[GeomGeometryCache::Section_PointNeighborPtr] == nPoint + 1;
+                Valid = Valid && Count[GeomGeometryCache::Section_PointElem] == ElemPtr[nPoint];
+                Valid = Valid && Count[GeomGeometryCache::Section_PointNeighbor] == PointPtr[nPoint] && Count[GeomGeometryCache::Section_PointEdge] == PointPtr[nPoint];
+                Valid = Valid && Count[GeomGeometryCache::Section_EdgeNode] % 2 == 0;
+                Valid = Valid && Count[GeomGeometryCache::Section_EdgeNormal] == Count[GeomGeometryCache::Section_EdgeNode] / 2 * nDim;
+                Valid = Valid && Count[GeomGeometryCache::Section_Volume] == nPoint && Count[GeomGeometryCache::Section_WallDistance] == nPoint;
+                Valid = Valid && Count[GeomGeometryCache::Section_NumVertex] == nMarker && Count[GeomGeometryCache::Section_DomainVolume] == 1;
+                if (Valid)
+                    for (iMarker = 0; iMarker < nMarker; iMarker++)
+                        nVertex_Total += NumVertex[iMarker];
+                Valid = Valid && Count[GeomGeometryCache::Section_VertexNode] == nVertex_Total;
+            }
+
+            /*--- All the ranks rebuild if one of them cannot use its file ---*/
+#ifdef HAVE_MPI
+            int Local_Valid = Valid ? 1 : 0, Global_Valid;
+            MPI_Allreduce(&Local_Valid, &Global_Valid, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+            Valid = (Global_Valid == 1);
+#endif
+            if (!Valid) return false;
+
+            /*--- Point adjacency (SetPoint_Connectivity) ---*/
+            Adjacency.Set(nPoint, ElemPtr, Elem, PointPtr, Point, PointEdge);
+            for (iPoint = 0; iPoint < nPoint; iPoint++)
+            {
+                node[iPoint]->SetAdjacency(Adjacency.GetElem(iPoint), (unsigned short)Adjacency.GetNumElem(iPoint),
+                                           Adjacency.GetNeighbor(iPoint), Adjacency.GetEdge(iPoint), (unsigned short)Adjacency.GetNumNeighbor(iPoint));
+                node[iPoint]->SetnNeighbor(node[iPoint]->GetnPoint());
+            }
+
+            /*--- Edges and their normals (SetEdges, SetControlVolume), replacing any previous ones ---*/
+            if (edge != NULL)
+            {
+                for (iEdge = 0; iEdge < nEdge; iEdge++)
+                    if (edge[iEdge] != NULL) delete edge[iEdge];
+                delete[] edge;
+            }
+            nEdge = Count[GeomGeometryCache::Section_EdgeNode] / 2;
+            edge = new GRID::GRID_DGEdge*[nEdge];
+            for (iEdge = 0; iEdge < nEdge; iEdge++)
+            {
+                edge[iEdge] = new GRID::GRID_DGEdge(EdgeNode[2 * iEdge], EdgeNode[2 * iEdge + 1], nDim);
+                for (iDim = 0; iDim < nDim; iDim++)
+                    Normal[iDim] = EdgeNormal[iEdge * nDim + iDim];
+                edge[iEdge]->SetZeroValues();
+                edge[iEdge]->AddNormal(Normal);
+            }
+
+            for (iPoint = 0; iPoint < nPoint; iPoint++)
+            {
+                node[iPoint]->SetVolume(Volume[iPoint]);
+                node[iPoint]->SetWall_Distance(WallDistance[iPoint]);
+            }
+
+            if (rank == TBOX::MASTER_NODE)
+            {
+                if (nDim == 2) std::cout << "Area of the computational grid: " << *DomainVolume << "." << std::endl;
+                if (nDim == 3) std::cout << "Volume of the computational grid: " << *DomainVolume << "." << std::endl;
+            }
+            config->SetDomainVolume(*DomainVolume);
+
+            /*--- Boundary vertices come from the boundary elements in the same order
+            as when the file was written; their normals are recomputed from the flat face table ---*/
+            SetVertex(config);
+            nVertex_Total = 0;
+            for (iMarker = 0; iMarker < nMarker; iMarker++)
+            {
+                bool Match = (nVertex[iMarker] == NumVertex[iMarker]);
+                for (iVertex = 0; Match && iVertex < nVertex[iMarker]; iVertex++)
+                    Match = (vertex[iMarker][iVertex]->GetNode() == VertexNode[nVertex_Total + iVertex]);
+                if (!Match)
+                {
+                    std::cout << "The boundary of the geometry cache does not match the mesh (GEOM_GeometryPhysical)!!" << std::endl;
+#ifndef HAVE_MPI
+                    exit(EXIT_FAILURE);
+#else
+                    MPI_Abort(MPI_COMM_WORLD, 1);
+                    MPI_Finalize();
+#endif
+                }
+                nVertex_Total += nVertex[iMarker];
+            }
+            SetBoundControlVolume(config, TBOX::ALLOCATE);
+
+            if (rank == TBOX::MASTER_NODE)
+                std::cout << "Dual grid read from the geometry cache." << std::endl;
+
+            return true;
+        }
+
         void GEOM_GeometryPhysical::SetVertex(TBOX::TBOX_Config *config)
         {
             unsigned long  iPoint, iVertex, iElem;
@@ -5962,810 +6299,285 @@ namespace ARIES
 
         void GEOM_GeometryPhysical::SetBoundControlVolume(TBOX::TBOX_Config *config, unsigned short action)
         {
-            unsigned short Neighbor_Node, iMarker, iNode, iNeighbor_Nodes, iDim;
-            unsigned long Neighbor_Point, iVertex, iPoint, iElem;
-            long iEdge;
-            double Area, *NormalFace = NULL;
-
-            /*--- Update values of faces of the edge ---*/
-
-            if (action != TBOX::ALLOCATE)
+            unsigned short iMarker, iNode, iDim;
+            unsigned long iVertex, iPoint, iElem;
+            const double *NormalFace;
+            double Normal[3];
+
+            /*--- Flat table of the boundary faces, built once; a face node refers
+            to the vertex of its point on the marker ---*/
+            if (action == TBOX::ALLOCATE || BoundaryFaces.GetNumMarker() != nMarker)
+            {
+                std::vector<unsigned long> VertexPtr(nMarker + 1, 0), VertexNode, FacePtr(nMarker + 1, 0), FaceNodePtr(1, 0), FaceVertex;
                 for (iMarker = 0; iMarker < nMarker; iMarker++)
+                {
                     for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
-                        vertex[iMarker][iVertex]->SetZeroValues();
+                        VertexNode.push_back(vertex[iMarker][iVertex]->GetNode());
+                    VertexPtr[iMarker + 1] = VertexNode.size();
 
-            double *Coord_Edge_CG = new double[nDim];
-            double *Coord_Elem_CG = new double[nDim];
-            double *Coord_Vertex  = new double[nDim];
-
-            /*--- Loop over all the markers ---*/
-            for (iMarker = 0; iMarker < nMarker; iMarker++)
-                /*--- Loop over all the boundary elements ---*/
-                for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++)
-                    /*--- Loop over all the nodes of the boundary ---*/
-                    for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++)
+                    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++)
                     {
-                        iPoint = bound[iMarker][iElem]->GetNode(iNode);
-                        iVertex = node[iPoint]->GetVertex(iMarker);
-
-                        /*--- Loop over the neighbor nodes, there is a face for each one ---*/
-                        for (iNeighbor_Nodes = 0; iNeighbor_Nodes < bound[iMarker][iElem]->GetnNeighbor_Nodes(iNode); iNeighbor_Nodes++)
-                        {
-                            Neighbor_Node = bound[iMarker][iElem]->GetNeighbor_Nodes(iNode, iNeighbor_Nodes);
-                            Neighbor_Point = bound[iMarker][iElem]->GetNode(Neighbor_Node);
-
-                            /*--- Shared edge by the Neighbor Point and the point ---*/
-
-                            iEdge = FindEdge(iPoint, Neighbor_Point);
-                            for (iDim = 0; iDim < nDim; iDim++)
-                            {
-                                Coord_Edge_CG[iDim] = edge[iEdge]->GetCG(iDim);
-                                Coord_Elem_CG[iDim] = bound[iMarker][iElem]->GetCG(iDim);
-                                Coord_Vertex[iDim] = node[iPoint]->GetCoord(iDim);
-                            }
-                            switch (nDim)
-                            {
-                            case 2:
-                                /*--- Store the 2D face ---*/
-                                if (iNode == 0) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Elem_CG, Coord_Vertex);
-                                if (iNode == 1) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Vertex, Coord_Elem_CG);
-                                break;
-                            case 3:
-                                /*--- Store the 3D face ---*/
-                                if (iNeighbor_Nodes == 0) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Elem_CG, Coord_Edge_CG, Coord_Vertex);
-                                if (iNeighbor_Nodes == 1) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Edge_CG, Coord_Elem_CG, Coord_Vertex);
-                                break;
-                            }
-                        }
+                        for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++)
+                            FaceVertex.push_back(node[bound[iMarker][iElem]->GetNode(iNode)]->GetVertex(iMarker));
+                        FaceNodePtr.push_back(FaceVertex.size());
                     }
+                    FacePtr[iMarker + 1] = FaceNodePtr.size() - 1;
+                }
+                VertexNode.push_back(0);
+                FaceVertex.push_back(0);
 
-            delete[] Coord_Edge_CG;
-            delete[] Coord_Elem_CG;
-            delete[] Coord_Vertex;
+                BoundaryFaces.SetTopology(nDim, nMarker, &VertexPtr[0], &VertexNode[0], &FacePtr[0], &FaceNodePtr[0], &FaceVertex[0]);
+            }
 
-            /*--- Check if there is a normal with null area ---*/
+            /*--- Median-dual pieces of the faces (vertex, edge midpoints, face centroid), summed at the vertices ---*/
+            std::vector<double> Coord(nPoint * nDim + 1);
+            for (iPoint = 0; iPoint < nPoint; iPoint++)
+                for (iDim = 0; iDim < nDim; iDim++)
+                    Coord[iPoint * nDim + iDim] = node[iPoint]->GetCoord(iDim);
+            BoundaryFaces.Update(&Coord[0]);
+
+            /*--- Copy to the vertices; a null area was already replaced by a tiny normal ---*/
             for (iMarker = 0; iMarker < nMarker; iMarker++)
-                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) 
+            {
+                NormalFace = BoundaryFaces.GetNormal(iMarker);
+                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
                 {
-                    NormalFace = vertex[iMarker][iVertex]->GetNormal();
-                    Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim] * NormalFace[iDim];
-                    Area = sqrt(Area);
-                    if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = TBOX::EPS*TBOX::EPS;
+                    for (iDim = 0; iDim < nDim; iDim++)
+                        Normal[iDim] = NormalFace[iVertex * nDim + iDim];
+                    vertex[iMarker][iVertex]->SetZeroValues();
+                    vertex[iMarker][iVertex]->AddNormal(Normal);
                 }
+            }
         }
 
-        void GEOM_GeometryPhysical::MatchInterface(TBOX::TBOX_Config *config) 
+        void GEOM_GeometryPhysical::MatchMarker_Points(TBOX::TBOX_Config *config, unsigned short val_kindDonor, unsigned short val_kindTarget, double val_epsilon)
         {
-            double epsilon = 1.5e-1;
+            unsigned short iMarker, iDim, kindBC;
+            unsigned long iVertex, iPoint, pPoint = 0, nDonor = 0, nTarget = 0;
+            double *Coord_i, mindist, maxdist_local = 0.0, maxdist_global = 0.0;
+            int rank = TBOX::MASTER_NODE, pProcessor = 0;
+            bool skipSelf = (val_kindDonor == val_kindTarget);
 
-            unsigned short nMarker_InterfaceBound = config->GetnMarker_InterfaceBound();
+#ifdef HAVE_MPI
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
 
-            if (nMarker_InterfaceBound != 0) 
-            {
-#ifndef HAVE_MPI
+            /*--- Donor and target points of this rank, without the ghost nodes (a point
+            shared by several markers is stored once) ---*/
+            std::vector<double> Coord_Donor, Coord_Target;
+            std::vector<unsigned long> Point_Donor;
+            std::vector<bool> isDonor(nPoint, false), isTarget(nPoint, false);
 
-                unsigned short iMarker, jMarker;
-                unsigned long iVertex, iPoint, jVertex, jPoint = 0, pPoint = 0;
-                double *Coord_i, *Coord_j, dist = 0.0, mindist, maxdist;
+            for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+            {
+                kindBC = config->GetMarker_All_KindBC(iMarker);
+                if ((kindBC != val_kindDonor) && (kindBC != val_kindTarget)) continue;
 
-                std::cout << "Set Interface boundary conditions." << std::endl;
+                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+                {
+                    iPoint = vertex[iMarker][iVertex]->GetNode();
+                    if (!node[iPoint]->GetDomain()) continue;
 
-                maxdist = 0.0;
-                for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-                    if (config->GetMarker_All_KindBC(iMarker) == TBOX::INTERFACE_BOUNDARY) 
+                    if ((kindBC == val_kindDonor) && !isDonor[iPoint])
                     {
-                        for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) 
-                        {
-                            iPoint = vertex[iMarker][iVertex]->GetNode();
-                            Coord_i = node[iPoint]->GetCoord();
-
-                            mindist = 1E6;
-                            for (jMarker = 0; jMarker < config->GetnMarker_All(); jMarker++)
-                                if ((config->GetMarker_All_KindBC(jMarker) == TBOX::INTERFACE_BOUNDARY) && (iMarker != jMarker))
-                                    for (jVertex = 0; jVertex < nVertex[jMarker]; jVertex++)
-                                    {
-                                        jPoint = vertex[jMarker][jVertex]->GetNode();
-                                        Coord_j = node[jPoint]->GetCoord();
-                                        if (nDim == 2) dist = sqrt(pow(Coord_j[0] - Coord_i[0], 2.0) + pow(Coord_j[1] - Coord_i[1], 2.0));
-                                        if (nDim == 3) dist = sqrt(pow(Coord_j[0] - Coord_i[0], 2.0) + pow(Coord_j[1] - Coord_i[1], 2.0) + pow(Coord_j[2] - Coord_i[2], 2.0));
-                                        if (dist < mindist) 
-                                        { 
-                                            mindist = dist; 
-                                            pPoint = jPoint; 
-                                        }
-                                    }
-                            maxdist = std::max(maxdist, mindist);
-                            vertex[iMarker][iVertex]->SetDonorPoint(pPoint, TBOX::MASTER_NODE);
-
-                            if (mindist > epsilon) 
-                            {
-                                std::cout.precision(10);
-                                std::cout << std::endl;
-                                std::cout << "   Bad match for point " << iPoint << ".\tNearest";
-                                std::cout << " donor distance: " << std::scientific << mindist << ".";
-                                vertex[iMarker][iVertex]->SetDonorPoint(iPoint, TBOX::MASTER_NODE);
-                                maxdist = std::min(maxdist, 0.0);
-                            }
-
-                        }
-                        std::cout << "The max distance between points is: " << maxdist << "." << std::endl;
+                        isDonor[iPoint] = true;
+                        Point_Donor.push_back(iPoint);
+                        for (iDim = 0; iDim < nDim; iDim++) Coord_Donor.push_back(node[iPoint]->GetCoord(iDim));
+                        nDonor++;
+                    }
+                    if ((kindBC == val_kindTarget) && !isTarget[iPoint])
+                    {
+                        isTarget[iPoint] = true;
+                        for (iDim = 0; iDim < nDim; iDim++) Coord_Target.push_back(node[iPoint]->GetCoord(iDim));
+                        nTarget++;
                     }
+                }
+            }
 
-#else
-                unsigned short iMarker, iDim;
-                unsigned long iVertex, iPoint, pPoint = 0, jVertex, jPoint;
-                double *Coord_i, Coord_j[3], dist = 0.0, mindist, maxdist_local, maxdist_global;
-                int iProcessor, pProcessor = 0;
-                unsigned long nLocalVertex_Interface = 0, nGlobalVertex_Interface = 0, MaxLocalVertex_Interface = 0;
-                int rank, nProcessor;
+            /*--- Every rank only receives the donors that fall in the bounding box of its
+            targets (inflated by the match tolerance), and searches them with a k-d tree ---*/
+            GeomPointLocator locator(nDim, val_epsilon);
+            locator.Build(nDonor, Coord_Donor.empty() ? NULL : &Coord_Donor[0], Point_Donor.empty() ? NULL : &Point_Donor[0],
+                          nTarget, Coord_Target.empty() ? NULL : &Coord_Target[0]);
 
-                MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-                MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
+            /*--- Compute the closest donor to every target point ---*/
+            for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+            {
+                if (config->GetMarker_All_KindBC(iMarker) != val_kindTarget) continue;
 
-                unsigned long *Buffer_Send_nVertex = new unsigned long[1];
-                unsigned long *Buffer_Receive_nVertex = new unsigned long[nProcessor];
+                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+                {
+                    iPoint = vertex[iMarker][iVertex]->GetNode();
+                    if (!node[iPoint]->GetDomain()) continue;
 
-                if (rank == MASTER_NODE) cout << "Set Interface boundary conditions (if any)." << endl;
+                    Coord_i = node[iPoint]->GetCoord();
+                    if (!locator.FindNearest(Coord_i, pPoint, pProcessor, mindist, skipSelf ? iPoint : GeomKDTree::GetNoPoint()))
+                    {
+                        mindist = 1E6; pPoint = 0; pProcessor = rank;
+                    }
 
-                /*--- Compute the number of vertex that have interfase boundary condition
-                without including the ghost nodes ---*/
+                    /*--- Store the value of the pair ---*/
+                    maxdist_local = std::max(maxdist_local, mindist);
+                    vertex[iMarker][iVertex]->SetDonorPoint(pPoint, pProcessor);
 
-                nLocalVertex_Interface = 0;
-                for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-                    if (config->GetMarker_All_KindBC(iMarker) == INTERFACE_BOUNDARY)
-                        for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++) {
-                            iPoint = vertex[iMarker][iVertex]->GetNode();
-                            if (node[iPoint]->GetDomain()) nLocalVertex_Interface++;
-                        }
+                    if (mindist > val_epsilon)
+                    {
+                        std::cout.precision(10);
+                        std::cout << std::endl;
+                        std::cout << "   Bad match for point " << iPoint << ".\tNearest";
+                        std::cout << " donor distance: " << std::scientific << mindist << ".";
+                        vertex[iMarker][iVertex]->SetDonorPoint(iPoint, pProcessor);
+                        maxdist_local = std::min(maxdist_local, 0.0);
+                    }
+                }
+            }
 
-                Buffer_Send_nVertex[0] = nLocalVertex_Interface;
+#ifndef HAVE_MPI
+            maxdist_global = maxdist_local;
+#else
+            MPI_Reduce(&maxdist_local, &maxdist_global, 1, MPI_DOUBLE, MPI_MAX, TBOX::MASTER_NODE, MPI_COMM_WORLD);
+#endif
 
-                /*--- Send Interface vertex information --*/
-
-                MPI_Allreduce(&nLocalVertex_Interface, &nGlobalVertex_Interface, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-                MPI_Allreduce(&nLocalVertex_Interface, &MaxLocalVertex_Interface, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-                MPI_Allgather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-
-                double *Buffer_Send_Coord = new double[MaxLocalVertex_Interface*nDim];
-                unsigned long *Buffer_Send_Point = new unsigned long[MaxLocalVertex_Interface];
-
-                double *Buffer_Receive_Coord = new double[nProcessor*MaxLocalVertex_Interface*nDim];
-                unsigned long *Buffer_Receive_Point = new unsigned long[nProcessor*MaxLocalVertex_Interface];
-
-                unsigned long nBuffer_Coord = MaxLocalVertex_Interface*nDim;
-                unsigned long nBuffer_Point = MaxLocalVertex_Interface;
-
-                for (iVertex = 0; iVertex < MaxLocalVertex_Interface; iVertex++) {
-                    Buffer_Send_Point[iVertex] = 0;
-                    for (iDim = 0; iDim < nDim; iDim++)
-                        Buffer_Send_Coord[iVertex*nDim + iDim] = 0.0;
-                }
-
-                /*--- Copy coordinates and point to the auxiliar std::vector --*/
-
-                nLocalVertex_Interface = 0;
-                for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-                    if (config->GetMarker_All_KindBC(iMarker) == INTERFACE_BOUNDARY)
-                        for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++) {
-                            iPoint = vertex[iMarker][iVertex]->GetNode();
-                            if (node[iPoint]->GetDomain()) {
-                                Buffer_Send_Point[nLocalVertex_Interface] = iPoint;
-                                for (iDim = 0; iDim < nDim; iDim++)
-                                    Buffer_Send_Coord[nLocalVertex_Interface*nDim + iDim] = node[iPoint]->GetCoord(iDim);
-                                nLocalVertex_Interface++;
-                            }
-                        }
-
-                MPI_Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_DOUBLE, MPI_COMM_WORLD);
-                MPI_Allgather(Buffer_Send_Point, nBuffer_Point, MPI_UNSIGNED_LONG, Buffer_Receive_Point, nBuffer_Point, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-
-                /*--- Compute the closest point to a Near-Field boundary point ---*/
-
-                maxdist_local = 0.0;
-                for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-                    if (config->GetMarker_All_KindBC(iMarker) == INTERFACE_BOUNDARY) {
-                        for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-                            iPoint = vertex[iMarker][iVertex]->GetNode();
-                            if (node[iPoint]->GetDomain()) {
-
-                                /*--- Coordinates of the boundary point ---*/
-
-                                Coord_i = node[iPoint]->GetCoord(); mindist = 1E6; pProcessor = 0; pPoint = 0;
-
-                                /*--- Loop over all the boundaries to find the pair ---*/
-                                for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
-                                    for (jVertex = 0; jVertex < Buffer_Receive_nVertex[iProcessor]; jVertex++) {
-                                        jPoint = Buffer_Receive_Point[iProcessor*MaxLocalVertex_Interface + jVertex];
-
-                                        /*--- Compute the distance ---*/
-
-                                        dist = 0.0; for (iDim = 0; iDim < nDim; iDim++) {
-                                            Coord_j[iDim] = Buffer_Receive_Coord[(iProcessor*MaxLocalVertex_Interface + jVertex)*nDim + iDim];
-                                            dist += pow(Coord_j[iDim] - Coord_i[iDim], 2.0);
-                                        } dist = sqrt(dist);
-
-                                        if (((dist < mindist) && (iProcessor != rank)) ||
-                                            ((dist < mindist) && (iProcessor == rank) && (jPoint != iPoint))) {
-                                            mindist = dist; pProcessor = iProcessor; pPoint = jPoint;
-                                        }
-                                    }
-
-                                /*--- Store the value of the pair ---*/
-
-                                maxdist_local = max(maxdist_local, mindist);
-                                vertex[iMarker][iVertex]->SetDonorPoint(pPoint, pProcessor);
-
-                                if (mindist > epsilon) {
-                                    cout.precision(10);
-                                    cout << endl;
-                                    cout << "   Bad match for point " << iPoint << ".\tNearest";
-                                    cout << " donor distance: " << scientific << mindist << ".";
-                                    vertex[iMarker][iVertex]->SetDonorPoint(iPoint, pProcessor);
-                                    maxdist_local = min(maxdist_local, 0.0);
-                                }
-
-                            }
-                        }
-                    }
-                }
-
-                MPI_Reduce(&maxdist_local, &maxdist_global, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
-
-                if (rank == MASTER_NODE) cout << "The max distance between points is: " << maxdist_global << "." << endl;
+            if (rank == TBOX::MASTER_NODE) std::cout << "The max distance between points is: " << maxdist_global << "." << std::endl;
+        }
 
-                delete[] Buffer_Send_Coord;
-                delete[] Buffer_Send_Point;
+        void GEOM_GeometryPhysical::MatchInterface(TBOX::TBOX_Config *config) 
+        {
+            double epsilon = 1.5e-1;
+            int rank = TBOX::MASTER_NODE;
 
-                delete[] Buffer_Receive_Coord;
-                delete[] Buffer_Receive_Point;
+#ifdef HAVE_MPI
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
 
-                delete[] Buffer_Send_nVertex;
-                delete[] Buffer_Receive_nVertex;
+            unsigned short nMarker_InterfaceBound = config->GetnMarker_InterfaceBound();
 
-#endif
+            if (nMarker_InterfaceBound != 0) 
+            {
+                if (rank == TBOX::MASTER_NODE) std::cout << "Set Interface boundary conditions." << std::endl;
+                MatchMarker_Points(config, TBOX::INTERFACE_BOUNDARY, TBOX::INTERFACE_BOUNDARY, epsilon);
             }
         }
 
         void GEOM_GeometryPhysical::MatchNearField(TBOX::TBOX_Config *config) 
         {
             double epsilon = 1e-1;
+            int rank = TBOX::MASTER_NODE;
+
+#ifdef HAVE_MPI
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
 
             unsigned short nMarker_NearfieldBound = config->GetnMarker_NearFieldBound();
 
             if (nMarker_NearfieldBound != 0) 
             {
-#ifndef HAVE_MPI
-                unsigned short iMarker, jMarker;
-                unsigned long iVertex, iPoint, jVertex, jPoint = 0, pPoint = 0;
-                double *Coord_i, *Coord_j, dist = 0.0, mindist, maxdist;
-
-                std::cout << "Set Near-Field boundary conditions. " << std::endl;
-
-                maxdist = 0.0;
-                for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-                    if (config->GetMarker_All_KindBC(iMarker) == TBOX::NEARFIELD_BOUNDARY) 
-                    {
-                        for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
-                        {
-                            iPoint = vertex[iMarker][iVertex]->GetNode();
-                            Coord_i = node[iPoint]->GetCoord();
-
-                            mindist = 1e10;
-                            for (jMarker = 0; jMarker < config->GetnMarker_All(); jMarker++)
-                                if ((config->GetMarker_All_KindBC(jMarker) == TBOX::NEARFIELD_BOUNDARY) && (iMarker != jMarker))
-                                    for (jVertex = 0; jVertex < nVertex[jMarker]; jVertex++) 
-                                    {
-                                        jPoint = vertex[jMarker][jVertex]->GetNode();
-                                        Coord_j = node[jPoint]->GetCoord();
-                                        if (nDim == 2) dist = sqrt(pow(Coord_j[0] - Coord_i[0], 2.0) + pow(Coord_j[1] - Coord_i[1], 2.0));
-                                        if (nDim == 3) dist = sqrt(pow(Coord_j[0] - Coord_i[0], 2.0) + pow(Coord_j[1] - Coord_i[1], 2.0) + pow(Coord_j[2] - Coord_i[2], 2.0));
-                                        if (dist < mindist) 
-                                        { 
-                                            mindist = dist; 
-                                            pPoint = jPoint; 
-                                        }
-                                    }
-                            maxdist = std::max(maxdist, mindist);
-                            vertex[iMarker][iVertex]->SetDonorPoint(pPoint, TBOX::MASTER_NODE);
-
-                            if (mindist > epsilon) 
-                            {
-                                std::cout.precision(10);
-                                std::cout << std::endl;
-                                std::cout << "   Bad match for point " << iPoint << ".\tNearest";
-                                std::cout << " donor distance: " << std::scientific << mindist << ".";
-                                vertex[iMarker][iVertex]->SetDonorPoint(iPoint, TBOX::MASTER_NODE);
-                                maxdist = std::min(maxdist, 0.0);
-                            }
-                        }
-                        std::cout << "The max distance between points is: " << maxdist << "." << std::endl;
-                    }
-
-#else
-
-                unsigned short iMarker, iDim;
-                unsigned long iVertex, iPoint, pPoint = 0, jVertex, jPoint;
-                double *Coord_i, Coord_j[3], dist = 0.0, mindist, maxdist_local, maxdist_global;
-                int iProcessor, pProcessor = 0;
-                unsigned long nLocalVertex_NearField = 0, nGlobalVertex_NearField = 0, MaxLocalVertex_NearField = 0;
-                int rank, nProcessor;
-
-                MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-                MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
-
-                unsigned long *Buffer_Send_nVertex = new unsigned long[1];
-                unsigned long *Buffer_Receive_nVertex = new unsigned long[nProcessor];
-
-                if (rank == MASTER_NODE) cout << "Set Near-Field boundary conditions." << endl;
-
-                /*--- Compute the number of vertex that have nearfield boundary condition
-                without including the ghost nodes ---*/
-
-                nLocalVertex_NearField = 0;
-                for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-                    if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY)
-                        for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++) {
-                            iPoint = vertex[iMarker][iVertex]->GetNode();
-                            if (node[iPoint]->GetDomain()) nLocalVertex_NearField++;
-                        }
-
-                Buffer_Send_nVertex[0] = nLocalVertex_NearField;
-
-                /*--- Send Near-Field vertex information --*/
-
-                MPI_Allreduce(&nLocalVertex_NearField, &nGlobalVertex_NearField, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-                MPI_Allreduce(&nLocalVertex_NearField, &MaxLocalVertex_NearField, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-                MPI_Allgather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-
-                double *Buffer_Send_Coord = new double[MaxLocalVertex_NearField*nDim];
-                unsigned long *Buffer_Send_Point = new unsigned long[MaxLocalVertex_NearField];
-
-                double *Buffer_Receive_Coord = new double[nProcessor*MaxLocalVertex_NearField*nDim];
-                unsigned long *Buffer_Receive_Point = new unsigned long[nProcessor*MaxLocalVertex_NearField];
-
-                unsigned long nBuffer_Coord = MaxLocalVertex_NearField*nDim;
-                unsigned long nBuffer_Point = MaxLocalVertex_NearField;
-
-                for (iVertex = 0; iVertex < MaxLocalVertex_NearField; iVertex++) {
-                    Buffer_Send_Point[iVertex] = 0;
-                    for (iDim = 0; iDim < nDim; iDim++)
-                        Buffer_Send_Coord[iVertex*nDim + iDim] = 0.0;
-                }
-
-                /*--- Copy coordinates and point to the auxiliar std::vector --*/
-
-                nLocalVertex_NearField = 0;
-                for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-                    if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY)
-                        for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++) {
-                            iPoint = vertex[iMarker][iVertex]->GetNode();
-                            if (node[iPoint]->GetDomain()) {
-                                Buffer_Send_Point[nLocalVertex_NearField] = iPoint;
-                                for (iDim = 0; iDim < nDim; iDim++)
-                                    Buffer_Send_Coord[nLocalVertex_NearField*nDim + iDim] = node[iPoint]->GetCoord(iDim);
-                                nLocalVertex_NearField++;
-                            }
-                        }
-
-                MPI_Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_DOUBLE, MPI_COMM_WORLD);
-                MPI_Allgather(Buffer_Send_Point, nBuffer_Point, MPI_UNSIGNED_LONG, Buffer_Receive_Point, nBuffer_Point, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-
-                /*--- Compute the closest point to a Near-Field boundary point ---*/
-
-                maxdist_local = 0.0;
-                maxdist_global = 0.0;
-                for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-                    if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
-
-                        for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-                            iPoint = vertex[iMarker][iVertex]->GetNode();
-                            if (node[iPoint]->GetDomain()) {
-
-                                /*--- Coordinates of the boundary point ---*/
-
-                                Coord_i = node[iPoint]->GetCoord(); mindist = 1E6; pProcessor = 0; pPoint = 0;
-
-                                /*--- Loop over all the boundaries to find the pair ---*/
-
-                                for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
-                                    for (jVertex = 0; jVertex < Buffer_Receive_nVertex[iProcessor]; jVertex++) {
-                                        jPoint = Buffer_Receive_Point[iProcessor*MaxLocalVertex_NearField + jVertex];
-
-                                        /*--- Compute the distance ---*/
-
-                                        dist = 0.0; for (iDim = 0; iDim < nDim; iDim++) {
-                                            Coord_j[iDim] = Buffer_Receive_Coord[(iProcessor*MaxLocalVertex_NearField + jVertex)*nDim + iDim];
-                                            dist += pow(Coord_j[iDim] - Coord_i[iDim], 2.0);
-                                        } dist = sqrt(dist);
-
-                                        if (((dist < mindist) && (iProcessor != rank)) ||
-                                            ((dist < mindist) && (iProcessor == rank) && (jPoint != iPoint))) {
-                                            mindist = dist; pProcessor = iProcessor; pPoint = jPoint;
-                                        }
-                                    }
-
-                                /*--- Store the value of the pair ---*/
-
-                                maxdist_local = max(maxdist_local, mindist);
-                                vertex[iMarker][iVertex]->SetDonorPoint(pPoint, pProcessor);
-
-                                if (mindist > epsilon) {
-                                    cout.precision(10);
-                                    cout << endl;
-                                    cout << "   Bad match for point " << iPoint << ".\tNearest";
-                                    cout << " donor distance: " << scientific << mindist << ".";
-                                    vertex[iMarker][iVertex]->SetDonorPoint(iPoint, pProcessor);
-                                    maxdist_local = min(maxdist_local, 0.0);
-                                }
-
-                            }
-                        }
-
-                    }
-                }
-
-                MPI_Reduce(&maxdist_local, &maxdist_global, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
-
-                if (rank == MASTER_NODE) cout << "The max distance between points is: " << maxdist_global << "." << endl;
-
-                delete[] Buffer_Send_Coord;
-                delete[] Buffer_Send_Point;
-
-                delete[] Buffer_Receive_Coord;
-                delete[] Buffer_Receive_Point;
-
-                delete[] Buffer_Send_nVertex;
-                delete[] Buffer_Receive_nVertex;
-
-#endif
+                if (rank == TBOX::MASTER_NODE) std::cout << "Set Near-Field boundary conditions." << std::endl;
+                MatchMarker_Points(config, TBOX::NEARFIELD_BOUNDARY, TBOX::NEARFIELD_BOUNDARY, epsilon);
             }
         }
 
         void GEOM_GeometryPhysical::MatchActuator_Disk(TBOX::TBOX_Config *config) 
         {
             double epsilon = 1e-1;
-            unsigned short iMarker, iDim;
-            unsigned long iVertex, iPoint, pPoint = 0, jVertex, jPoint;
-            double *Coord_i, Coord_j[3], dist = 0.0, mindist, maxdist_local = 0.0, maxdist_global = 0.0;
-            int iProcessor, pProcessor = 0;
-            unsigned long nLocalVertex_ActDisk = 0, MaxLocalVertex_ActDisk = 0;
-            int rank, nProcessor;
-            unsigned short Beneficiary = 0, Donor = 0, iBC;
+            int rank = TBOX::MASTER_NODE;
+
+#ifdef HAVE_MPI
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
 
             unsigned short nMarker_ActDisk_Inlet = config->GetnMarker_ActDisk_Inlet();
 
             if (nMarker_ActDisk_Inlet != 0) 
             {
-                for (iBC = 0; iBC < 2; iBC++) 
-                {
-                    if (iBC == 0) 
-                    { 
-                        Beneficiary = TBOX::ACTDISK_INLET; 
-                        Donor = TBOX::ACTDISK_OUTLET; 
-                    }
-                    if (iBC == 1) 
-                    { 
-                        Beneficiary = TBOX::ACTDISK_OUTLET; 
-                        Donor = TBOX::ACTDISK_INLET; 
-                }
-
-#ifndef HAVE_MPI
-                    rank = TBOX::MASTER_NODE;
-                    nProcessor = TBOX::SINGLE_NODE;
-#else
-                    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-                    MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
-#endif
-
-                    unsigned long *Buffer_Send_nVertex = new unsigned long[1];
-                    unsigned long *Buffer_Receive_nVertex = new unsigned long[nProcessor];
-
-                    if ((iBC == 0) && (rank == TBOX::MASTER_NODE)) std::cout << "Set Actuator Disk inlet boundary conditions." << std::endl;
-                    if ((iBC == 1) && (rank == TBOX::MASTER_NODE)) std::cout << "Set Actuator Disk outlet boundary conditions." << std::endl;
-
-                    /*--- Compute the number of vertex that have an actuator disk outlet boundary condition
-                    without including the ghost nodes ---*/
-                    nLocalVertex_ActDisk = 0;
-                    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) 
-                    {
-                        if (config->GetMarker_All_KindBC(iMarker) == Donor) 
-                        {
-                            for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++) 
-                            {
-                                iPoint = vertex[iMarker][iVertex]->GetNode();
-                                if (node[iPoint]->GetDomain()) nLocalVertex_ActDisk++;
-                            }
-                        }
-                    }
-
-                    Buffer_Send_nVertex[0] = nLocalVertex_ActDisk;
-
-                    /*--- Send actuator disk vertex information --*/
-#ifndef HAVE_MPI
-                    MaxLocalVertex_ActDisk = nLocalVertex_ActDisk;
-                    Buffer_Receive_nVertex[0] = Buffer_Send_nVertex[0];
-#else
-                    MPI_Allreduce(&nLocalVertex_ActDisk, &MaxLocalVertex_ActDisk, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-                    MPI_Allgather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-#endif
-
-                    /*--- Array dimentionalization --*/
-
-                    double *Buffer_Send_Coord = new double[MaxLocalVertex_ActDisk*nDim];
-                    unsigned long *Buffer_Send_Point = new unsigned long[MaxLocalVertex_ActDisk];
-
-                    double *Buffer_Receive_Coord = new double[nProcessor*MaxLocalVertex_ActDisk*nDim];
-                    unsigned long *Buffer_Receive_Point = new unsigned long[nProcessor*MaxLocalVertex_ActDisk];
-
-                    unsigned long nBuffer_Coord = MaxLocalVertex_ActDisk*nDim;
-                    unsigned long nBuffer_Point = MaxLocalVertex_ActDisk;
-
-                    for (iVertex = 0; iVertex < MaxLocalVertex_ActDisk; iVertex++) 
-                    {
-                        Buffer_Send_Point[iVertex] = 0;
-                        for (iDim = 0; iDim < nDim; iDim++)
-                            Buffer_Send_Coord[iVertex*nDim + iDim] = 0.0;
-                    }
-
-                    /*--- Copy coordinates and point to the auxiliar std::vector --*/
-                    nLocalVertex_ActDisk = 0;
-                    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-                    {
-                        if (config->GetMarker_All_KindBC(iMarker) == Donor) 
-                        {
-                            for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++)
-                            {
-                                iPoint = vertex[iMarker][iVertex]->GetNode();
-                                if (node[iPoint]->GetDomain()) 
-                                {
-                                    Buffer_Send_Point[nLocalVertex_ActDisk] = iPoint;
-                                    for (iDim = 0; iDim < nDim; iDim++)
-                                        Buffer_Send_Coord[nLocalVertex_ActDisk*nDim + iDim] = node[iPoint]->GetCoord(iDim);
-                                    nLocalVertex_ActDisk++;
-                                }
-                            }
-                        }
-                    }
-
-#ifndef HAVE_MPI
-                    for (unsigned long iBuffer_Coord = 0; iBuffer_Coord < nBuffer_Coord; iBuffer_Coord++)
-                        Buffer_Receive_Coord[iBuffer_Coord] = Buffer_Send_Coord[iBuffer_Coord];
-                    for (unsigned long iBuffer_Point = 0; iBuffer_Point < nBuffer_Point; iBuffer_Point++)
-                        Buffer_Receive_Point[iBuffer_Point] = Buffer_Send_Point[iBuffer_Point];
-#else
-                    MPI_Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_DOUBLE, MPI_COMM_WORLD);
-                    MPI_Allgather(Buffer_Send_Point, nBuffer_Point, MPI_UNSIGNED_LONG, Buffer_Receive_Point, nBuffer_Point, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-#endif
-
-                    /*--- Compute the closest point to an actuator disk inlet point ---*/
-
-                    maxdist_local = 0.0;
-
-                    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) 
-                    {
-                        if (config->GetMarker_All_KindBC(iMarker) == Beneficiary)
-                        {
-                            for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
-                            {
-                                iPoint = vertex[iMarker][iVertex]->GetNode();
-                                if (node[iPoint]->GetDomain()) 
-                                {
-                                    /*--- Coordinates of the boundary point ---*/
-                                    Coord_i = node[iPoint]->GetCoord(); mindist = 1E6; pProcessor = 0; pPoint = 0;
-
-                                    /*--- Loop over all the boundaries to find the pair ---*/
-                                    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) 
-                                    {
-                                        for (jVertex = 0; jVertex < Buffer_Receive_nVertex[iProcessor]; jVertex++) 
-                                        {
-                                            jPoint = Buffer_Receive_Point[iProcessor*MaxLocalVertex_ActDisk + jVertex];
-
-                                            /*--- Compute the distance ---*/
-                                            dist = 0.0;
-                                            for (iDim = 0; iDim < nDim; iDim++) 
-                                            {
-                                                Coord_j[iDim] = Buffer_Receive_Coord[(iProcessor*MaxLocalVertex_ActDisk + jVertex)*nDim + iDim];
-                                                dist += pow(Coord_j[iDim] - Coord_i[iDim], 2.0);
-                                            }
-                                            dist = sqrt(dist);
-
-                                            if (dist < mindist) 
-                                            {
-                                                mindist = dist; pProcessor = iProcessor; pPoint = jPoint;
-                                                if (dist == 0.0) break;
-                                            }
-                                        }
-                                    }
-
-                                    /*--- Store the value of the pair ---*/
-
-                                    maxdist_local = std::max(maxdist_local, mindist);
-                                    vertex[iMarker][iVertex]->SetDonorPoint(pPoint, pProcessor);
-
-                                    if (mindist > epsilon) 
-                                    {
-                                        std::cout.precision(10);
-                                        std::cout << std::endl;
-                                        std::cout << "   Bad match for point " << iPoint << ".\tNearest";
-                                        std::cout << " donor distance: " << std::scientific << mindist << ".";
-                                        vertex[iMarker][iVertex]->SetDonorPoint(iPoint, pProcessor);
-                                        maxdist_local = std::min(maxdist_local, 0.0);
-                                    }
-                                }
-                            }
-                        }
-                    }
-
-#ifndef HAVE_MPI
-                    maxdist_global = maxdist_local;
-#else
-                    MPI_Reduce(&maxdist_local, &maxdist_global, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
-#endif
-
-                    if (rank == TBOX::MASTER_NODE) std::cout << "The max distance between points is: " << maxdist_global << "." << std::endl;
+                /*--- Inlet points take their donor on the outlet, and the other way around ---*/
+                if (rank == TBOX::MASTER_NODE) std::cout << "Set Actuator Disk inlet boundary conditions." << std::endl;
+                MatchMarker_Points(config, TBOX::ACTDISK_OUTLET, TBOX::ACTDISK_INLET, epsilon);
 
-                    delete[] Buffer_Send_Coord;
-                    delete[] Buffer_Send_Point;
-
-                    delete[] Buffer_Receive_Coord;
-                    delete[] Buffer_Receive_Point;
-
-                    delete[] Buffer_Send_nVertex;
-                    delete[] Buffer_Receive_nVertex;
-                }
+                if (rank == TBOX::MASTER_NODE) std::cout << "Set Actuator Disk outlet boundary conditions." << std::endl;
+                MatchMarker_Points(config, TBOX::ACTDISK_INLET, TBOX::ACTDISK_OUTLET, epsilon);
             }
         }
-
-        void GEOM_GeometryPhysical::MatchZone(TBOX::TBOX_Config *config, GEOM_Geometry *geometry_donor, TBOX::TBOX_Config *config_donor, unsigned short val_iZone, unsigned short val_nZone) 
+        void GEOM_GeometryPhysical::SetZone_Surface(GEOM_Geometry *geometry, TBOX::TBOX_Config *config, std::vector<unsigned long> &val_point,
+                                                    std::vector<double> &val_coord, std::vector<unsigned long> &val_elemPtr, std::vector<unsigned long> &val_elemNode)
         {
-
-#ifndef HAVE_MPI
-
-            unsigned short iMarker, jMarker;
-            unsigned long iVertex, iPoint, jVertex, jPoint = 0, pPoint = 0;
-            double *Coord_i, *Coord_j, dist = 0.0, mindist, maxdist;
-
-            if (val_iZone == TBOX::ZONE_0)
-                std::cout << "Set zone boundary conditions (if any)." << std::endl;
-
-            maxdist = 0.0;
-            for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) 
-            {
-                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) 
+            unsigned short iMarker, iDim, iNode;
+            unsigned long iVertex, iPoint, iElem;
+            unsigned long nPoint_Zone = geometry->GetnPoint();
+
+            /*--- Owned boundary points of all the markers, each of them once ---*/
+            std::vector<long> Surface_Index(nPoint_Zone, -1);
+            val_point.clear();
+            val_coord.clear();
+            for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+                for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++)
                 {
-                    iPoint = vertex[iMarker][iVertex]->GetNode();
-                    Coord_i = node[iPoint]->GetCoord();
-
-                    mindist = 1E6;
-                    for (jMarker = 0; jMarker < config_donor->GetnMarker_All(); jMarker++)
-                        for (jVertex = 0; jVertex < geometry_donor->GetnVertex(jMarker); jVertex++) 
-                        {
-                            jPoint = geometry_donor->vertex[jMarker][jVertex]->GetNode();
-                            Coord_j = geometry_donor->node[jPoint]->GetCoord();
-                            if (nDim == 2) dist = sqrt(pow(Coord_j[0] - Coord_i[0], 2.0) + pow(Coord_j[1] - Coord_i[1], 2.0));
-                            if (nDim == 3) dist = sqrt(pow(Coord_j[0] - Coord_i[0], 2.0) + pow(Coord_j[1] - Coord_i[1], 2.0) + pow(Coord_j[2] - Coord_i[2], 2.0));
-                            if (dist < mindist) 
-                            { 
-                                mindist = dist; 
-                                pPoint = jPoint; 
-                            }
-                        }
-
-                    maxdist = std::max(maxdist, mindist);
-                    vertex[iMarker][iVertex]->SetDonorPoint(pPoint, TBOX::MASTER_NODE);
+                    iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+                    if (!geometry->node[iPoint]->GetDomain() || (Surface_Index[iPoint] != -1)) continue;
+                    Surface_Index[iPoint] = val_point.size();
+                    val_point.push_back(iPoint);
+                    for (iDim = 0; iDim < nDim; iDim++) val_coord.push_back(geometry->node[iPoint]->GetCoord(iDim));
                 }
-            }
-
-#else
 
-            unsigned short iMarker, iDim;
-            unsigned long iVertex, iPoint, pPoint = 0, jVertex, jPoint;
-            double *Coord_i, Coord_j[3], dist = 0.0, mindist, maxdist;
-            int iProcessor, pProcessor = 0;
-            unsigned long nLocalVertex_Zone = 0, nGlobalVertex_Zone = 0, MaxLocalVertex_Zone = 0;
-            int rank, nProcessor;
-
-            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-            MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
-
-            unsigned long *Buffer_Send_nVertex = new unsigned long[1];
-            unsigned long *Buffer_Receive_nVertex = new unsigned long[nProcessor];
-
-            if (val_iZone == ZONE_0) cout << "Set zone boundary conditions (if any)." << endl;
-
-            nLocalVertex_Zone = 0;
-            for (iMarker = 0; iMarker < config_donor->GetnMarker_All(); iMarker++)
-                for (iVertex = 0; iVertex < geometry_donor->GetnVertex(iMarker); iVertex++) {
-                    iPoint = geometry_donor->vertex[iMarker][iVertex]->GetNode();
-                    if (geometry_donor->node[iPoint]->GetDomain()) nLocalVertex_Zone++;
+            /*--- Boundary elements made of owned points only ---*/
+            val_elemPtr.assign(1, 0);
+            val_elemNode.clear();
+            for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+                for (iElem = 0; iElem < geometry->GetnElem_Bound(iMarker); iElem++)
+                {
+                    bool owned = true;
+                    for (iNode = 0; iNode < geometry->bound[iMarker][iElem]->GetnNodes(); iNode++)
+                        owned = owned && (Surface_Index[geometry->bound[iMarker][iElem]->GetNode(iNode)] != -1);
+                    if (!owned) continue;
+                    for (iNode = 0; iNode < geometry->bound[iMarker][iElem]->GetnNodes(); iNode++)
+                        val_elemNode.push_back(Surface_Index[geometry->bound[iMarker][iElem]->GetNode(iNode)]);
+                    val_elemPtr.push_back(val_elemNode.size());
                 }
+        }
 
-            Buffer_Send_nVertex[0] = nLocalVertex_Zone;
+        void GEOM_GeometryPhysical::MatchZone(TBOX::TBOX_Config *config, GEOM_Geometry *geometry_donor, TBOX::TBOX_Config *config_donor, unsigned short val_iZone, unsigned short val_nZone) 
+        {
+            double epsilon = 1.5e-1, mindist;
+            unsigned short iMarker;
+            unsigned long iVertex, iPoint, pPoint = 0, iTarget;
+            int rank = TBOX::MASTER_NODE, pProcessor = 0;
 
-            /*--- Send Interface vertex information --*/
+#ifdef HAVE_MPI
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
 
-            MPI_Allreduce(&nLocalVertex_Zone, &nGlobalVertex_Zone, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-            MPI_Allreduce(&nLocalVertex_Zone, &MaxLocalVertex_Zone, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-            MPI_Allgather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+            if ((val_iZone == TBOX::ZONE_0) && (rank == TBOX::MASTER_NODE))
+                std::cout << "Set zone boundary conditions (if any)." << std::endl;
 
-            double *Buffer_Send_Coord = new double[MaxLocalVertex_Zone*nDim];
-            unsigned long *Buffer_Send_Point = new unsigned long[MaxLocalVertex_Zone];
+            std::vector<unsigned long> Point_Donor, ElemPtr_Donor, ElemNode_Donor, Point_Target, ElemPtr_Target, ElemNode_Target;
+            std::vector<double> Coord_Donor, Coord_Target;
 
-            double *Buffer_Receive_Coord = new double[nProcessor*MaxLocalVertex_Zone*nDim];
-            unsigned long *Buffer_Receive_Point = new unsigned long[nProcessor*MaxLocalVertex_Zone];
+            SetZone_Surface(geometry_donor, config_donor, Point_Donor, Coord_Donor, ElemPtr_Donor, ElemNode_Donor);
+            SetZone_Surface(this, config, Point_Target, Coord_Target, ElemPtr_Target, ElemNode_Target);
 
-            unsigned long nBuffer_Coord = MaxLocalVertex_Zone*nDim;
-            unsigned long nBuffer_Point = MaxLocalVertex_Zone;
+            /*--- The transfer operator is built once and kept for the field exchanges between the zones ---*/
+            if (ZoneTransfer != NULL) delete ZoneTransfer;
+            ZoneTransfer = new GeomZoneTransfer(nDim, epsilon);
+            ZoneTransfer->SetDonorSurface(Point_Donor.size(), Coord_Donor.empty() ? NULL : &Coord_Donor[0], ElemPtr_Donor.size() - 1,
+                                          &ElemPtr_Donor[0], ElemNode_Donor.empty() ? NULL : &ElemNode_Donor[0], Point_Donor.empty() ? NULL : &Point_Donor[0]);
+            ZoneTransfer->SetTargetSurface(Point_Target.size(), Coord_Target.empty() ? NULL : &Coord_Target[0], ElemPtr_Target.size() - 1,
+                                           &ElemPtr_Target[0], ElemNode_Target.empty() ? NULL : &ElemNode_Target[0]);
+            ZoneTransfer->Build(GeomZoneTransfer::Transfer_Isoparametric);
 
-            for (iVertex = 0; iVertex < MaxLocalVertex_Zone; iVertex++) {
-                Buffer_Send_Point[iVertex] = 0;
-                for (iDim = 0; iDim < nDim; iDim++)
-                    Buffer_Send_Coord[iVertex*nDim + iDim] = 0.0;
-            }
+            /*--- Closest donor of every owned boundary point; points without any candidate keep themselves ---*/
+            std::vector<long> Target_Index(nPoint, -1);
+            for (iTarget = 0; iTarget < Point_Target.size(); iTarget++) Target_Index[Point_Target[iTarget]] = iTarget;
 
-            /*--- Copy coordinates and point to the auxiliar std::vector --*/
-            nLocalVertex_Zone = 0;
-            for (iMarker = 0; iMarker < config_donor->GetnMarker_All(); iMarker++)
-                for (iVertex = 0; iVertex < geometry_donor->GetnVertex(iMarker); iVertex++) {
-                    iPoint = geometry_donor->vertex[iMarker][iVertex]->GetNode();
-                    if (geometry_donor->node[iPoint]->GetDomain()) {
-                        Buffer_Send_Point[nLocalVertex_Zone] = iPoint;
-                        for (iDim = 0; iDim < nDim; iDim++)
-                            Buffer_Send_Coord[nLocalVertex_Zone*nDim + iDim] = geometry_donor->node[iPoint]->GetCoord(iDim);
-                        nLocalVertex_Zone++;
-                    }
-                }
-
-            MPI_Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_DOUBLE, MPI_COMM_WORLD);
-            MPI_Allgather(Buffer_Send_Point, nBuffer_Point, MPI_UNSIGNED_LONG, Buffer_Receive_Point, nBuffer_Point, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-
-            /*--- Compute the closest point to a Near-Field boundary point ---*/
-            maxdist = 0.0;
-            for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+            for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+                {
                     iPoint = vertex[iMarker][iVertex]->GetNode();
+                    if (Target_Index[iPoint] == -1) continue;
 
-                    if (node[iPoint]->GetDomain()) {
-
-                        /*--- Coordinates of the boundary point ---*/
-                        Coord_i = node[iPoint]->GetCoord(); mindist = 1E6; pProcessor = 0; pPoint = 0;
-
-                        /*--- Loop over all the boundaries to find the pair ---*/
-                        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
-                            for (jVertex = 0; jVertex < Buffer_Receive_nVertex[iProcessor]; jVertex++) {
-                                jPoint = Buffer_Receive_Point[iProcessor*MaxLocalVertex_Zone + jVertex];
-
-                                /*--- Compute the distance ---*/
-                                dist = 0.0; for (iDim = 0; iDim < nDim; iDim++) {
-                                    Coord_j[iDim] = Buffer_Receive_Coord[(iProcessor*MaxLocalVertex_Zone + jVertex)*nDim + iDim];
-                                    dist += pow(Coord_j[iDim] - Coord_i[iDim], 2.0);
-                                } dist = sqrt(dist);
-
-                                if (((dist < mindist) && (iProcessor != rank)) ||
-                                    ((dist < mindist) && (iProcessor == rank) && (jPoint != iPoint))) {
-                                    mindist = dist; pProcessor = iProcessor; pPoint = jPoint;
-                                }
-                            }
-
-                        /*--- Store the value of the pair ---*/
-                        maxdist = max(maxdist, mindist);
-                        vertex[iMarker][iVertex]->SetDonorPoint(pPoint, pProcessor);
-
-
-                    }
+                    pPoint = iPoint; pProcessor = rank;
+                    ZoneTransfer->GetNearestDonor(Target_Index[iPoint], pPoint, pProcessor, mindist);
+                    vertex[iMarker][iVertex]->SetDonorPoint(pPoint, pProcessor);
                 }
-            }
-
-            delete[] Buffer_Send_Coord;
-            delete[] Buffer_Send_Point;
-
-            delete[] Buffer_Receive_Coord;
-            delete[] Buffer_Receive_Point;
-
-            delete[] Buffer_Send_nVertex;
-            delete[] Buffer_Receive_nVertex;
-
-#endif
         }
 
         void GEOM_GeometryPhysical::SetControlVolume(TBOX::TBOX_Config *config, unsigned short action)
@@ -7189,79 +7001,62 @@ namespace ARIES
 
         void GEOM_GeometryPhysical::SetCoord_Smoothing(unsigned short val_nSmooth, double val_smooth_coeff, TBOX::TBOX_Config *config)
         {
-            unsigned short iSmooth, nneigh, iMarker;
-            double *Coord_Old, *Coord_Sum, *Coord, *Coord_i, *Coord_j, Position_Plane = 0.0;
-            unsigned long iEdge, iPoint, jPoint, iVertex;
+            unsigned short iMarker, iDim, iNeighbor;
+            unsigned long iPoint, iVertex;
+            double Position_Plane = 0.0, Normal_Plane[3] = { 0.0, 0.0, 0.0 };
             double eps = 1E-6;
             bool NearField = false;
 
-            Coord = new double[nDim];
+            /*--- Halo points are refreshed every few sweeps only ---*/
+            const unsigned short nSweep_Exchange = 2;
 
-            for (iPoint = 0; iPoint < GetnPoint(); iPoint++)
-            {
-                double *Coord = node[iPoint]->GetCoord();
-                node[iPoint]->SetCoord_Old(Coord);
-            }
+            GeomSmoother Smoother(nDim);
 
-            /*--- Jacobi iterations ---*/
-            for (iSmooth = 0; iSmooth < val_nSmooth; iSmooth++)
+            /*--- Point graph, from the flat adjacency when it is up to date ---*/
+            if (Adjacency.GetNeighborPtr().size() == nPoint + 1)
+                Smoother.SetGraph(nPoint, Adjacency.GetNeighborPtr().data(), Adjacency.GetNeighborList().data());
+            else
             {
-
+                std::vector<unsigned long> NeighborPtr(nPoint + 1, 0), Neighbor;
                 for (iPoint = 0; iPoint < nPoint; iPoint++)
-                    node[iPoint]->SetCoord_SumZero();
-
-                /*--- Loop over Interior edges ---*/
-                for (iEdge = 0; iEdge < nEdge; iEdge++)
                 {
-                    iPoint = edge[iEdge]->GetNode(0);
-                    Coord_i = node[iPoint]->GetCoord();
-
-                    jPoint = edge[iEdge]->GetNode(1);
-                    Coord_j = node[jPoint]->GetCoord();
-
-                    /*--- Accumulate nearest neighbor Coord to Res_sum for each variable ---*/
-                    node[iPoint]->AddCoord_Sum(Coord_j);
-                    node[jPoint]->AddCoord_Sum(Coord_i);
+                    for (iNeighbor = 0; iNeighbor < node[iPoint]->GetnPoint(); iNeighbor++)
+                        Neighbor.push_back(node[iPoint]->GetPoint(iNeighbor));
+                    NeighborPtr[iPoint + 1] = Neighbor.size();
                 }
+                Neighbor.push_back(0);
+                Smoother.SetGraph(nPoint, &NeighborPtr[0], &Neighbor[0]);
+            }
 
-                /*--- Loop over all mesh points (Update Coords with averaged sum) ---*/
-                for (iPoint = 0; iPoint < nPoint; iPoint++)
-                {
-                    nneigh = node[iPoint]->GetnPoint();
-                    Coord_Sum = node[iPoint]->GetCoord_Sum();
-                    Coord_Old = node[iPoint]->GetCoord_Old();
-
-                    if (nDim == 2)
-                    {
-                        Coord[0] = (Coord_Old[0] + val_smooth_coeff*Coord_Sum[0]) / (1.0 + val_smooth_coeff*double(nneigh));
-                        Coord[1] = (Coord_Old[1] + val_smooth_coeff*Coord_Sum[1]) / (1.0 + val_smooth_coeff*double(nneigh));
-                        if ((NearField) && ((Coord_Old[1] > Position_Plane - eps) && (Coord_Old[1] < Position_Plane + eps)))
-                            Coord[1] = Coord_Old[1];
-                    }
+            /*--- Points on the physical boundaries do not move, points on the near field plane stay in it ---*/
+            Normal_Plane[nDim - 1] = 1.0;
+            for (iPoint = 0; iPoint < nPoint; iPoint++)
+            {
+                double *Coord = node[iPoint]->GetCoord();
+                if ((NearField) && (Coord[nDim - 1] > Position_Plane - eps) && (Coord[nDim - 1] < Position_Plane + eps))
+                    Smoother.SetConstraint(iPoint, GeomSmoother::Smooth_Plane, Normal_Plane);
+            }
 
-                    if (nDim == 3)
-                    {
-                        Coord[0] = (Coord_Old[0] + val_smooth_coeff*Coord_Sum[0]) / (1.0 + val_smooth_coeff*double(nneigh));
-                        Coord[1] = (Coord_Old[1] + val_smooth_coeff*Coord_Sum[1]) / (1.0 + val_smooth_coeff*double(nneigh));
-                        Coord[2] = (Coord_Old[2] + val_smooth_coeff*Coord_Sum[2]) / (1.0 + val_smooth_coeff*double(nneigh));
-                        if ((NearField) && ((Coord_Old[2] > Position_Plane - eps) && (Coord_Old[2] < Position_Plane + eps)))
-                            Coord[2] = Coord_Old[2];
-                    }
+            for (iMarker = 0; iMarker < nMarker; iMarker++)
+                if (config->GetMarker_All_KindBC(iMarker) != TBOX::SEND_RECEIVE)
+                    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+                        Smoother.SetConstraint(vertex[iMarker][iVertex]->GetNode(), GeomSmoother::Smooth_Fixed);
 
-                    node[iPoint]->SetCoord(Coord);
-                }
+            if (HaloExchange == NULL) SetHalo_Exchange(config);
+            Smoother.SetHalo(HaloExchange, nSweep_Exchange);
 
-                /*--- Copy boundary values ---*/
-                for (iMarker = 0; iMarker < nMarker; iMarker++)
-                    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
-                    {
-                        iPoint = vertex[iMarker][iVertex]->GetNode();
-                        Coord_Old = node[iPoint]->GetCoord_Old();
-                        node[iPoint]->SetCoord(Coord_Old);
-                    }
+            std::vector<double> Coord(nPoint*nDim + 1);
+            for (iPoint = 0; iPoint < nPoint; iPoint++)
+            {
+                for (iDim = 0; iDim < nDim; iDim++)
+                    Coord[iPoint*nDim + iDim] = node[iPoint]->GetCoord(iDim);
             }
 
-            delete[] Coord;
+            /*--- Jacobi iterations ---*/
+            Smoother.Smooth(&Coord[0], val_nSmooth, val_smooth_coeff);
+
+            for (iPoint = 0; iPoint < nPoint; iPoint++)
+                node[iPoint]->SetCoord(&Coord[iPoint*nDim]);
         }
 
         bool GEOM_GeometryPhysical::FindFace(unsigned long first_elem, unsigned long second_elem, unsigned short &face_first_elem, unsigned short &face_second_elem) 
@@ -7819,6 +7614,47 @@ namespace ARIES
             delete[] npart;
             delete[] elmnts;
             delete[] eptr;
+#else
+
+            /*--- METIS is not available: color the grid with the built-in
+            geometric partitioner (weighted recursive coordinate bisection). ---*/
+
+            unsigned long iPoint, iNeigh;
+            unsigned short iDim;
+            int size;
+
+            MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+            for (iPoint = 0; iPoint < nPoint; iPoint++)
+                node[iPoint]->SetColor(0);
+
+            if (size > SINGLE_NODE)
+            {
+                std::cout << std::endl << "---------------------------- Grid partitioning --------------------------" << std::endl;
+
+                std::vector<double> coord(nPoint*nDim);
+                std::vector<unsigned long> xadj_g(nPoint + 1, 0), adjacency_g, part;
+                for (iPoint = 0; iPoint < nPoint; iPoint++)
+                {
+                    for (iDim = 0; iDim < nDim; iDim++)
+                        coord[iPoint*nDim + iDim] = node[iPoint]->GetCoord(iDim);
+                    for (iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); iNeigh++)
+                        adjacency_g.push_back(node[iPoint]->GetPoint(iNeigh));
+                    xadj_g[iPoint + 1] = adjacency_g.size();
+                }
+
+                GeomPartitioner partitioner(nDim, size, false);
+                partitioner.Partition(nPoint, &coord[0], NULL, part);
+
+                unsigned long vtxdist[2] = { 0, nPoint };
+                partitioner.ComputeQuality(nPoint, vtxdist, &xadj_g[0], adjacency_g.empty() ? NULL : &adjacency_g[0], NULL, part);
+
+                std::cout << "Finished partitioning using the built-in geometric partitioner (";
+                std::cout << partitioner.GetEdgeCut() << " edge cuts, load imbalance " << partitioner.GetImbalance() << ")." << std::endl;
+
+                for (iPoint = 0; iPoint < nPoint; iPoint++)
+                    node[iPoint]->SetColor(part[iPoint]);
+            }
 #endif
 
 #endif
@@ -7850,18 +7686,20 @@ namespace ARIES
                 idx_t *vtxdist = new idx_t[size + 1];
                 idx_t *xadj_l = new idx_t[xadj_size];
                 idx_t *adjacency_l = new idx_t[adjacency_size];
-                idx_t *elmwgt = new idx_t[local_node];
+                idx_t *elmwgt = new idx_t[2 * local_node];
                 idx_t *part = new idx_t[local_node];
 
-                real_t ubvec;
-                real_t *tpwgts = new real_t[size];
+                real_t ubvec[2];
+                real_t *tpwgts = new real_t[2 * size];
 
-                /*--- Some recommended defaults for the various ParMETIS options. ---*/
+                /*--- Some recommended defaults for the various ParMETIS options. The
+                vertices carry two weights (compute and memory), see SetPartition_Weight. ---*/
 
-                wgtflag = 0;
+                wgtflag = 2;
                 numflag = 0;
-                ncon = 1;
-                ubvec = 1.05;
+                ncon = 2;
+                ubvec[0] = 1.05;
+                ubvec[1] = 1.10;
                 nparts = (idx_t)size;
                 idx_t options[METIS_NOPTIONS];
                 METIS_SetDefaultOptions(options);
@@ -7869,10 +7707,16 @@ namespace ARIES
 
                 /*--- Fill the necessary ParMETIS data arrays ---*/
 
-                for (int i = 0; i < size; i++) {
+                for (int i = 0; i < ncon * size; i++) {
                     tpwgts[i] = 1.0 / ((real_t)size);
                 }
 
+                std::vector<double> weight;
+                SetPartition_Weight(weight);
+                for (iPoint = 0; iPoint < 2 * local_node; iPoint++) {
+                    elmwgt[iPoint] = std::max((idx_t)1, (idx_t)(10.0 * weight[iPoint] + 0.5));
+                }
+
                 vtxdist[0] = 0;
                 for (int i = 0; i < size; i++) {
                     vtxdist[i + 1] = (idx_t)ending_node[i];
@@ -7888,87 +7732,225 @@ namespace ARIES
 
                 /*--- Calling ParMETIS ---*/
                 if (rank == MASTER_NODE) cout << "Calling ParMETIS..." << endl;
-                ParMETIS_V3_PartKway(vtxdist, xadj_l, adjacency_l, NULL, NULL, &wgtflag,
-                    &numflag, &ncon, &nparts, tpwgts, &ubvec, options,
+                ParMETIS_V3_PartKway(vtxdist, xadj_l, adjacency_l, elmwgt, NULL, &wgtflag,
+                    &numflag, &ncon, &nparts, tpwgts, ubvec, options,
                     &edgecut, part, &comm);
                 if (rank == MASTER_NODE) {
                     cout << "Finished partitioning using ParMETIS (";
                     cout << edgecut << " edge cuts)." << endl;
                 }
 
-                /*--- Store the results of the partitioning (note that this is local
-                since each processor is calling ParMETIS in parallel and storing the
-                results for its initial piece of the grid. ---*/
+                /*--- Store the results of the partitioning (note that this is local
+                since each processor is calling ParMETIS in parallel and storing the
+                results for its initial piece of the grid. ---*/
+
+                for (iPoint = 0; iPoint < local_node; iPoint++) {
+                    node[iPoint]->SetColor(part[iPoint]);
+                }
+
+                /*--- Free all memory needed for the ParMETIS structures ---*/
+
+                delete[] vtxdist;
+                delete[] xadj_l;
+                delete[] adjacency_l;
+                delete[] elmwgt;
+                delete[] part;
+                delete[] tpwgts;
+
+            }
+
+            /*--- Delete the memory from the geometry class that carried the
+            adjacency structure. ---*/
+
+            delete[] xadj;
+            delete[] adjacency;
+
+#else
+
+            /*--- Without ParMETIS every rank takes part in a recursive coordinate
+            bisection of the linear partition it read, so the grid is still
+            balanced and no rank needs more than its own chunk of points. ---*/
+
+            unsigned long iPoint;
+            unsigned short iDim;
+            int rank, size;
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+            MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+            if (size > SINGLE_NODE)
+            {
+                std::vector<double> coord(local_node*nDim + 1), weight;
+                std::vector<unsigned long> vtxdist(size + 1), part;
+
+                SetPartition_Weight(weight);
+
+                for (iPoint = 0; iPoint < local_node; iPoint++)
+                    for (iDim = 0; iDim < nDim; iDim++)
+                        coord[iPoint*nDim + iDim] = node[iPoint]->GetCoord(iDim);
+
+                vtxdist[0] = 0;
+                for (int i = 0; i < size; i++)
+                    vtxdist[i + 1] = ending_node[i];
+
+                if (rank == MASTER_NODE) std::cout << "Calling the built-in geometric partitioner..." << std::endl;
+
+                GeomPartitioner partitioner(nDim, size, true, 2);
+                partitioner.Partition(local_node, &coord[0], &weight[0], part);
+                partitioner.ComputeQuality(local_node, &vtxdist[0], xadj, adjacency, &weight[0], part);
+
+                if (rank == MASTER_NODE)
+                {
+                    std::cout << "Finished partitioning using recursive coordinate bisection (";
+                    std::cout << partitioner.GetEdgeCut() << " edge cuts, load imbalance " << partitioner.GetImbalance(0);
+                    std::cout << " compute / " << partitioner.GetImbalance(1) << " memory)." << std::endl;
+                }
+
+                for (iPoint = 0; iPoint < local_node; iPoint++)
+                    node[iPoint]->SetColor(part[iPoint]);
+            }
+
+            delete[] xadj;
+            delete[] adjacency;
+
+#endif
+#endif
+        }
+
+        void GEOM_GeometryPhysical::SetPartition_Weight(std::vector<double> &val_weight)
+        {
+            unsigned long iElem, iPoint, jPoint, firstNode = 0, lastNode = local_node;
+            unsigned short iNode, nNode;
+            int rank = MASTER_NODE;
+
+#ifdef HAVE_MPI
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+            firstNode = starting_node[rank];
+            lastNode = ending_node[rank];
+#endif
+
+            /*--- Element costs, refitted from the timing of the previous run if it
+            left one behind (see GeomCostModel::WriteTiming). ---*/
 
-                for (iPoint = 0; iPoint < local_node; iPoint++) {
-                    node[iPoint]->SetColor(part[iPoint]);
-                }
+            GeomCostModel costModel;
+            if (costModel.ReadTiming("partition_timing.dat") && (rank == MASTER_NODE))
+                std::cout << "Element costs fitted to the timing of the previous run (partition_timing.dat)." << std::endl;
 
-                /*--- Free all memory needed for the ParMETIS structures ---*/
+            val_weight.assign(2 * local_node, 0.0);
 
-                delete[] vtxdist;
-                delete[] xadj_l;
-                delete[] adjacency_l;
-                delete[] elmwgt;
-                delete[] part;
-                delete[] tpwgts;
+            /*--- Compute weight: the cost of every element spread evenly over its nodes ---*/
 
+            for (iElem = 0; iElem < local_elem; iElem++)
+            {
+                nNode = elem[iElem]->GetnNodes();
+                double cost = costModel.GetCost(elem[iElem]->GetVTK_Type()) / double(nNode);
+                for (iNode = 0; iNode < nNode; iNode++)
+                {
+                    jPoint = elem[iElem]->GetNode(iNode);
+                    if ((jPoint >= firstNode) && (jPoint < lastNode))
+                        val_weight[2 * (jPoint - firstNode)] += cost;
+                }
             }
 
-            /*--- Delete the memory from the geometry class that carried the
-            adjacency structure. ---*/
+            /*--- Memory weight: one block row of the system matrix (diagonal plus neighbors) ---*/
 
-            delete[] xadj;
-            delete[] adjacency;
+            for (iPoint = 0; iPoint < local_node; iPoint++)
+                val_weight[2 * iPoint + 1] = 1.0 + double(xadj[iPoint + 1] - xadj[iPoint]);
+        }
 
-#endif
-#endif
+        void GEOM_GeometryPhysical::SetPartition_Timing(double val_time)
+        {
+            unsigned long iElem;
+            unsigned short iType;
+            std::vector<unsigned long> nElem_Type(GeomCostModel::ElemCost_Num, 0);
+
+            /*--- Element mix of the rank, halo elements included as the residual loops visit them ---*/
+
+            for (iElem = 0; iElem < nElem; iElem++)
+            {
+                iType = GeomCostModel::GetCostIndex(elem[iElem]->GetVTK_Type());
+                if (iType < GeomCostModel::ElemCost_Num) nElem_Type[iType]++;
+            }
+
+            GeomCostModel::WriteTiming("partition_timing.dat", val_time, &nElem_Type[0]);
         }
 
         void GEOM_GeometryPhysical::GetQualityStatistics(double *statistics) 
         {
-            unsigned long jPoint, Point_2, Point_3, iElem;
-            double *Coord_j, *Coord_2, *Coord_3;
-            unsigned short iDim;
+            unsigned long iPoint, iElem, iEdge;
+            unsigned short iDim, iNode;
 
-            statistics[0] = 1e06;
-            statistics[1] = 0;
-
-            /*--- Loop interior edges ---*/
-            for (iElem = 0; iElem < this->GetnElem(); iElem++) 
+            /*--- The connectivity is handed over once, later calls only recompute the metrics around the points that moved ---*/
+            if (MeshQuality == NULL)
             {
-                if ((this->GetnDim() == 2) && (elem[iElem]->GetVTK_Type() == TBOX::TRIANGLE)) 
+                bool *PointOwned = new bool[nPoint];
+                bool *ElemOwned = new bool[nElem + 1];
+                std::vector<unsigned short> VTK_Type(nElem + 1);
+                std::vector<unsigned long> ElemPtr(nElem + 1, 0), ElemNode;
+
+                for (iPoint = 0; iPoint < nPoint; iPoint++)
+                    PointOwned[iPoint] = node[iPoint]->GetDomain();
+                for (iElem = 0; iElem < nElem; iElem++)
                 {
-                    jPoint = elem[iElem]->GetNode(0); Coord_j = node[jPoint]->GetCoord();
-                    Point_2 = elem[iElem]->GetNode(1); Coord_2 = node[Point_2]->GetCoord();
-                    Point_3 = elem[iElem]->GetNode(2); Coord_3 = node[Point_3]->GetCoord();
+                    VTK_Type[iElem] = elem[iElem]->GetVTK_Type();
+                    for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+                        ElemNode.push_back(elem[iElem]->GetNode(iNode));
+                    ElemPtr[iElem + 1] = ElemNode.size();
+                    ElemOwned[iElem] = node[elem[iElem]->GetNode(0)]->GetDomain();
+                }
+                ElemNode.push_back(0);
 
-                    /*--- Compute sides of the triangle ---*/
-                    double a = 0, b = 0, c = 0;
-                    for (iDim = 0; iDim < nDim; iDim++) 
-                    {
-                        a += (Coord_2[iDim] - Coord_j[iDim])*(Coord_2[iDim] - Coord_j[iDim]);
-                        b += (Coord_3[iDim] - Coord_j[iDim])*(Coord_3[iDim] - Coord_j[iDim]);
-                        c += (Coord_3[iDim] - Coord_2[iDim])*(Coord_3[iDim] - Coord_2[iDim]);
-                    }
-                    a = sqrt(a); b = sqrt(b); c = sqrt(c);
+                MeshQuality = new GeomMeshQuality(nDim);
+                MeshQuality->SetElements(nPoint, PointOwned, nElem, &VTK_Type[0], &ElemPtr[0], &ElemNode[0], ElemOwned);
+
+                delete[] PointOwned;
+                delete[] ElemOwned;
+            }
 
-                    /*--- Compute semiperimeter (s) and area ---*/
-                    double s = 0.5*(a + b + c);
-                    double Area = sqrt(s*(s - a)*(s - b)*(s - c));
+            /*--- The edges are handed over as soon as they exist, and again if they were rebuilt,
+            whether or not the element connectivity was set by this call ---*/
+            if ((nEdge > 0) && (MeshQuality->GetNumEdge() != nEdge))
+            {
+                unsigned long *EdgeNode = new unsigned long[2 * nEdge];
+                bool *EdgeOwned = new bool[nEdge];
+                for (iEdge = 0; iEdge < nEdge; iEdge++)
+                {
+                    EdgeNode[2 * iEdge] = edge[iEdge]->GetNode(0);
+                    EdgeNode[2 * iEdge + 1] = edge[iEdge]->GetNode(1);
+                    EdgeOwned[iEdge] = node[EdgeNode[2 * iEdge]]->GetDomain();
+                }
+                MeshQuality->SetEdges(nEdge, EdgeNode, EdgeOwned);
+                delete[] EdgeNode;
+                delete[] EdgeOwned;
+            }
 
-                    /*--- Compute radius of the circumcircle (R) and of the incircle (r) ---*/
-                    double R = (a*b*c) / (4.0*Area);
-                    double r = Area / s;
-                    double roR = r / R;
+            /*--- Coordinates and, once the dual grid exists, normals and control volumes ---*/
+            std::vector<double> Coord(nPoint * nDim + 1);
+            for (iPoint = 0; iPoint < nPoint; iPoint++)
+                for (iDim = 0; iDim < nDim; iDim++)
+                    Coord[iPoint * nDim + iDim] = node[iPoint]->GetCoord(iDim);
 
-                    /*--- Update statistics ---*/
-                    if (roR < statistics[0])
-                        statistics[0] = roR;
-                    statistics[1] += roR;
+            if (nEdge > 0)
+            {
+                std::vector<double> Normal(nEdge * nDim), Volume(nPoint + 1);
+                for (iEdge = 0; iEdge < nEdge; iEdge++)
+                {
+                    double *NormalFace = edge[iEdge]->GetNormal();
+                    for (iDim = 0; iDim < nDim; iDim++)
+                        Normal[iEdge * nDim + iDim] = NormalFace[iDim];
                 }
+                for (iPoint = 0; iPoint < nPoint; iPoint++)
+                    Volume[iPoint] = node[iPoint]->GetVolume();
+                MeshQuality->SetDualGrid(&Normal[0], &Volume[0]);
             }
-            statistics[1] /= this->GetnElem();
+
+            MeshQuality->Update(&Coord[0]);
+
+            statistics[0] = MeshQuality->GetMax(GeomMeshQuality::Quality_Skewness);
+            statistics[1] = MeshQuality->GetMean(GeomMeshQuality::Quality_Skewness);
+            statistics[2] = MeshQuality->GetMax(GeomMeshQuality::Quality_AspectRatio);
+            statistics[3] = MeshQuality->GetMax(GeomMeshQuality::Quality_VolumeRatio);
+            statistics[4] = MeshQuality->GetMax(GeomMeshQuality::Quality_Orthogonality);
+            statistics[5] = MeshQuality->GetNumInvalid();
         }
 
         void GEOM_GeometryPhysical::SetRotationalVelocity(TBOX::TBOX_Config *config) 
@@ -8055,278 +8037,132 @@ namespace ARIES
             }
         }
 
-        void GEOM_GeometryPhysical::Set_MPI_Coord(TBOX::TBOX_Config *config)
+        void GEOM_GeometryPhysical::SetHalo_Exchange(TBOX::TBOX_Config *config)
         {
-            unsigned short iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-            unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_vector, nBufferR_vector;
-            double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi, *Buffer_Receive_Coord = NULL, *Buffer_Send_Coord = NULL, *Coord = NULL, *newCoord = NULL;
-
-            newCoord = new double[nDim];
-
-#ifdef HAVE_MPI
+            unsigned short iMarker, MarkerS, MarkerR, iPeriodic, nPeriodic = 1;
+            unsigned long iVertex;
             int send_to, receive_from;
-            MPI_Status status;
-#endif
+            double *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi;
 
+            if (HaloExchange != NULL) delete HaloExchange;
+            HaloExchange = new GeomHaloExchange();
+
+            /*--- One pair of messages per couple of send/receive markers ---*/
             for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
             {
-
                 if ((config->GetMarker_All_KindBC(iMarker) == TBOX::SEND_RECEIVE) &&
                     (config->GetMarker_All_SendRecv(iMarker) > 0))
                 {
-
                     MarkerS = iMarker;  MarkerR = iMarker + 1;
 
-#ifdef HAVE_MPI
                     send_to = config->GetMarker_All_SendRecv(MarkerS) - 1;
                     receive_from = abs(config->GetMarker_All_SendRecv(MarkerR)) - 1;
-#endif
-
-                    nVertexS = nVertex[MarkerS];
-                    nVertexR = nVertex[MarkerR];
-                    nBufferS_vector = nVertexS*nDim;
-                    nBufferR_vector = nVertexR*nDim;
-
-                    /*--- Allocate Receive and send buffers  ---*/
-
-                    Buffer_Receive_Coord = new double[nBufferR_vector];
-                    Buffer_Send_Coord = new double[nBufferS_vector];
-
-                    /*--- Copy the coordinates that should be sended ---*/
-
-                    for (iVertex = 0; iVertex < nVertexS; iVertex++)
-                    {
-                        iPoint = vertex[MarkerS][iVertex]->GetNode();
-                        Coord = node[iPoint]->GetCoord();
-                        for (iDim = 0; iDim < nDim; iDim++)
-                            Buffer_Send_Coord[iDim*nVertexS + iVertex] = Coord[iDim];
-                    }
-
-#ifdef HAVE_MPI
-                    /*--- Send/Receive information using Sendrecv ---*/
-                    MPI_Sendrecv(Buffer_Send_Coord, nBufferS_std::vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Coord, nBufferR_std::vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-#else
 
-                    /*--- Receive information without MPI ---*/
-                    for (iVertex = 0; iVertex < nVertexR; iVertex++)
+                    std::vector<unsigned long> SendPoint(nVertex[MarkerS] + 1), ReceivePoint(nVertex[MarkerR] + 1);
+                    std::vector<unsigned short> Rotation(nVertex[MarkerR] + 1);
+                    for (iVertex = 0; iVertex < nVertex[MarkerS]; iVertex++)
+                        SendPoint[iVertex] = vertex[MarkerS][iVertex]->GetNode();
+                    for (iVertex = 0; iVertex < nVertex[MarkerR]; iVertex++)
                     {
-                        for (iDim = 0; iDim < nDim; iDim++)
-                            Buffer_Receive_Coord[iDim*nVertexR + iVertex] = Buffer_Send_Coord[iDim*nVertexR + iVertex];
+                        ReceivePoint[iVertex] = vertex[MarkerR][iVertex]->GetNode();
+                        Rotation[iVertex] = vertex[MarkerR][iVertex]->GetRotation_Type();
+                        nPeriodic = std::max(nPeriodic, (unsigned short)(Rotation[iVertex] + 1));
                     }
 
-#endif
-
-                    /*--- Deallocate send buffer ---*/
-
-                    delete[] Buffer_Send_Coord;
-
-                    /*--- Do the coordinate transformation ---*/
-
-                    for (iVertex = 0; iVertex < nVertexR; iVertex++)
-                    {
-
-                        /*--- Find point and its type of transformation ---*/
-
-                        iPoint = vertex[MarkerR][iVertex]->GetNode();
-                        iPeriodic_Index = vertex[MarkerR][iVertex]->GetRotation_Type();
-
-                        /*--- Retrieve the supplied periodic information. ---*/
-
-                        angles = config->GetPeriodicRotation(iPeriodic_Index);
-
-                        /*--- Store angles separately for clarity. ---*/
-
-                        theta = angles[0];   phi = angles[1];     psi = angles[2];
-                        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-                        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-
-                        /*--- Compute the rotation matrix. Note that the implicit
-                        ordering is rotation about the x-axis, y-axis,
-                        then z-axis. Note that this is the transpose of the matrix
-                        used during the preprocessing stage. ---*/
+                    HaloExchange->AddPair(send_to, nVertex[MarkerS], &SendPoint[0], receive_from, nVertex[MarkerR], &ReceivePoint[0], &Rotation[0]);
+                }
+            }
 
-                        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-                        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-                        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
+            /*--- Rotation matrices of the periodic transformations. Note that the implicit
+            ordering is rotation about the x-axis, y-axis, then z-axis. Note that this is
+            the transpose of the matrix used during the preprocessing stage. ---*/
+            std::vector<double> rotMatrix(9 * nPeriodic);
+            for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++)
+            {
+                angles = config->GetPeriodicRotation(iPeriodic);
+                double *Matrix = &rotMatrix[9 * iPeriodic];
 
-                        /*--- Copy coordinates before performing transformation. ---*/
+                theta = angles[0];   phi = angles[1];     psi = angles[2];
+                cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
+                sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
 
-                        for (iDim = 0; iDim < nDim; iDim++)
-                            newCoord[iDim] = Buffer_Receive_Coord[iDim*nVertexR + iVertex];
+                Matrix[0] = cosPhi*cosPsi;    Matrix[3] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     Matrix[6] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
+                Matrix[1] = cosPhi*sinPsi;    Matrix[4] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     Matrix[7] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
+                Matrix[2] = -sinPhi;          Matrix[5] = sinTheta*cosPhi;                              Matrix[8] = cosTheta*cosPhi;
+            }
+            HaloExchange->SetRotation(nDim, nPeriodic, &rotMatrix[0]);
+        }
 
-                        /*--- Rotate the coordinates. ---*/
+        void GEOM_GeometryPhysical::Set_MPI_Coord(TBOX::TBOX_Config *config)
+        {
+            unsigned short iDim;
+            unsigned long iSend, iReceive, iPoint;
+            double *Buffer_Send_Coord, *Coord;
+            const double *Buffer_Receive_Coord;
 
-                        if (nDim == 2)
-                        {
-                            newCoord[0] = (rotMatrix[0][0] * Buffer_Receive_Coord[0 * nVertexR + iVertex] +
-                                rotMatrix[0][1] * Buffer_Receive_Coord[1 * nVertexR + iVertex]);
-                            newCoord[1] = (rotMatrix[1][0] * Buffer_Receive_Coord[0 * nVertexR + iVertex] +
-                                rotMatrix[1][1] * Buffer_Receive_Coord[1 * nVertexR + iVertex]);
-                        }
-                        else
-                        {
-                            newCoord[0] = (rotMatrix[0][0] * Buffer_Receive_Coord[0 * nVertexR + iVertex] +
-                                rotMatrix[0][1] * Buffer_Receive_Coord[1 * nVertexR + iVertex] +
-                                rotMatrix[0][2] * Buffer_Receive_Coord[2 * nVertexR + iVertex]);
-                            newCoord[1] = (rotMatrix[1][0] * Buffer_Receive_Coord[0 * nVertexR + iVertex] +
-                                rotMatrix[1][1] * Buffer_Receive_Coord[1 * nVertexR + iVertex] +
-                                rotMatrix[1][2] * Buffer_Receive_Coord[2 * nVertexR + iVertex]);
-                            newCoord[2] = (rotMatrix[2][0] * Buffer_Receive_Coord[0 * nVertexR + iVertex] +
-                                rotMatrix[2][1] * Buffer_Receive_Coord[1 * nVertexR + iVertex] +
-                                rotMatrix[2][2] * Buffer_Receive_Coord[2 * nVertexR + iVertex]);
-                        }
+            if (HaloExchange == NULL) SetHalo_Exchange(config);
 
-                        /*--- Copy transformed coordinates back into buffer. ---*/
-                        for (iDim = 0; iDim < nDim; iDim++)
-                            node[iPoint]->SetCoord(iDim, newCoord[iDim]);
+            /*--- Copy the coordinates that should be sended ---*/
+            Buffer_Send_Coord = HaloExchange->GetSendBuffer(nDim);
+            for (iSend = 0; iSend < HaloExchange->GetNumSend(); iSend++)
+            {
+                iPoint = HaloExchange->GetSendPoint(iSend);
+                Coord = node[iPoint]->GetCoord();
+                for (iDim = 0; iDim < nDim; iDim++)
+                    Buffer_Send_Coord[iSend*nDim + iDim] = Coord[iDim];
+            }
 
-                    }
+            /*--- All the messages at once, rotated for the periodic points ---*/
+            HaloExchange->Start(nDim);
+            Buffer_Receive_Coord = HaloExchange->Finish(nDim, true);
 
-                    /*--- Deallocate receive buffer. ---*/
-                    delete[] Buffer_Receive_Coord;
-                }
+            for (iReceive = 0; iReceive < HaloExchange->GetNumRecv(); iReceive++)
+            {
+                iPoint = HaloExchange->GetRecvPoint(iReceive);
+                for (iDim = 0; iDim < nDim; iDim++)
+                    node[iPoint]->SetCoord(iDim, Buffer_Receive_Coord[iReceive*nDim + iDim]);
             }
-            delete[] newCoord;
         }
 
         void GEOM_GeometryPhysical::Set_MPI_GridVel(TBOX::TBOX_Config *config) 
         {
-            unsigned short iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-            unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_vector, nBufferR_vector;
-            double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi, *Buffer_Receive_GridVel = NULL, *Buffer_Send_GridVel = NULL, *GridVel = NULL, *newGridVel = NULL;
-
-            newGridVel = new double[nDim];
+            unsigned short iDim;
+            unsigned long iSend, iReceive, iPoint;
+            double *Buffer_Send_GridVel, *GridVel;
+            const double *Buffer_Receive_GridVel;
 
-#ifdef HAVE_MPI
-            int send_to, receive_from;
-            MPI_Status status;
-#endif
+            if (HaloExchange == NULL) SetHalo_Exchange(config);
 
-            for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+            /*--- Copy the grid velocity that should be sended ---*/
+            Buffer_Send_GridVel = HaloExchange->GetSendBuffer(nDim);
+            for (iSend = 0; iSend < HaloExchange->GetNumSend(); iSend++)
             {
-                if ((config->GetMarker_All_KindBC(iMarker) == TBOX::SEND_RECEIVE) &&
-                    (config->GetMarker_All_SendRecv(iMarker) > 0)) 
-                {
-                    MarkerS = iMarker;  MarkerR = iMarker + 1;
-
-#ifdef HAVE_MPI
-                    send_to = config->GetMarker_All_SendRecv(MarkerS) - 1;
-                    receive_from = abs(config->GetMarker_All_SendRecv(MarkerR)) - 1;
-#endif
-
-                    nVertexS = nVertex[MarkerS];  nVertexR = nVertex[MarkerR];
-                    nBufferS_vector = nVertexS*nDim;        
-                    nBufferR_vector = nVertexR*nDim;
-
-                    /*--- Allocate Receive and send buffers  ---*/
-
-                    Buffer_Receive_GridVel = new double[nBufferR_vector];
-                    Buffer_Send_GridVel = new double[nBufferS_vector];
-
-                    /*--- Copy the grid velocity that should be sended ---*/
-
-                    for (iVertex = 0; iVertex < nVertexS; iVertex++) 
-                    {
-                        iPoint = vertex[MarkerS][iVertex]->GetNode();
-                        GridVel = node[iPoint]->GetGridVel();
-                        for (iDim = 0; iDim < nDim; iDim++)
-                            Buffer_Send_GridVel[iDim*nVertexS + iVertex] = GridVel[iDim];
-                    }
-
-#ifdef HAVE_MPI
-                    /*--- Send/Receive information using Sendrecv ---*/
-                    MPI_Sendrecv(Buffer_Send_GridVel, nBufferS_std::vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_GridVel, nBufferR_std::vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-#else
-
-                    /*--- Receive information without MPI ---*/
-                    for (iVertex = 0; iVertex < nVertexR; iVertex++) 
-                    {
-                        for (iDim = 0; iDim < nDim; iDim++)
-                            Buffer_Receive_GridVel[iDim*nVertexR + iVertex] = Buffer_Send_GridVel[iDim*nVertexR + iVertex];
-                    }
-
-#endif
-
-                    /*--- Deallocate send buffer ---*/
-                    delete[] Buffer_Send_GridVel;
-
-                    /*--- Do the coordinate transformation ---*/
-                    for (iVertex = 0; iVertex < nVertexR; iVertex++) 
-                    {
-
-                        /*--- Find point and its type of transformation ---*/
-                        iPoint = vertex[MarkerR][iVertex]->GetNode();
-                        iPeriodic_Index = vertex[MarkerR][iVertex]->GetRotation_Type();
-
-                        /*--- Retrieve the supplied periodic information. ---*/
-
-                        angles = config->GetPeriodicRotation(iPeriodic_Index);
-
-                        /*--- Store angles separately for clarity. ---*/
-                        theta = angles[0];   phi = angles[1];     psi = angles[2];
-                        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-                        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-
-                        /*--- Compute the rotation matrix. Note that the implicit
-                        ordering is rotation about the x-axis, y-axis,
-                        then z-axis. Note that this is the transpose of the matrix
-                        used during the preprocessing stage. ---*/
-
-                        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-                        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-                        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-
-                        /*--- Copy grid velocity before performing transformation. ---*/
-
-                        for (iDim = 0; iDim < nDim; iDim++)
-                            newGridVel[iDim] = Buffer_Receive_GridVel[iDim*nVertexR + iVertex];
-
-                        if (nDim == 2) 
-                        {
-                            newGridVel[0] = (rotMatrix[0][0] * Buffer_Receive_GridVel[0 * nVertexR + iVertex] +
-                                rotMatrix[0][1] * Buffer_Receive_GridVel[1 * nVertexR + iVertex]);
-                            newGridVel[1] = (rotMatrix[1][0] * Buffer_Receive_GridVel[0 * nVertexR + iVertex] +
-                                rotMatrix[1][1] * Buffer_Receive_GridVel[1 * nVertexR + iVertex]);
-                        }
-                        else 
-                        {
-                            newGridVel[0] = (rotMatrix[0][0] * Buffer_Receive_GridVel[0 * nVertexR + iVertex] +
-                                rotMatrix[0][1] * Buffer_Receive_GridVel[1 * nVertexR + iVertex] +
-                                rotMatrix[0][2] * Buffer_Receive_GridVel[2 * nVertexR + iVertex]);
-                            newGridVel[1] = (rotMatrix[1][0] * Buffer_Receive_GridVel[0 * nVertexR + iVertex] +
-                                rotMatrix[1][1] * Buffer_Receive_GridVel[1 * nVertexR + iVertex] +
-                                rotMatrix[1][2] * Buffer_Receive_GridVel[2 * nVertexR + iVertex]);
-                            newGridVel[2] = (rotMatrix[2][0] * Buffer_Receive_GridVel[0 * nVertexR + iVertex] +
-                                rotMatrix[2][1] * Buffer_Receive_GridVel[1 * nVertexR + iVertex] +
-                                rotMatrix[2][2] * Buffer_Receive_GridVel[2 * nVertexR + iVertex]);
-                        }
-
-                        /*--- Copy transformed grid velocity back into buffer. ---*/
-                        for (iDim = 0; iDim < nDim; iDim++)
-                            node[iPoint]->SetGridVel(iDim, newGridVel[iDim]);
-
-                    }
+                iPoint = HaloExchange->GetSendPoint(iSend);
+                GridVel = node[iPoint]->GetGridVel();
+                for (iDim = 0; iDim < nDim; iDim++)
+                    Buffer_Send_GridVel[iSend*nDim + iDim] = GridVel[iDim];
+            }
 
-                    /*--- Deallocate receive buffer ---*/
+            /*--- All the messages at once, rotated for the periodic points ---*/
+            HaloExchange->Start(nDim);
+            Buffer_Receive_GridVel = HaloExchange->Finish(nDim, true);
 
-                    delete[] Buffer_Receive_GridVel;
-                }
+            for (iReceive = 0; iReceive < HaloExchange->GetNumRecv(); iReceive++)
+            {
+                iPoint = HaloExchange->GetRecvPoint(iReceive);
+                for (iDim = 0; iDim < nDim; iDim++)
+                    node[iPoint]->SetGridVel(iDim, Buffer_Receive_GridVel[iReceive*nDim + iDim]);
             }
-            delete[] newGridVel;
         }
 
         void GEOM_GeometryPhysical::SetPeriodicBoundary(TBOX::TBOX_Config *config) 
         {
-            unsigned short iMarker, jMarker, kMarker = 0, iPeriodic, iDim, nPeriodic = 0, VTK_Type;
+            unsigned short iMarker, jMarker, iPeriodic, iDim, nPeriodic = 0, VTK_Type;
             unsigned long iNode, iIndex, iVertex, iPoint, iElem, kElem;
             unsigned long jElem, kPoint = 0, jVertex = 0, jPoint = 0, pPoint = 0, nPointPeriodic, newNodes[4] = { 0, 0, 0, 0 };
             std::vector<unsigned long>::iterator IterElem, IterPoint[TBOX::MAX_NUMBER_PERIODIC][2];
-            double *center, *angles, rotMatrix[3][3] = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 } },
-                translation[3], *trans, theta, phi, psi, cosTheta, sinTheta, cosPhi, sinPhi, cosPsi, sinPsi,
-                dx, dy, dz, rotCoord[3], epsilon = 1e-10, mindist = 1e6, *Coord_i, *Coord_j, dist = 0.0;
-            bool isBadMatch = false;
+            double *center, *angles, *trans, epsilon = 1e-10;
+            const unsigned long nBadMatch_Print = 10, noPoint = (unsigned long)(-1);
 
             /*--- Check this dimensionalization ---*/
             std::vector<unsigned long> OldBoundaryElems[100];
@@ -8360,114 +8196,49 @@ namespace ARIES
                     angles = config->GetPeriodicRotAngles(config->GetMarker_All_TagBound(iMarker));
                     trans = config->GetPeriodicTranslation(config->GetMarker_All_TagBound(iMarker));
 
-                    /*--- Store (center+trans) as it is constant and will be added on. ---*/
-                    translation[0] = center[0] + trans[0];
-                    translation[1] = center[1] + trans[1];
-                    translation[2] = center[2] + trans[2];
-
-                    /*--- Store angles separately for clarity. Compute sines/cosines. ---*/
-                    theta = angles[0];
-                    phi = angles[1];
-                    psi = angles[2];
-
-                    cosTheta = cos(theta);  cosPhi = cos(phi);  cosPsi = cos(psi);
-                    sinTheta = sin(theta);  sinPhi = sin(phi);  sinPsi = sin(psi);
-
-                    /*--- Compute the rotation matrix. Note that the implicit
-                    ordering is rotation about the x-axis, y-axis, then z-axis. ---*/
-                    rotMatrix[0][0] = cosPhi*cosPsi;
-                    rotMatrix[1][0] = cosPhi*sinPsi;
-                    rotMatrix[2][0] = -sinPhi;
-
-                    rotMatrix[0][1] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;
-                    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;
-                    rotMatrix[2][1] = sinTheta*cosPhi;
+                    /*--- Transform every point once and look its donor up in a k-d tree
+                    of the donor boundary, instead of comparing all the pairs. ---*/
+                    GeomPeriodicMatcher Matcher(nDim);
+                    Matcher.SetTransformation(center, angles, trans);
 
-                    rotMatrix[0][2] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-                    rotMatrix[1][2] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-                    rotMatrix[2][2] = cosTheta*cosPhi;
-
-                    /*--- Loop through all vertices and find/set the periodic point. ---*/
-                    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) 
+                    std::vector<double> DonorCoord(nVertex[jMarker]*nDim + 1), PeriodicCoord(nVertex[iMarker]*nDim + 1);
+                    for (jVertex = 0; jVertex < nVertex[jMarker]; jVertex++)
+                    {
+                        jPoint = vertex[jMarker][jVertex]->GetNode();
+                        for (iDim = 0; iDim < nDim; iDim++) DonorCoord[jVertex*nDim + iDim] = node[jPoint]->GetCoord(iDim);
+                    }
+                    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
                     {
-
-                        /*--- Retrieve node information for this boundary point. ---*/
                         iPoint = vertex[iMarker][iVertex]->GetNode();
-                        Coord_i = node[iPoint]->GetCoord();
-
-                        /*--- Get the position std::vector from rot center to point. ---*/
-                        dx = Coord_i[0] - center[0];
-                        dy = Coord_i[1] - center[1];
-                        if (nDim == 3) 
-                        {
-                            dz = Coord_i[2] - center[2];
-                        }
-                        else {
-                            dz = 0.0;
-                        }
-
-                        /*--- Compute transformed point coordinates. ---*/
-                        rotCoord[0] = rotMatrix[0][0] * dx
-                            + rotMatrix[0][1] * dy
-                            + rotMatrix[0][2] * dz + translation[0];
-
-                        rotCoord[1] = rotMatrix[1][0] * dx
-                            + rotMatrix[1][1] * dy
-                            + rotMatrix[1][2] * dz + translation[1];
-
-                        rotCoord[2] = rotMatrix[2][0] * dx
-                            + rotMatrix[2][1] * dy
-                            + rotMatrix[2][2] * dz + translation[2];
-
-                        /*--- Perform a search to find the closest donor point. ---*/
-                        mindist = 1e10;
-                        for (jVertex = 0; jVertex < nVertex[jMarker]; jVertex++) 
-                        {
-                            /*--- Retrieve information for this jPoint. ---*/
-                            jPoint = vertex[jMarker][jVertex]->GetNode();
-                            Coord_j = node[jPoint]->GetCoord();
+                        for (iDim = 0; iDim < nDim; iDim++) PeriodicCoord[iVertex*nDim + iDim] = node[iPoint]->GetCoord(iDim);
+                    }
 
-                            /*--- Check the distance between the computed periodic
-                            location and this jPoint. ---*/
-                            dist = 0.0;
-                            for (iDim = 0; iDim < nDim; iDim++) 
-                            {
-                                dist += (Coord_j[iDim] - rotCoord[iDim])*(Coord_j[iDim] - rotCoord[iDim]);
-                            }
-                            dist = sqrt(dist);
-
-                            /*---  Store vertex information if this is the closest
-                            point found thus far. ---*/
-                            if (dist < mindist) 
-                            { 
-                                mindist = dist; 
-                                pPoint = jPoint; }
-                        }
+                    Matcher.Match(nVertex[jMarker], &DonorCoord[0], nVertex[iMarker], &PeriodicCoord[0], epsilon);
 
-                        /*--- Set the periodic point for this iPoint. ---*/
+                    /*--- Set the periodic point of every vertex. ---*/
+                    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+                    {
+                        if (Matcher.GetDonor(iVertex) < nVertex[jMarker])
+                            pPoint = vertex[jMarker][Matcher.GetDonor(iVertex)]->GetNode();
                         vertex[iMarker][iVertex]->SetDonorPoint(pPoint, TBOX::MASTER_NODE);
-
-                        /*--- Print warning if the nearest point was not within
-                        the specified tolerance. Computation will continue. ---*/
-                        if (mindist > epsilon) 
-                        {
-                            isBadMatch = true;
-                            std::cout.precision(10);
-                            std::cout << std::endl;
-                            std::cout << "   Bad match for point " << iPoint << ".\tNearest";
-                            std::cout << " donor distance: " << std::scientific << mindist << ".";
-                        }
                     }
 
-                    /*--- Print final warning when finding bad matches. ---*/
-                    if (isBadMatch) 
+                    /*--- Tolerance report; the first bad matches are listed. Computation will continue. ---*/
+                    Matcher.Print(std::cout);
+                    if (Matcher.GetNumBadMatch() > 0)
                     {
-                        std::cout << std::endl;
+                        unsigned long nBadMatch = 0;
+                        std::cout.precision(10);
+                        for (iVertex = 0; iVertex < nVertex[iMarker] && nBadMatch < nBadMatch_Print; iVertex++)
+                            if (Matcher.IsBadMatch(iVertex))
+                            {
+                                std::cout << "   Bad match for point " << vertex[iMarker][iVertex]->GetNode() << ".\tNearest";
+                                std::cout << " donor distance: " << std::scientific << Matcher.GetDistance(iVertex) << "." << std::endl;
+                                nBadMatch++;
+                            }
                         std::cout << "\n !!! Warning !!!" << std::endl;
-                        std::cout << "Bad matches found. Computation will continue, but be cautious.\n";
+                        std::cout << "Bad matches found. Computation will continue, but be cautious.\n" << std::endl;
                     }
-                    std::cout << std::endl;
-                    isBadMatch = false;
                 }
 
             /*--- Create a std::vector to identify the points that belong to each periodic boundary condition ---*/
@@ -8562,54 +8333,42 @@ namespace ARIES
                 }
             }
 
-            /*--- Check all SEND points to see if they also lie on another boundary. ---*/
-            for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) 
+            /*--- Flag the SEND points of the mirrored boundaries, and the point each
+            SEND point and each periodic point is replaced by in a new element. ---*/
+            bool *MirrorSend = new bool[nPoint];
+            unsigned long *NewPoint = new unsigned long[nPoint];
+            for (iPoint = 0; iPoint < nPoint; iPoint++)
             {
-                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) 
-                {
-                    /*--- iPoint is a node that lies on the current marker. ---*/
-                    iPoint = vertex[iMarker][iVertex]->GetNode();
-
-                    /*--- Search through SEND points to check for iPoint. ---*/
-                    for (iPeriodic = 1; iPeriodic <= nPeriodic; iPeriodic++) 
-                    {
-                        if (CreateMirror[iPeriodic]) 
-                        {
-                            /*--- jPoint is the SEND point. ---*/
-                            for (iElem = 0; iElem < PeriodicPoint[iPeriodic][0].size(); iElem++)
-                            {
-                                jPoint = PeriodicPoint[iPeriodic][0][iElem];
+                MirrorSend[iPoint] = false;
+                NewPoint[iPoint] = noPoint;
+            }
 
-                                /*--- If the two match, then jPoint lies on this boundary.
-                                However, we are concerned with the new points, so we
-                                will store kPoint instead. ---*/
-                                if (iPoint == jPoint) 
-                                {
-                                    //              kPoint = PeriodicPoint[iPeriodic][1][iElem];
+            for (iPeriodic = 1; iPeriodic <= nPeriodic; iPeriodic++)
+                for (kElem = 0; kElem < PeriodicPoint[iPeriodic][0].size(); kElem++)
+                {
+                    jPoint = PeriodicPoint[iPeriodic][0][kElem];
+                    if (CreateMirror[iPeriodic]) MirrorSend[jPoint] = true;
+                    NewPoint[jPoint] = PeriodicPoint[iPeriodic][1][kElem];
+                }
 
-                                    /*--- We also want the type of boundary element that this point
-                                    was within, so that we know what type of element to add
-                                    built from the new points. ---*/
-                                    bool isJPoint, isPeriodic;
-                                    for (jElem = 0; jElem < nElem_Bound[iMarker]; jElem++) 
-                                    {
-                                        isJPoint = false; isPeriodic = false;
-                                        for (iNode = 0; iNode < bound[iMarker][jElem]->GetnNodes(); iNode++) 
-                                        {
-                                            if (bound[iMarker][jElem]->GetNode(iNode) == jPoint) isJPoint = true;
-                                            if (PeriodicBC[bound[iMarker][jElem]->GetNode(iNode)]) isPeriodic = true;
-                                        }
+            for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+                if (config->GetMarker_All_KindBC(iMarker) == TBOX::PERIODIC_BOUNDARY)
+                    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+                        NewPoint[vertex[iMarker][iVertex]->GetNode()] = vertex[iMarker][iVertex]->GetDonorPoint();
 
-                                        /*--- If both points were found, store this element. ---*/
-                                        if (isJPoint && isPeriodic) 
-                                        {
-                                            OldBoundaryElems[iMarker].push_back(jElem);
-                                        }
-                                    }
-                                }
-                            }
-                        }
+            /*--- Boundary elements with a SEND point and a periodic point must be
+            added, built from the new points. ---*/
+            for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+            {
+                for (jElem = 0; jElem < nElem_Bound[iMarker]; jElem++)
+                {
+                    bool isSend = false, isPeriodic = false;
+                    for (iNode = 0; iNode < bound[iMarker][jElem]->GetnNodes(); iNode++)
+                    {
+                        if (MirrorSend[bound[iMarker][jElem]->GetNode(iNode)]) isSend = true;
+                        if (PeriodicBC[bound[iMarker][jElem]->GetNode(iNode)]) isPeriodic = true;
                     }
+                    if (isSend && isPeriodic) OldBoundaryElems[iMarker].push_back(jElem);
                 }
             }
 
@@ -8641,37 +8400,9 @@ namespace ARIES
                     {
                         pPoint = bound[iMarker][jElem]->GetNode(iNode);
 
-                        /*--- Check if this node is a send point. If so, the corresponding
-                        receive point will be used in making the new boundary element. ---*/
-                        for (iPeriodic = 1; iPeriodic <= nPeriodic; iPeriodic++) 
-                        {
-                            for (kElem = 0; kElem < PeriodicPoint[iPeriodic][0].size(); kElem++) 
-                            {
-                                if (pPoint == PeriodicPoint[iPeriodic][0][kElem]) newNodes[iNode] = PeriodicPoint[iPeriodic][1][kElem];
-                            }
-                        }
-
-                        /*--- Check if this node is a periodic point. If so, the corresponding
-                        periodic point will be used in making the new boundary element. ---*/
-                        if (PeriodicBC[pPoint]) 
-                        {
-                            /*--- Find the corresponding periodic point. ---*/
-                            for (jMarker = 0; jMarker < config->GetnMarker_All(); jMarker++) 
-                            {
-                                if (config->GetMarker_All_KindBC(jMarker) == TBOX::PERIODIC_BOUNDARY) 
-                                {
-                                    for (iVertex = 0; iVertex < nVertex[jMarker]; iVertex++) 
-                                    {
-                                        if (pPoint == vertex[jMarker][iVertex]->GetNode()) 
-                                        { 
-                                            kMarker = jMarker; 
-                                            jVertex = iVertex; 
-                                        }
-                                    }
-                                }
-                            }
-                            newNodes[iNode] = vertex[kMarker][jVertex]->GetDonorPoint();
-                        }
+                        /*--- A SEND point is replaced by its receive point and a periodic
+                        point by its donor. ---*/
+                        if (NewPoint[pPoint] != noPoint) newNodes[iNode] = NewPoint[pPoint];
                     }
 
                     /*--- Now instantiate the new element. ---*/
@@ -8692,6 +8423,8 @@ namespace ARIES
             }
 
             delete[] PeriodicBC;
+            delete[] MirrorSend;
+            delete[] NewPoint;
         }
 
         void GEOM_GeometryPhysical::FindNormal_Neighbor(TBOX::TBOX_Config *config) 
@@ -16,9 +16,18 @@
 
 #include "../Common/TBOX_Config.hpp"
 #include "GEOM_Geometry.hpp"
+#include "GeomZoneTransfer.hpp"
+#include "GeomMeshQuality.hpp"
+#include "GeomAdjacency.hpp"
+#include "GeomFaceMap.hpp"
+#include "GeomEdgeColoring.hpp"
+#include "GeomGradient.hpp"
+#include "GeomBoundaryFaces.hpp"
 
 namespace ARIES
 {
+    class GeomHaloExchange;
+
     namespace GEOM
     {
         class GEOM_GeometryPhysical : public GEOM_Geometry
@@ -170,6 +179,52 @@ namespace ARIES
              */
             void SetElement_Connectivity(void);
 
+            /*!
+             * \brief Order, block and color the edges for threaded edge loops, once the edges exist.
+             * \param[in] val_blockSize - Largest number of edges of a block.
+             */
+            void SetEdge_Coloring(unsigned long val_blockSize = 512);
+
+            /*!
+             * \brief Edge permutation and ranges of the colors, available after SetEdge_Coloring.
+             */
+            const GeomEdgeColoring& GetEdgeColoring(void) const { return EdgeColoring; }
+
+            /*!
+             * \brief Copy the dual grid (coordinates, volumes, edge and boundary normals) into the gradient engine;
+             *        with ARIES_BENCHMARK set in the environment, the gradients are also timed.
+             * \param[in] config - Definition of the particular problem.
+             */
+            void SetGradient_Engine(TBOX::TBOX_Config *config);
+
+            /*!
+             * \brief Green-Gauss and least-squares gradients, available after SetGradient_Engine.
+             */
+            const GeomGradient& GetGradient_Engine(void) const { return Gradient; }
+
+            /*!
+             * \brief Boundary vertices with their normals, unit normals and areas in flat per-marker arrays,
+             *        in the order of vertex[iMarker][iVertex]; filled by SetBoundControlVolume.
+             */
+            const GeomBoundaryFaces& GetBoundary_Faces(void) const { return BoundaryFaces; }
+
+            /*!
+             * \brief Save the preprocessed dual grid of this rank (adjacency, edges, control volumes,
+             *        boundary vertices and wall distance) next to the mesh file.
+             * \param[in] config - Definition of the particular problem.
+             */
+            void WriteGeometry_Cache(TBOX::TBOX_Config *config);
+
+            /*!
+             * \brief Restore the dual grid saved by WriteGeometry_Cache, in place of SetPoint_Connectivity,
+             *        SetEdges, SetControlVolume and ComputeWall_Distance; SetVertex and SetBoundControlVolume
+             *        are cheap and run on the restored grid.
+             *        The cache is only used if it was written from the same mesh file with the same partition.
+             * \param[in] config - Definition of the particular problem.
+             * \return <i>true</i> if the geometry was restored; otherwise it is untouched and must be rebuilt.
+             */
+            bool ReadGeometry_Cache(TBOX::TBOX_Config *config);
+
             /*!
              * \brief Set the volume element associated to each boundary element.
              */
@@ -200,6 +255,15 @@ namespace ARIES
              */
             void VisualizeControlVolume(TBOX::TBOX_Config *config, unsigned short action);
 
+            /*!
+             * \brief Set, for every owned point of the target markers, the closest owned point of the donor markers of any rank.
+             * \param[in] config - Definition of the particular problem.
+             * \param[in] val_kindDonor - Kind of boundary condition of the donor markers.
+             * \param[in] val_kindTarget - Kind of boundary condition of the target markers.
+             * \param[in] val_epsilon - Largest distance of a good match.
+             */
+            void MatchMarker_Points(TBOX::TBOX_Config *config, unsigned short val_kindDonor, unsigned short val_kindTarget, double val_epsilon);
+
             /*!
              * \brief Mach the near field boundary condition.
              * \param[in] config - Definition of the particular problem.
@@ -227,6 +291,23 @@ namespace ARIES
             void MatchZone(TBOX::TBOX_Config *config, GEOM_Geometry *geometry_donor, TBOX::TBOX_Config *config_donor,
                 unsigned short val_iZone, unsigned short val_nZone);
 
+            /*!
+             * \brief Owned boundary points of a zone and the boundary elements made of them only.
+             * \param[in] geometry - Geometry of the zone.
+             * \param[in] config - Definition of the problem of the zone.
+             * \param[out] val_point - Boundary points.
+             * \param[out] val_coord - Coordinates of the boundary points.
+             * \param[out] val_elemPtr - CSR offsets of the boundary elements.
+             * \param[out] val_elemNode - Nodes of the boundary elements, as positions in val_point.
+             */
+            void SetZone_Surface(GEOM_Geometry *geometry, TBOX::TBOX_Config *config, std::vector<unsigned long> &val_point,
+                                 std::vector<double> &val_coord, std::vector<unsigned long> &val_elemPtr, std::vector<unsigned long> &val_elemNode);
+
+            /*!
+             * \brief Interpolation operator from the donor zone, built by MatchZone.
+             */
+            GeomZoneTransfer* GetZoneTransfer(void) { return ZoneTransfer; }
+
             /*!
              * \brief Set boundary vertex structure of the control volume.
              * \param[in] config - Definition of the particular problem.
@@ -284,6 +365,18 @@ namespace ARIES
              */
             void SetColorGrid_Parallel(TBOX::TBOX_Config *config);
 
+            /*!
+             * \brief Set the compute and memory weights of the local nodes for the partitioning.
+             * \param[out] val_weight - Weights, <i>val_weight[2*iPoint]</i> compute and <i>val_weight[2*iPoint+1]</i> memory.
+             */
+            void SetPartition_Weight(std::vector<double> &val_weight);
+
+            /*!
+             * \brief Write the wall time and the element mix of every rank to the timing file read by SetPartition_Weight.
+             * \param[in] val_time - Wall time of the solver on this rank.
+             */
+            void SetPartition_Timing(double val_time);
+
             /*!
              * \brief Set the rotational velocity at each node.
              * \param[in] config - Definition of the particular problem.
@@ -296,6 +389,17 @@ namespace ARIES
              */
             void SetGridVelocity(TBOX::TBOX_Config *config, unsigned long iter);
 
+            /*!
+             * \brief Set up the persistent exchange of the SEND_RECEIVE markers, with the periodic rotations.
+             * \param[in] config - Definition of the particular problem.
+             */
+            void SetHalo_Exchange(TBOX::TBOX_Config *config);
+
+            /*!
+             * \brief Halo exchange of any point field, NULL until SetHalo_Exchange (or the first MPI communication).
+             */
+            GeomHaloExchange* GetHaloExchange(void) { return HaloExchange; }
+
             /*!
              * \brief Perform the MPI communication for the grid coordinates (dynamic meshes).
              * \param[in] config - Definition of the particular problem.
@@ -330,11 +434,24 @@ namespace ARIES
             void SetMeshFile(TBOX::TBOX_Config *config, std::string val_mesh_out_filename);
 
             /*!
-             * \brief Compute some parameters about the grid quality.
-             * \param[out] statistics - Information about the grid quality, statistics[0] = (r/R)_min, statistics[1] = (r/R)_ave.
+             * \brief Compute some parameters about the grid quality over all the ranks (collective).
+             * \param[out] statistics - Information about the grid quality, statistics[0] = maximum skewness,
+             *            statistics[1] = mean skewness, statistics[2] = maximum aspect ratio, statistics[3] = maximum
+             *            volume ratio, statistics[4] = maximum non-orthogonality (degrees), statistics[5] = number of
+             *            degenerate elements and non-positive control volumes.
              */
             void GetQualityStatistics(double *statistics);
 
+            /*!
+             * \brief Histograms of the grid quality, available after GetQualityStatistics.
+             */
+            GeomMeshQuality* GetMeshQuality(void) { return MeshQuality; }
+
+            /*!
+             * \brief Face-to-element and element-to-face maps, available after SetElement_Connectivity.
+             */
+            const GeomFaceMap& GetFaceMap(void) const { return FaceMap; }
+
             /*!
              * \brief Find and store all vertices on a sharp corner in the geometry.
              * \param[in] config - Definition of the particular problem.
@@ -487,6 +604,15 @@ namespace ARIES
 
  
 
+        protected:
+            GeomZoneTransfer *ZoneTransfer;     /*!< \brief Interpolation operator from the donor zone. */
+            GeomMeshQuality *MeshQuality;       /*!< \brief Cached grid quality metrics. */
+            GeomAdjacency Adjacency;            /*!< \brief Point-to-element and point-to-point maps read by the points. */
+            GeomFaceMap FaceMap;                /*!< \brief Unique faces of the elements, built by SetElement_Connectivity. */
+            GeomHaloExchange *HaloExchange;     /*!< \brief Persistent exchange of the send/receive halos. */
+            GeomEdgeColoring EdgeColoring;      /*!< \brief Cache-blocked, colored order of the edges. */
+            GeomGradient Gradient;              /*!< \brief Gradients of point fields on the dual grid. */
+            GeomBoundaryFaces BoundaryFaces;    /*!< \brief Flat table of the boundary vertices, normals and areas. */
         };
     }
 }
@@ -0,0 +1,160 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Flat point-to-element and point-to-point adjacency of the primal grid
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomAdjacency.hpp"
+
+#include "const_def.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace ARIES
+{
+    static const unsigned short Adjacency_LineEdge[1][2] = { {0,1} };
+    static const unsigned short Adjacency_TriaEdge[3][2] = { {0,1}, {1,2}, {2,0} };
+    static const unsigned short Adjacency_QuadEdge[4][2] = { {0,1}, {1,2}, {2,3}, {3,0} };
+    static const unsigned short Adjacency_TetrEdge[6][2] = { {0,1}, {1,2}, {2,0}, {0,3}, {1,3}, {2,3} };
+    static const unsigned short Adjacency_HexaEdge[12][2] = { {0,1}, {1,2}, {2,3}, {3,0}, {4,5}, {5,6}, {6,7}, {7,4}, {0,4}, {1,5}, {2,6}, {3,7} };
+    static const unsigned short Adjacency_PrisEdge[9][2] = { {0,1}, {1,2}, {2,0}, {3,4}, {4,5}, {5,3}, {0,3}, {1,4}, {2,5} };
+    static const unsigned short Adjacency_PyraEdge[8][2] = { {0,1}, {1,2}, {2,3}, {3,0}, {0,4}, {1,4}, {2,4}, {3,4} };
+
+    GeomAdjacency::GeomAdjacency()
+    {
+    }
+
+    GeomAdjacency::~GeomAdjacency()
+    {
+    }
+
+    unsigned short GeomAdjacency::GetElemEdge(unsigned short val_vtkType, const unsigned short (*&val_edge)[2])
+    {
+        switch (val_vtkType)
+        {
+        case LINE:        val_edge = Adjacency_LineEdge; return 1;
+        case TRIANGLE:    val_edge = Adjacency_TriaEdge; return 3;
+        case RECTANGLE:   val_edge = Adjacency_QuadEdge; return 4;
+        case TETRAHEDRON: val_edge = Adjacency_TetrEdge; return 6;
+        case HEXAHEDRON:  val_edge = Adjacency_HexaEdge; return 12;
+        case PRISM:       val_edge = Adjacency_PrisEdge; return 9;
+        case PYRAMID:     val_edge = Adjacency_PyraEdge; return 8;
+        default:          val_edge = NULL; return 0;
+        }
+    }
+
+    void GeomAdjacency::Clear()
+    {
+        vector<unsigned long>().swap(d_elemPtr);
+        vector<unsigned long>().swap(d_elem);
+        vector<unsigned long>().swap(d_pointPtr);
+        vector<unsigned long>().swap(d_point);
+        vector<long>().swap(d_edge);
+    }
+
+    void GeomAdjacency::Set(unsigned long val_numPoint, const unsigned long* val_elemPtr, const unsigned long* val_elem,
+                            const unsigned long* val_pointPtr, const unsigned long* val_point, const long* val_edge)
+    {
+        d_elemPtr.assign(val_elemPtr, val_elemPtr + val_numPoint + 1);
+        d_elem.assign(val_elem, val_elem + d_elemPtr[val_numPoint]);
+        d_pointPtr.assign(val_pointPtr, val_pointPtr + val_numPoint + 1);
+        d_point.assign(val_point, val_point + d_pointPtr[val_numPoint]);
+        d_edge.assign(val_edge, val_edge + d_pointPtr[val_numPoint]);
+    }
+
+    void GeomAdjacency::Build(unsigned long val_numPoint, unsigned long val_numElem, const unsigned short* val_vtkType,
+                              const unsigned long* val_elemPtr, const unsigned long* val_elemNode)
+    {
+        long iElem, iPoint;
+        unsigned long iNode;
+
+        /*--- Point to element: count, offsets, fill ---*/
+        d_elemPtr.assign(val_numPoint + 1, 0);
+
+#pragma omp parallel for schedule(static) private(iNode)
+        for (iElem = 0; iElem < (long)val_numElem; iElem++)
+        {
+            for (iNode = val_elemPtr[iElem]; iNode < val_elemPtr[iElem + 1]; iNode++)
+            {
+#pragma omp atomic
+                d_elemPtr[val_elemNode[iNode] + 1]++;
+            }
+        }
+
+        for (iPoint = 0; iPoint < (long)val_numPoint; iPoint++) d_elemPtr[iPoint + 1] += d_elemPtr[iPoint];
+
+        d_elem.resize(d_elemPtr[val_numPoint]);
+        vector<unsigned long> fill(d_elemPtr.begin(), d_elemPtr.end() - 1);
+
+#pragma omp parallel for schedule(static) private(iNode)
+        for (iElem = 0; iElem < (long)val_numElem; iElem++)
+        {
+            for (iNode = val_elemPtr[iElem]; iNode < val_elemPtr[iElem + 1]; iNode++)
+            {
+                unsigned long position;
+#pragma omp atomic capture
+                position = fill[val_elemNode[iNode]]++;
+                d_elem[position] = iElem;
+            }
+        }
+
+        /*--- The threads fill the rows in any order ---*/
+#pragma omp parallel for schedule(static)
+        for (iPoint = 0; iPoint < (long)val_numPoint; iPoint++)
+            sort(d_elem.begin() + d_elemPtr[iPoint], d_elem.begin() + d_elemPtr[iPoint + 1]);
+
+        /*--- Point to point: count the distinct neighbors, offsets, fill ---*/
+        d_pointPtr.assign(val_numPoint + 1, 0);
+
+        for (unsigned short iPass = 0; iPass < 2; iPass++)
+        {
+            if (iPass == 1)
+            {
+                for (iPoint = 0; iPoint < (long)val_numPoint; iPoint++) d_pointPtr[iPoint + 1] += d_pointPtr[iPoint];
+                d_point.resize(d_pointPtr[val_numPoint]);
+            }
+
+#pragma omp parallel
+            {
+                vector<unsigned long> neighbor;
+
+#pragma omp for schedule(dynamic, 1024)
+                for (iPoint = 0; iPoint < (long)val_numPoint; iPoint++)
+                {
+                    neighbor.clear();
+                    for (unsigned long jElem = d_elemPtr[iPoint]; jElem < d_elemPtr[iPoint + 1]; jElem++)
+                    {
+                        unsigned long kElem = d_elem[jElem];
+                        const unsigned long* elemNode = &val_elemNode[val_elemPtr[kElem]];
+                        const unsigned short (*edge)[2];
+                        unsigned short nEdge = GetElemEdge(val_vtkType[kElem], edge);
+
+                        for (unsigned short iEdge = 0; iEdge < nEdge; iEdge++)
+                        {
+                            if (elemNode[edge[iEdge][0]] == (unsigned long)iPoint) neighbor.push_back(elemNode[edge[iEdge][1]]);
+                            else if (elemNode[edge[iEdge][1]] == (unsigned long)iPoint) neighbor.push_back(elemNode[edge[iEdge][0]]);
+                        }
+                    }
+                    sort(neighbor.begin(), neighbor.end());
+                    neighbor.erase(unique(neighbor.begin(), neighbor.end()), neighbor.end());
+
+                    if (iPass == 0) d_pointPtr[iPoint + 1] = neighbor.size();
+                    else copy(neighbor.begin(), neighbor.end(), d_point.begin() + d_pointPtr[iPoint]);
+                }
+            }
+        }
+
+        d_edge.assign(d_point.size(), -1);
+    }
+}
@@ -0,0 +1,112 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Flat point-to-element and point-to-point adjacency of the primal grid
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMADJACENCY_HPP
+#define ARIES_GEOMADJACENCY_HPP
+
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Point-to-element and point-to-point adjacency in CSR storage.
+     *
+     * Both maps are built in two passes over the points: the first one counts
+     * the entries of every row, a prefix sum gives the offsets and the second
+     * one writes the entries in place, so each map lives in two flat arrays
+     * whatever the size of the grid. Rows are sorted in increasing order.
+     * Two points are neighbors if they share an edge of an element (the
+     * diagonals of quadrilateral faces are not edges). Next to the neighbor
+     * list every row has a slot for the index of the edge towards the
+     * neighbor, initialized to -1.
+     */
+    class GeomAdjacency
+    {
+    public:
+        GeomAdjacency();
+        ~GeomAdjacency();
+
+        /*!
+         * \brief Build both maps from the elements.
+         * \param[in] val_numPoint - Number of points.
+         * \param[in] val_numElem - Number of elements.
+         * \param[in] val_vtkType - VTK type of every element.
+         * \param[in] val_elemPtr - CSR offsets of the element nodes (size val_numElem+1).
+         * \param[in] val_elemNode - Nodes of the elements.
+         */
+        void Build(unsigned long val_numPoint, unsigned long val_numElem, const unsigned short* val_vtkType,
+                   const unsigned long* val_elemPtr, const unsigned long* val_elemNode);
+
+        /*!
+         * \brief Restore both maps from arrays saved earlier, e.g. by a GeomGeometryCache.
+         * \param[in] val_numPoint - Number of points.
+         * \param[in] val_elemPtr - CSR offsets of the elements around the points (size val_numPoint+1).
+         * \param[in] val_elem - Elements around the points.
+         * \param[in] val_pointPtr - CSR offsets of the neighbors of the points (size val_numPoint+1).
+         * \param[in] val_point - Neighbors of the points.
+         * \param[in] val_edge - Edge towards every neighbor.
+         */
+        void Set(unsigned long val_numPoint, const unsigned long* val_elemPtr, const unsigned long* val_elem,
+                 const unsigned long* val_pointPtr, const unsigned long* val_point, const long* val_edge);
+
+        /*!
+         * \brief Release the storage.
+         */
+        void Clear();
+
+        unsigned long GetNumPoint() const { return d_elemPtr.empty() ? 0 : d_elemPtr.size() - 1; };
+
+        unsigned long GetNumElem(unsigned long val_iPoint) const { return d_elemPtr[val_iPoint + 1] - d_elemPtr[val_iPoint]; };
+        const unsigned long* GetElem(unsigned long val_iPoint) const { return d_elem.data() + d_elemPtr[val_iPoint]; };
+
+        unsigned long GetNumNeighbor(unsigned long val_iPoint) const { return d_pointPtr[val_iPoint + 1] - d_pointPtr[val_iPoint]; };
+        const unsigned long* GetNeighbor(unsigned long val_iPoint) const { return d_point.data() + d_pointPtr[val_iPoint]; };
+        long* GetEdge(unsigned long val_iPoint) { return d_edge.data() + d_pointPtr[val_iPoint]; };
+
+        /*!
+         * \brief CSR offsets of the point-to-point map, e.g. the xadj array of a graph partitioner.
+         */
+        const vector<unsigned long>& GetNeighborPtr() const { return d_pointPtr; };
+        const vector<unsigned long>& GetNeighborList() const { return d_point; };
+
+        /*!
+         * \brief Flat storage of the point-to-element map and of the edges towards the neighbors.
+         */
+        const vector<unsigned long>& GetElemPtr() const { return d_elemPtr; };
+        const vector<unsigned long>& GetElemList() const { return d_elem; };
+        const vector<long>& GetEdgeList() const { return d_edge; };
+
+        /*!
+         * \brief Edges of an element in terms of its local nodes (VTK ordering).
+         * \param[in] val_vtkType - VTK type of the element.
+         * \param[out] val_edge - Pairs of local nodes, NULL for an unknown type.
+         * \return Number of edges.
+         */
+        static unsigned short GetElemEdge(unsigned short val_vtkType, const unsigned short (*&val_edge)[2]);
+
+    private:
+        vector<unsigned long> d_elemPtr;        /*!< \brief CSR offsets of the elements around the points. */
+        vector<unsigned long> d_elem;           /*!< \brief Elements around the points. */
+        vector<unsigned long> d_pointPtr;       /*!< \brief CSR offsets of the neighbors of the points. */
+        vector<unsigned long> d_point;          /*!< \brief Neighbors of the points. */
+        vector<long> d_edge;                    /*!< \brief Edge towards every neighbor (-1 if not set). */
+    };
+}
+
+#endif
@@ -0,0 +1,242 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Threaded agglomeration of the dual-grid control volumes by rounds of independent seeds
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomAgglomeration.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ARIES
+{
+    /*!
+     * \brief Scrambled index (splitmix64 finalizer), breaks the ties between the keys without a pattern.
+     */
+    static unsigned long long GeomAgglomerationHash(unsigned long long val_index)
+    {
+        unsigned long long hash = val_index + 0x9E3779B97F4A7C15ULL;
+        hash = (hash ^ (hash >> 30))*0xBF58476D1CE4E5B9ULL;
+        hash = (hash ^ (hash >> 27))*0x94D049BB133111EBULL;
+        return hash ^ (hash >> 31);
+    }
+
+    /*!
+     * \brief Strict order of the points of a round: key, then index.
+     */
+    static inline bool GeomAgglomerationGreater(const vector<unsigned long long>& val_key, unsigned long val_iPoint, unsigned long val_jPoint)
+    {
+        return val_key[val_iPoint] > val_key[val_jPoint] || (val_key[val_iPoint] == val_key[val_jPoint] && val_iPoint > val_jPoint);
+    }
+
+    GeomAgglomeration::GeomAgglomeration()
+    {
+        d_childPtr.assign(1, 0);
+        d_numRound = 0;
+    }
+
+    GeomAgglomeration::~GeomAgglomeration()
+    {
+    }
+
+    unsigned long GeomAgglomeration::Agglomerate(unsigned long val_numPoint, const unsigned long* val_pointPtr, const unsigned long* val_point,
+                                                 const unsigned short* val_status, const bool* val_indirect)
+    {
+        long iCandidate, numCandidate;
+        unsigned long iPoint, iCoarse, numCoarse = 0;
+
+        d_parent.assign(val_numPoint, -1);
+        d_indirect.assign(val_numPoint, 0);
+        d_numRound = 0;
+
+        /*--- Points taken in a control volume, before or during the rounds ---*/
+        vector<unsigned char> isTaken(val_numPoint, 0), isSeed(val_numPoint, 0);
+        vector<unsigned long long> key(val_numPoint, 0);
+        vector<long> claim(val_numPoint, -1);
+        vector<unsigned long> candidate, seed;
+
+        for (iPoint = 0; iPoint < val_numPoint; iPoint++)
+        {
+            if (val_status[iPoint] == Status_Agglomerated) isTaken[iPoint] = 1;
+            if (val_status[iPoint] == Status_Free || val_status[iPoint] == Status_IndirectOnly) candidate.push_back(iPoint);
+        }
+
+        while (!candidate.empty())
+        {
+            numCandidate = candidate.size();
+
+            /*--- Keys of the free points: agglomerated neighbors first, as the priority of the queue ---*/
+#pragma omp parallel for schedule(static)
+            for (iCandidate = 0; iCandidate < numCandidate; iCandidate++)
+            {
+                unsigned long jPoint = candidate[iCandidate];
+                unsigned long long numTaken = 0;
+                for (unsigned long iPos = val_pointPtr[jPoint]; iPos < val_pointPtr[jPoint + 1]; iPos++)
+                    numTaken += isTaken[val_point[iPos]];
+                if (numTaken > 0xFFFF) numTaken = 0xFFFF;
+                key[jPoint] = (numTaken << 48) | (GeomAgglomerationHash(jPoint) & 0xFFFFFFFFFFFFULL);
+            }
+
+            /*--- Seeds: the free points with the largest key within two edges ---*/
+#pragma omp parallel for schedule(dynamic, 256)
+            for (iCandidate = 0; iCandidate < numCandidate; iCandidate++)
+            {
+                unsigned long jPoint = candidate[iCandidate], kPoint, lPoint;
+                bool isLargest = (val_status[jPoint] == Status_Free);
+                for (unsigned long iPos = val_pointPtr[jPoint]; iPos < val_pointPtr[jPoint + 1] && isLargest; iPos++)
+                {
+                    kPoint = val_point[iPos];
+                    if (val_status[kPoint] == Status_Free && !isTaken[kPoint] && GeomAgglomerationGreater(key, kPoint, jPoint))
+                        isLargest = false;
+                    for (unsigned long jPos = val_pointPtr[kPoint]; jPos < val_pointPtr[kPoint + 1] && isLargest; jPos++)
+                    {
+                        lPoint = val_point[jPos];
+                        if (lPoint != jPoint && val_status[lPoint] == Status_Free && !isTaken[lPoint] && GeomAgglomerationGreater(key, lPoint, jPoint))
+                            isLargest = false;
+                    }
+                }
+                isSeed[jPoint] = isLargest;
+            }
+
+            /*--- Number the seeds in the order of the points ---*/
+            unsigned long numSeed = 0;
+            for (iCandidate = 0; iCandidate < numCandidate; iCandidate++)
+            {
+                iPoint = candidate[iCandidate];
+                if (!isSeed[iPoint]) continue;
+                d_parent[iPoint] = numCoarse + numSeed;
+                seed.push_back(iPoint);
+                numSeed++;
+            }
+            if (numSeed == 0) break;
+            numCoarse += numSeed;
+            d_numRound++;
+
+            /*--- Every other point looks for a seed: a neighbor, else a seed two edges away through two neighbors ---*/
+#pragma omp parallel
+            {
+                vector<unsigned long> secondSeed;
+
+#pragma omp for schedule(dynamic, 256)
+                for (iCandidate = 0; iCandidate < numCandidate; iCandidate++)
+                {
+                    unsigned long jPoint = candidate[iCandidate], kPoint, lPoint, iPos, jPos;
+                    long best = -1;
+                    claim[jPoint] = -1;
+                    if (isSeed[jPoint]) continue;
+
+                    if (val_status[jPoint] == Status_Free)
+                    {
+                        for (iPos = val_pointPtr[jPoint]; iPos < val_pointPtr[jPoint + 1]; iPos++)
+                        {
+                            kPoint = val_point[iPos];
+                            if (isSeed[kPoint] && (best < 0 || GeomAgglomerationGreater(key, kPoint, best))) best = kPoint;
+                        }
+                    }
+
+                    if (best < 0)
+                    {
+                        secondSeed.clear();
+                        for (iPos = val_pointPtr[jPoint]; iPos < val_pointPtr[jPoint + 1]; iPos++)
+                        {
+                            kPoint = val_point[iPos];
+                            for (jPos = val_pointPtr[kPoint]; jPos < val_pointPtr[kPoint + 1]; jPos++)
+                            {
+                                lPoint = val_point[jPos];
+                                if (lPoint != jPoint && isSeed[lPoint] && val_indirect[lPoint]) secondSeed.push_back(lPoint);
+                            }
+                        }
+                        sort(secondSeed.begin(), secondSeed.end());
+
+                        /*--- A seed reached through two different neighbors, and not a neighbor itself ---*/
+                        for (iPos = 0; iPos + 1 < secondSeed.size(); iPos++)
+                        {
+                            lPoint = secondSeed[iPos];
+                            if (secondSeed[iPos + 1] != lPoint) continue;
+                            bool isNeighbor = false;
+                            for (jPos = val_pointPtr[jPoint]; jPos < val_pointPtr[jPoint + 1]; jPos++)
+                                if (val_point[jPos] == lPoint) isNeighbor = true;
+                            if (!isNeighbor && (best < 0 || GeomAgglomerationGreater(key, lPoint, best))) best = lPoint;
+                            while (iPos + 1 < secondSeed.size() && secondSeed[iPos + 1] == lPoint) iPos++;
+                        }
+                        if (best >= 0) d_indirect[jPoint] = 1;
+                    }
+                    claim[jPoint] = best;
+                }
+            }
+
+            /*--- Join the seeds, then drop the agglomerated points from the candidates ---*/
+#pragma omp parallel for schedule(static)
+            for (iCandidate = 0; iCandidate < numCandidate; iCandidate++)
+            {
+                unsigned long jPoint = candidate[iCandidate];
+                if (claim[jPoint] >= 0) d_parent[jPoint] = d_parent[claim[jPoint]];
+            }
+
+            unsigned long numLeft = 0;
+            for (iCandidate = 0; iCandidate < numCandidate; iCandidate++)
+            {
+                iPoint = candidate[iCandidate];
+                isSeed[iPoint] = 0;
+                if (d_parent[iPoint] >= 0) isTaken[iPoint] = 1;
+                else candidate[numLeft++] = iPoint;
+            }
+            candidate.resize(numLeft);
+        }
+
+        /*--- Points of the coarse control volumes, the seed first ---*/
+        d_childPtr.assign(numCoarse + 1, 0);
+        for (iPoint = 0; iPoint < val_numPoint; iPoint++)
+            if (d_parent[iPoint] >= 0) d_childPtr[d_parent[iPoint] + 1]++;
+        for (iCoarse = 0; iCoarse < numCoarse; iCoarse++) d_childPtr[iCoarse + 1] += d_childPtr[iCoarse];
+
+        vector<unsigned long> position(d_childPtr.begin(), d_childPtr.end() - 1);
+        d_child.resize(d_childPtr[numCoarse]);
+        for (iCoarse = 0; iCoarse < numCoarse; iCoarse++) d_child[position[iCoarse]++] = seed[iCoarse];
+        for (iPoint = 0; iPoint < val_numPoint; iPoint++)
+            if (d_parent[iPoint] >= 0 && seed[d_parent[iPoint]] != iPoint) d_child[position[d_parent[iPoint]]++] = iPoint;
+
+        return numCoarse;
+    }
+
+    double GeomAgglomeration::GetAspectRatio(unsigned short val_numDim, unsigned long val_numChild, const unsigned long* val_child,
+                                             const double* val_coord, const double* val_volume)
+    {
+        unsigned short iDim;
+        double minCoord[3], maxCoord[3], volume = 0.0;
+
+        if (val_numChild == 0) return 1.0;
+
+        for (iDim = 0; iDim < val_numDim; iDim++) minCoord[iDim] = maxCoord[iDim] = val_coord[val_child[0]*val_numDim + iDim];
+        for (unsigned long iChild = 0; iChild < val_numChild; iChild++)
+        {
+            const double* coord = &val_coord[val_child[iChild]*val_numDim];
+            for (iDim = 0; iDim < val_numDim; iDim++)
+            {
+                minCoord[iDim] = min(minCoord[iDim], coord[iDim]);
+                maxCoord[iDim] = max(maxCoord[iDim], coord[iDim]);
+            }
+            volume += val_volume[val_child[iChild]];
+        }
+
+        double size = pow(volume / val_numChild, 1.0 / val_numDim), minSide = 0.0, maxSide = 0.0;
+        for (iDim = 0; iDim < val_numDim; iDim++)
+        {
+            double side = maxCoord[iDim] - minCoord[iDim] + size;
+            minSide = (iDim == 0) ? side : min(minSide, side);
+            maxSide = max(maxSide, side);
+        }
+        return (minSide > 0.0) ? maxSide / minSide : 1.0;
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Threaded agglomeration of the dual-grid control volumes by rounds of independent seeds
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMAGGLOMERATION_HPP
+#define ARIES_GEOMAGGLOMERATION_HPP
+
+#include <cstddef>
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Agglomeration of the points of a graph into coarse control volumes, threaded.
+     *
+     * The sequential agglomeration grows one front: it takes the point with
+     * the most agglomerated neighbors, makes it a seed and gives it all its
+     * free neighbors. Here every round picks at once all the free points whose
+     * key (number of agglomerated neighbors, then a hash of the index) is the
+     * largest within two edges; these seeds are independent, so their
+     * neighborhoods do not overlap and the round runs in parallel without
+     * locks. Every free point then joins the seed next to it, or, for the
+     * seeds marked for indirect agglomeration (hexahedra, quadrilaterals), a
+     * seed it shares two neighbors with. Rounds go on until no seed is left.
+     * Favouring the points next to agglomerated ones keeps the front-like
+     * growth, and the coarsening ratio, of the sequential version. The result
+     * only depends on the graph, never on the number of threads.
+     */
+    class GeomAgglomeration
+    {
+    public:
+        typedef enum
+        {
+            Status_Agglomerated = 0,    /*!< \brief Already in a coarse control volume. */
+            Status_Excluded = 1,        /*!< \brief Never agglomerated here (halo points). */
+            Status_Free = 2,            /*!< \brief Can be a seed, or join a neighbor seed. */
+            Status_IndirectOnly = 3     /*!< \brief Can only join a seed as indirect neighbor. */
+        } PointStatus;
+
+        GeomAgglomeration();
+        ~GeomAgglomeration();
+
+        /*!
+         * \brief Agglomerate the free points.
+         * \param[in] val_numPoint - Number of points.
+         * \param[in] val_pointPtr - CSR offsets of the neighbors of the points.
+         * \param[in] val_point - Neighbors of the points.
+         * \param[in] val_status - Status of every point.
+         * \param[in] val_indirect - Points whose seed can take the indirect neighbors.
+         * \return Number of new coarse control volumes.
+         */
+        unsigned long Agglomerate(unsigned long val_numPoint, const unsigned long* val_pointPtr, const unsigned long* val_point,
+                                  const unsigned short* val_status, const bool* val_indirect);
+
+        /*!
+         * \brief Coarse control volume of every point, -1 if the point was not agglomerated here.
+         */
+        const long* GetParent() const { return d_parent.empty() ? NULL : &d_parent[0]; };
+
+        /*!
+         * \brief Points of the coarse control volume <i>val_iCoarse</i>, the seed first.
+         */
+        unsigned long GetNumChildren(unsigned long val_iCoarse) const { return d_childPtr[val_iCoarse + 1] - d_childPtr[val_iCoarse]; };
+        const unsigned long* GetChildren(unsigned long val_iCoarse) const { return &d_child[d_childPtr[val_iCoarse]]; };
+
+        /*!
+         * \brief Whether a point joined its seed as an indirect neighbor.
+         */
+        bool GetIndirect(unsigned long val_iPoint) const { return d_indirect[val_iPoint] != 0; };
+
+        unsigned long GetNumCoarse() const { return d_childPtr.size() - 1; };
+        unsigned long GetNumRound() const { return d_numRound; };
+
+        /*!
+         * \brief Aspect ratio of a control volume made of several points: largest over smallest
+         *        side of the box around the points, every side widened by the mean size of the points.
+         * \param[in] val_numDim - Number of dimensions of the problem.
+         * \param[in] val_numChild - Number of points.
+         * \param[in] val_child - Points.
+         * \param[in] val_coord - Coordinates, <i>[iPoint*nDim+iDim]</i>.
+         * \param[in] val_volume - Volumes of the points.
+         */
+        static double GetAspectRatio(unsigned short val_numDim, unsigned long val_numChild, const unsigned long* val_child,
+                                     const double* val_coord, const double* val_volume);
+
+    private:
+        vector<long> d_parent;                  /*!< \brief Coarse control volume of the points. */
+        vector<unsigned long> d_childPtr;       /*!< \brief CSR offsets of the points of the coarse control volumes. */
+        vector<unsigned long> d_child;          /*!< \brief Points of the coarse control volumes. */
+        vector<unsigned char> d_indirect;       /*!< \brief Points agglomerated as indirect neighbors. */
+        unsigned long d_numRound;               /*!< \brief Number of rounds of the last agglomeration. */
+    };
+}
+
+#endif
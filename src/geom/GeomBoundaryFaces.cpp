@@ -0,0 +1,167 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Flat table of the boundary vertices with their dual-face normals and areas
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomBoundaryFaces.hpp"
+#include "const_def.h"
+
+#include <cmath>
+
+namespace ARIES
+{
+    GeomBoundaryFaces::GeomBoundaryFaces()
+    {
+        d_numDim = 0;
+        d_vertexPtr.assign(1, 0);
+        d_faceNodePtr.assign(1, 0);
+        d_vertexCornerPtr.assign(1, 0);
+    }
+
+    GeomBoundaryFaces::~GeomBoundaryFaces()
+    {
+    }
+
+    void GeomBoundaryFaces::SetTopology(unsigned short val_numDim, unsigned short val_numMarker, const unsigned long* val_vertexPtr,
+                                        const unsigned long* val_vertexNode, const unsigned long* val_facePtr,
+                                        const unsigned long* val_faceNodePtr, const unsigned long* val_faceVertex)
+    {
+        unsigned short iMarker;
+        unsigned long iFace, iCorner, iVertex;
+        unsigned long numVertex = val_vertexPtr[val_numMarker], numFace = val_facePtr[val_numMarker];
+        unsigned long numCorner = val_faceNodePtr[numFace] - val_faceNodePtr[0];
+
+        d_numDim = val_numDim;
+        d_vertexPtr.assign(val_vertexPtr, val_vertexPtr + val_numMarker + 1);
+        d_vertexNode.assign(val_vertexNode, val_vertexNode + numVertex);
+        d_normal.assign(numVertex*d_numDim, 0.0);
+        d_unitNormal.assign(numVertex*d_numDim, 0.0);
+        d_area.assign(numVertex, 0.0);
+
+        /*--- Corners numbered over all the markers, pointing to vertices over all the markers ---*/
+        d_faceNodePtr.resize(numFace + 1);
+        d_faceVertex.resize(numCorner);
+        for (iFace = 0; iFace <= numFace; iFace++) d_faceNodePtr[iFace] = val_faceNodePtr[iFace] - val_faceNodePtr[0];
+        for (iMarker = 0; iMarker < val_numMarker; iMarker++)
+            for (iFace = val_facePtr[iMarker]; iFace < val_facePtr[iMarker + 1]; iFace++)
+                for (iCorner = d_faceNodePtr[iFace]; iCorner < d_faceNodePtr[iFace + 1]; iCorner++)
+                    d_faceVertex[iCorner] = d_vertexPtr[iMarker] + val_faceVertex[val_faceNodePtr[0] + iCorner];
+        d_corner.assign(numCorner*d_numDim, 0.0);
+
+        /*--- Corners around every vertex (count, then fill) ---*/
+        d_vertexCornerPtr.assign(numVertex + 1, 0);
+        for (iCorner = 0; iCorner < numCorner; iCorner++) d_vertexCornerPtr[d_faceVertex[iCorner] + 1]++;
+        for (iVertex = 0; iVertex < numVertex; iVertex++) d_vertexCornerPtr[iVertex + 1] += d_vertexCornerPtr[iVertex];
+
+        vector<unsigned long> position(d_vertexCornerPtr.begin(), d_vertexCornerPtr.end() - 1);
+        d_vertexCorner.resize(numCorner);
+        for (iCorner = 0; iCorner < numCorner; iCorner++) d_vertexCorner[position[d_faceVertex[iCorner]]++] = iCorner;
+    }
+
+    void GeomBoundaryFaces::Update(const double* val_coord)
+    {
+        long iFace, iVertex;
+        long numFace = d_faceNodePtr.size() - 1, numVertex = d_vertexNode.size();
+        const unsigned short nDim = d_numDim;
+
+        /*--- Piece of the dual face at every corner ---*/
+#pragma omp parallel for schedule(static)
+        for (iFace = 0; iFace < numFace; iFace++)
+        {
+            unsigned long begin = d_faceNodePtr[iFace];
+            unsigned short numNode = d_faceNodePtr[iFace + 1] - begin, iNode, iDim;
+            double* corner = &d_corner[begin*nDim];
+
+            if (numNode < 2)
+            {
+                for (iDim = 0; iDim < numNode*nDim; iDim++) corner[iDim] = 0.0;
+                continue;
+            }
+
+            if (nDim == 2)
+            {
+                /*--- Half of the segment normal (-dy, dx) to both ends ---*/
+                const double* coord0 = &val_coord[d_vertexNode[d_faceVertex[begin]]*2];
+                const double* coord1 = &val_coord[d_vertexNode[d_faceVertex[begin + 1]]*2];
+                corner[0] = corner[2] = -0.5*(coord1[1] - coord0[1]);
+                corner[1] = corner[3] = 0.5*(coord1[0] - coord0[0]);
+                continue;
+            }
+
+            /*--- Centroid, then the two triangles (vertex, centroid, edge midpoint) at every corner ---*/
+            double center[3] = { 0.0, 0.0, 0.0 };
+            for (iNode = 0; iNode < numNode; iNode++)
+            {
+                const double* coord = &val_coord[d_vertexNode[d_faceVertex[begin + iNode]]*3];
+                center[0] += coord[0]; center[1] += coord[1]; center[2] += coord[2];
+            }
+            center[0] /= numNode; center[1] /= numNode; center[2] /= numNode;
+
+            for (iNode = 0; iNode < numNode; iNode++)
+            {
+                const double* coord = &val_coord[d_vertexNode[d_faceVertex[begin + iNode]]*3];
+                const double* next = &val_coord[d_vertexNode[d_faceVertex[begin + (iNode + 1) % numNode]]*3];
+                const double* prev = &val_coord[d_vertexNode[d_faceVertex[begin + (iNode + numNode - 1) % numNode]]*3];
+                double a[3], b[3], c[3], d[3];
+                for (iDim = 0; iDim < 3; iDim++)
+                {
+                    double midNext = 0.5*(coord[iDim] + next[iDim]), midPrev = 0.5*(coord[iDim] + prev[iDim]);
+                    a[iDim] = coord[iDim] - center[iDim];
+                    b[iDim] = midNext - center[iDim];
+                    c[iDim] = coord[iDim] - midPrev;
+                    d[iDim] = center[iDim] - midPrev;
+                }
+                corner[iNode*3 + 0] = 0.5*(a[1]*b[2] - a[2]*b[1] + c[1]*d[2] - c[2]*d[1]);
+                corner[iNode*3 + 1] = 0.5*(a[2]*b[0] - a[0]*b[2] + c[2]*d[0] - c[0]*d[2]);
+                corner[iNode*3 + 2] = 0.5*(a[0]*b[1] - a[1]*b[0] + c[0]*d[1] - c[1]*d[0]);
+            }
+        }
+
+        /*--- Sum at the vertices; a vertex without area gets a tiny normal, as in SetBoundControlVolume ---*/
+#pragma omp parallel for schedule(static)
+        for (iVertex = 0; iVertex < numVertex; iVertex++)
+        {
+            double* normal = &d_normal[iVertex*nDim];
+            double* unitNormal = &d_unitNormal[iVertex*nDim];
+            double area = 0.0;
+            unsigned short iDim;
+
+            for (iDim = 0; iDim < nDim; iDim++) normal[iDim] = 0.0;
+            for (unsigned long iPos = d_vertexCornerPtr[iVertex]; iPos < d_vertexCornerPtr[iVertex + 1]; iPos++)
+            {
+                const double* corner = &d_corner[d_vertexCorner[iPos]*nDim];
+                for (iDim = 0; iDim < nDim; iDim++) normal[iDim] += corner[iDim];
+            }
+
+            for (iDim = 0; iDim < nDim; iDim++) area += normal[iDim]*normal[iDim];
+            area = sqrt(area);
+            if (area == 0.0)
+            {
+                for (iDim = 0; iDim < nDim; iDim++) normal[iDim] = EPS*EPS;
+                for (iDim = 0; iDim < nDim; iDim++) area += normal[iDim]*normal[iDim];
+                area = sqrt(area);
+            }
+
+            d_area[iVertex] = area;
+            for (iDim = 0; iDim < nDim; iDim++) unitNormal[iDim] = normal[iDim] / area;
+        }
+    }
+
+    double GeomBoundaryFaces::GetMarkerArea(unsigned short val_iMarker) const
+    {
+        double area = 0.0;
+        for (unsigned long iVertex = d_vertexPtr[val_iMarker]; iVertex < d_vertexPtr[val_iMarker + 1]; iVertex++) area += d_area[iVertex];
+        return area;
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Flat table of the boundary vertices with their dual-face normals and areas
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMBOUNDARYFACES_HPP
+#define ARIES_GEOMBOUNDARYFACES_HPP
+
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Boundary vertices of every marker in contiguous arrays: point, normal, unit normal and area.
+     *
+     * The vertices of all the markers are stored one marker after the other,
+     * in the order of the vertex objects of the geometry, so the vertex iVertex
+     * of a marker is entry GetVertexBegin(iMarker)+iVertex of every array and
+     * boundary-condition or force loops stream through memory. Normals follow
+     * the convention of the dual grid: the sum, over the boundary faces
+     * around the vertex, of the median-dual pieces of the face (the vertex,
+     * the midpoints of the face edges and the face centroid), pointing into
+     * the domain. Update runs in two threaded passes without conflicts: every
+     * face first writes the piece of each of its corners to its own slot,
+     * then every vertex sums its corners through a vertex-to-corner map built
+     * with the topology. Triangles and quadrilaterals share one corner
+     * formula, so the face loop has no branch on the element type and its
+     * arithmetic on the coordinates vectorizes.
+     */
+    class GeomBoundaryFaces
+    {
+    public:
+        GeomBoundaryFaces();
+        ~GeomBoundaryFaces();
+
+        /*!
+         * \brief Set the vertices and faces of all the markers.
+         * \param[in] val_numDim - Number of dimensions of the problem.
+         * \param[in] val_numMarker - Number of markers.
+         * \param[in] val_vertexPtr - Offsets of the vertices of the markers (size val_numMarker+1).
+         * \param[in] val_vertexNode - Point of every vertex.
+         * \param[in] val_facePtr - Offsets of the faces of the markers (size val_numMarker+1).
+         * \param[in] val_faceNodePtr - CSR offsets of the nodes of the faces.
+         * \param[in] val_faceVertex - Nodes of the faces in the order of the boundary elements, as vertex indices
+         *            local to the marker; faces with a single node (halo markers) carry no area.
+         */
+        void SetTopology(unsigned short val_numDim, unsigned short val_numMarker, const unsigned long* val_vertexPtr,
+                         const unsigned long* val_vertexNode, const unsigned long* val_facePtr,
+                         const unsigned long* val_faceNodePtr, const unsigned long* val_faceVertex);
+
+        /*!
+         * \brief Compute normals, unit normals and areas from the coordinates of the points.
+         * \param[in] val_coord - Coordinates, <i>[iPoint*nDim+iDim]</i>.
+         */
+        void Update(const double* val_coord);
+
+        unsigned short GetNumMarker() const { return d_vertexPtr.size() - 1; };
+        unsigned long GetNumVertex(unsigned short val_iMarker) const { return d_vertexPtr[val_iMarker + 1] - d_vertexPtr[val_iMarker]; };
+        unsigned long GetVertexBegin(unsigned short val_iMarker) const { return d_vertexPtr[val_iMarker]; };
+        unsigned long GetNumVertexTotal() const { return d_vertexNode.size(); };
+
+        /*!
+         * \brief Arrays of a marker, indexed by the vertex of the marker.
+         */
+        const unsigned long* GetNode(unsigned short val_iMarker) const { return &d_vertexNode[d_vertexPtr[val_iMarker]]; };
+        const double* GetNormal(unsigned short val_iMarker) const { return &d_normal[d_vertexPtr[val_iMarker]*d_numDim]; };
+        const double* GetUnitNormal(unsigned short val_iMarker) const { return &d_unitNormal[d_vertexPtr[val_iMarker]*d_numDim]; };
+        const double* GetArea(unsigned short val_iMarker) const { return &d_area[d_vertexPtr[val_iMarker]]; };
+
+        /*!
+         * \brief Area of a marker.
+         */
+        double GetMarkerArea(unsigned short val_iMarker) const;
+
+    private:
+        unsigned short d_numDim;                    /*!< \brief Number of dimensions of the problem. */
+
+        vector<unsigned long> d_vertexPtr;          /*!< \brief Offsets of the vertices of the markers. */
+        vector<unsigned long> d_vertexNode;         /*!< \brief Points of the vertices. */
+        vector<double> d_normal;                    /*!< \brief Normals, <i>[iVertex*nDim+iDim]</i>. */
+        vector<double> d_unitNormal;                /*!< \brief Unit normals, <i>[iVertex*nDim+iDim]</i>. */
+        vector<double> d_area;                      /*!< \brief Areas (norms of the normals). */
+
+        vector<unsigned long> d_faceNodePtr;        /*!< \brief CSR offsets of the corners of the faces. */
+        vector<unsigned long> d_faceVertex;         /*!< \brief Vertex of every corner, over all the markers. */
+        vector<double> d_corner;                    /*!< \brief Normal piece of every corner, <i>[iCorner*nDim+iDim]</i>. */
+        vector<unsigned long> d_vertexCornerPtr;    /*!< \brief CSR offsets of the corners around the vertices. */
+        vector<unsigned long> d_vertexCorner;       /*!< \brief Corners around the vertices. */
+    };
+}
+
+#endif
@@ -0,0 +1,193 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Per-element cost model used to weight the graph partitioning
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomCostModel.hpp"
+
+#include "AriesMPI.hpp"
+#include "const_def.h"
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+namespace ARIES
+{
+    GeomCostModel::GeomCostModel()
+    {
+        /*--- Number of edges of every element type ---*/
+        d_elemCost.assign(ElemCost_Num, 0.0);
+        d_elemCost[ElemCost_Line] = 1.0;
+        d_elemCost[ElemCost_Tria] = 3.0;
+        d_elemCost[ElemCost_Quad] = 4.0;
+        d_elemCost[ElemCost_Tetr] = 6.0;
+        d_elemCost[ElemCost_Hexa] = 12.0;
+        d_elemCost[ElemCost_Pris] = 9.0;
+        d_elemCost[ElemCost_Pyra] = 8.0;
+
+        d_regularization = 1.0E-2;
+    }
+
+    GeomCostModel::~GeomCostModel()
+    {
+    }
+
+    unsigned short GeomCostModel::GetCostIndex(unsigned short val_vtkType)
+    {
+        switch (val_vtkType)
+        {
+        case LINE:        return ElemCost_Line;
+        case TRIANGLE:    return ElemCost_Tria;
+        case RECTANGLE:   return ElemCost_Quad;
+        case TETRAHEDRON: return ElemCost_Tetr;
+        case HEXAHEDRON:  return ElemCost_Hexa;
+        case PRISM:       return ElemCost_Pris;
+        case PYRAMID:     return ElemCost_Pyra;
+        default:          return ElemCost_Num;
+        }
+    }
+
+    double GeomCostModel::GetCost(unsigned short val_vtkType)
+    {
+        unsigned short iType = GetCostIndex(val_vtkType);
+        return (iType < ElemCost_Num) ? d_elemCost[iType] : 0.0;
+    }
+
+    bool GeomCostModel::ReadTiming(const string& val_fileName)
+    {
+        unsigned short iType, jType, kType;
+        string text_line;
+
+        ifstream timing_file(val_fileName.c_str(), ios::in);
+        if (timing_file.fail()) return false;
+
+        /*--- Rows of the least squares problem: time = sum(cost * numElem) ---*/
+        vector<double> time;
+        vector<vector<double> > numElem;
+        while (getline(timing_file, text_line))
+        {
+            if (text_line.empty() || text_line[0] == '#') continue;
+
+            istringstream line(text_line);
+            int rank;
+            double val_time;
+            vector<double> row(ElemCost_Num, 0.0);
+            if (!(line >> rank >> val_time)) continue;
+            for (iType = 0; iType < ElemCost_Num; iType++) line >> row[iType];
+
+            time.push_back(val_time);
+            numElem.push_back(row);
+        }
+        timing_file.close();
+
+        if (time.empty()) return false;
+
+        /*--- Scale the defaults to seconds so that they can regularize the fit ---*/
+        double sumTime = 0.0, sumModel = 0.0;
+        for (unsigned long iRow = 0; iRow < time.size(); iRow++)
+        {
+            sumTime += time[iRow];
+            for (iType = 0; iType < ElemCost_Num; iType++)
+                sumModel += d_elemCost[iType] * numElem[iRow][iType];
+        }
+        if (sumTime <= 0.0 || sumModel <= 0.0) return false;
+        double scale = sumTime / sumModel;
+
+        /*--- Normal equations (A^T A + lambda I) c = A^T t + lambda c_default ---*/
+        vector<vector<double> > mat(ElemCost_Num, vector<double>(ElemCost_Num, 0.0));
+        vector<double> rhs(ElemCost_Num, 0.0);
+        double trace = 0.0;
+        for (unsigned long iRow = 0; iRow < time.size(); iRow++)
+        {
+            for (iType = 0; iType < ElemCost_Num; iType++)
+            {
+                rhs[iType] += numElem[iRow][iType] * time[iRow];
+                for (jType = 0; jType < ElemCost_Num; jType++)
+                    mat[iType][jType] += numElem[iRow][iType] * numElem[iRow][jType];
+            }
+        }
+        for (iType = 0; iType < ElemCost_Num; iType++) trace += mat[iType][iType];
+
+        double lambda = d_regularization * trace / double(ElemCost_Num) + EPS;
+        for (iType = 0; iType < ElemCost_Num; iType++)
+        {
+            mat[iType][iType] += lambda;
+            rhs[iType] += lambda * scale * d_elemCost[iType];
+        }
+
+        /*--- Gaussian elimination with partial pivoting ---*/
+        for (iType = 0; iType < ElemCost_Num; iType++)
+        {
+            unsigned short pivot = iType;
+            for (jType = iType + 1; jType < ElemCost_Num; jType++)
+                if (fabs(mat[jType][iType]) > fabs(mat[pivot][iType])) pivot = jType;
+            mat[iType].swap(mat[pivot]);
+            swap(rhs[iType], rhs[pivot]);
+
+            for (jType = iType + 1; jType < ElemCost_Num; jType++)
+            {
+                double factor = mat[jType][iType] / mat[iType][iType];
+                for (kType = iType; kType < ElemCost_Num; kType++)
+                    mat[jType][kType] -= factor * mat[iType][kType];
+                rhs[jType] -= factor * rhs[iType];
+            }
+        }
+        vector<double> cost(ElemCost_Num, 0.0);
+        for (int iRow = ElemCost_Num - 1; iRow >= 0; iRow--)
+        {
+            double sum = rhs[iRow];
+            for (kType = iRow + 1; kType < ElemCost_Num; kType++)
+                sum -= mat[iRow][kType] * cost[kType];
+            cost[iRow] = sum / mat[iRow][iRow];
+        }
+
+        /*--- Back to the default units, never letting an element become free ---*/
+        for (iType = 0; iType < ElemCost_Num; iType++)
+            d_elemCost[iType] = max(cost[iType] / scale, 0.05 * d_elemCost[iType]);
+
+        return true;
+    }
+
+    void GeomCostModel::WriteTiming(const string& val_fileName, double val_time, const unsigned long* val_numElem)
+    {
+        unsigned short iType;
+        const int nValue = ElemCost_Num + 1;
+
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        int rank = mpi.GetRank(), size = mpi.GetSize();
+
+        vector<double> local(nValue), global(nValue * size);
+        local[0] = val_time;
+        for (iType = 0; iType < ElemCost_Num; iType++) local[iType + 1] = double(val_numElem[iType]);
+
+        if (size > 1)
+            mpi.Gather(&local[0], nValue, MPI_DOUBLE, &global[0], nValue, MPI_DOUBLE, MASTER_NODE);
+        else
+            global = local;
+
+        if (rank != MASTER_NODE) return;
+
+        ofstream timing_file(val_fileName.c_str(), ios::out);
+        timing_file << "# rank time nLine nTria nQuad nTetr nHexa nPris nPyra" << endl;
+        for (int iRank = 0; iRank < size; iRank++)
+        {
+            timing_file << iRank;
+            for (int iValue = 0; iValue < nValue; iValue++)
+                timing_file << " " << global[iRank * nValue + iValue];
+            timing_file << endl;
+        }
+        timing_file.close();
+    }
+}
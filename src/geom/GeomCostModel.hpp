@@ -0,0 +1,93 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Per-element cost model used to weight the graph partitioning
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMCOSTMODEL_HPP
+#define ARIES_GEOMCOSTMODEL_HPP
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Cost of one element of every type, used to build vertex weights.
+     *
+     * The default costs are proportional to the number of edges of each
+     * element type, which is what the edge-based residual loops pay for.
+     * When a timing file from a previous run is available, the costs are
+     * refitted by least squares so that they reproduce the wall time every
+     * rank measured for its element mix (turbulence, linelets and wall
+     * treatment end up folded into the prism/hexa costs this way).
+     *
+     * The timing file holds one line per rank:
+     * <i>rank time nLine nTria nQuad nTetr nHexa nPris nPyra</i>.
+     */
+    class GeomCostModel
+    {
+    public:
+        typedef enum
+        {
+            ElemCost_Line = 0,
+            ElemCost_Tria = 1,
+            ElemCost_Quad = 2,
+            ElemCost_Tetr = 3,
+            ElemCost_Hexa = 4,
+            ElemCost_Pris = 5,
+            ElemCost_Pyra = 6,
+            ElemCost_Num  = 7
+        } ElemCostType;
+
+        GeomCostModel();
+        ~GeomCostModel();
+
+        /*!
+         * \brief Map a VTK element type to its cost slot (ElemCost_Num if unknown).
+         */
+        static unsigned short GetCostIndex(unsigned short val_vtkType);
+
+        double GetElemCost(unsigned short val_iType) { return d_elemCost[val_iType]; };
+        void SetElemCost(unsigned short val_iType, double val_cost) { d_elemCost[val_iType] = val_cost; };
+
+        /*!
+         * \brief Cost of an element given its VTK type.
+         */
+        double GetCost(unsigned short val_vtkType);
+
+        /*!
+         * \brief Refit the element costs from the timing of a previous run.
+         * \param[in] val_fileName - Timing file written by WriteTiming.
+         * \return <code>TRUE</code> if the file was found and the costs were updated.
+         */
+        bool ReadTiming(const string& val_fileName);
+
+        /*!
+         * \brief Gather the wall time and element mix of every rank and write them (master only).
+         * \param[in] val_fileName - Name of the timing file.
+         * \param[in] val_time - Wall time measured by this rank.
+         * \param[in] val_numElem - Number of local elements of every cost slot.
+         */
+        static void WriteTiming(const string& val_fileName, double val_time, const unsigned long* val_numElem);
+
+    private:
+        vector<double> d_elemCost;              /*!< \brief Cost of one element of every cost slot. */
+        double d_regularization;                /*!< \brief Weight pulling the fitted costs towards the defaults. */
+    };
+}
+
+#endif
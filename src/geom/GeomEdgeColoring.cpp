@@ -0,0 +1,124 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Cache-blocked ordering and coloring of the edges
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomEdgeColoring.hpp"
+
+#include <algorithm>
+
+namespace ARIES
+{
+    /*!
+     * \brief Orders edges by their smaller, then larger node.
+     */
+    class GeomEdgeLess
+    {
+    public:
+        GeomEdgeLess(const unsigned long* val_edgeNode) : d_edgeNode(val_edgeNode) {}
+        bool operator()(unsigned long val_a, unsigned long val_b) const
+        {
+            unsigned long minA = min(d_edgeNode[2*val_a], d_edgeNode[2*val_a + 1]), maxA = max(d_edgeNode[2*val_a], d_edgeNode[2*val_a + 1]);
+            unsigned long minB = min(d_edgeNode[2*val_b], d_edgeNode[2*val_b + 1]), maxB = max(d_edgeNode[2*val_b], d_edgeNode[2*val_b + 1]);
+            if (minA != minB) return minA < minB;
+            if (maxA != maxB) return maxA < maxB;
+            return val_a < val_b;
+        }
+    private:
+        const unsigned long* d_edgeNode;
+    };
+
+    GeomEdgeColoring::GeomEdgeColoring()
+    {
+        d_blockSize = 0;
+        d_blockPtr.assign(1, 0);
+        d_colorPtr.assign(1, 0);
+    }
+
+    GeomEdgeColoring::~GeomEdgeColoring()
+    {
+    }
+
+    void GeomEdgeColoring::Build(unsigned long val_numPoint, unsigned long val_numEdge, const unsigned long* val_edgeNode, unsigned long val_blockSize)
+    {
+        vector<unsigned long> sorted(val_numEdge);
+        for (unsigned long iEdge = 0; iEdge < val_numEdge; iEdge++) sorted[iEdge] = iEdge;
+        sort(sorted.begin(), sorted.end(), GeomEdgeLess(val_edgeNode));
+
+        /*--- Smaller blocks share fewer points and need fewer colors; single edges always succeed ---*/
+        d_blockSize = max(val_blockSize, 1UL);
+        while (!Color(val_numPoint, val_edgeNode, sorted)) d_blockSize = max(d_blockSize / 2, 1UL);
+    }
+
+    bool GeomEdgeColoring::Color(unsigned long val_numPoint, const unsigned long* val_edgeNode, const vector<unsigned long>& val_sorted)
+    {
+        unsigned long iBlock, iPos, iPoint, numEdge = val_sorted.size();
+        unsigned long numBlock = (numEdge + d_blockSize - 1) / d_blockSize;
+        unsigned short iColor, iWord, iNode, numColor = 0;
+
+        /*--- Colors already used at every point, as bits; single edges never need more than twice the largest degree ---*/
+        vector<unsigned long> degree(val_numPoint, 0);
+        for (iPos = 0; iPos < 2*numEdge; iPos++) degree[val_edgeNode[iPos]]++;
+        unsigned long maxDegree = numEdge > 0 ? *max_element(degree.begin(), degree.end()) : 0;
+        unsigned short numWord = (unsigned short)max((2*maxDegree + 63) / 64, (unsigned long)d_maxColor / 64);
+
+        vector<unsigned long long> pointColor(val_numPoint*numWord, 0), used(numWord);
+        vector<unsigned short> blockColor(numBlock);
+        vector<unsigned long> blockSize(64*numWord + 1, 0);
+
+        /*--- Greedy coloring of the blocks ---*/
+        for (iBlock = 0; iBlock < numBlock; iBlock++)
+        {
+            unsigned long begin = iBlock*d_blockSize, end = min(begin + d_blockSize, numEdge);
+            fill(used.begin(), used.end(), 0ULL);
+            for (iPos = begin; iPos < end; iPos++)
+                for (iNode = 0; iNode < 2; iNode++)
+                    for (iWord = 0; iWord < numWord; iWord++)
+                        used[iWord] |= pointColor[val_edgeNode[2*val_sorted[iPos] + iNode]*numWord + iWord];
+
+            for (iColor = 0; iColor < 64*numWord && ((used[iColor / 64] >> (iColor % 64)) & 1ULL); iColor++);
+
+            /*--- Too many colors leave too few blocks per color: try smaller blocks ---*/
+            if (iColor >= d_maxColor && d_blockSize > 1) return false;
+
+            blockColor[iBlock] = iColor;
+            numColor = max(numColor, (unsigned short)(iColor + 1));
+            blockSize[iColor + 1]++;
+            for (iPos = begin; iPos < end; iPos++)
+                for (iNode = 0; iNode < 2; iNode++)
+                {
+                    iPoint = val_edgeNode[2*val_sorted[iPos] + iNode];
+                    pointColor[iPoint*numWord + iColor / 64] |= (1ULL << (iColor % 64));
+                }
+        }
+
+        /*--- Store the blocks color by color, in their original order inside a color ---*/
+        d_colorPtr.assign(numColor + 1, 0);
+        for (iColor = 0; iColor < numColor; iColor++) d_colorPtr[iColor + 1] = d_colorPtr[iColor] + blockSize[iColor + 1];
+
+        vector<unsigned long> position(d_colorPtr.begin(), d_colorPtr.end() - 1), block(numBlock);
+        for (iBlock = 0; iBlock < numBlock; iBlock++) block[position[blockColor[iBlock]]++] = iBlock;
+
+        d_edge.resize(numEdge);
+        d_blockPtr.assign(numBlock + 1, 0);
+        for (unsigned long jBlock = 0; jBlock < numBlock; jBlock++)
+        {
+            unsigned long begin = block[jBlock]*d_blockSize, end = min(begin + d_blockSize, numEdge);
+            copy(val_sorted.begin() + begin, val_sorted.begin() + end, d_edge.begin() + d_blockPtr[jBlock]);
+            d_blockPtr[jBlock + 1] = d_blockPtr[jBlock] + (end - begin);
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Cache-blocked ordering and coloring of the edges
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMEDGECOLORING_HPP
+#define ARIES_GEOMEDGECOLORING_HPP
+
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Order of the edges for threaded edge loops (fluxes, Green-Gauss gradients) without atomics.
+     *
+     * The edges are sorted by their smaller and then larger node, so that on
+     * a bandwidth-reduced numbering (SetRCM_Ordering) consecutive edges touch
+     * nearby points, and cut into blocks of consecutive edges that fit in
+     * cache. The blocks are colored greedily so that two blocks of the same
+     * color share no point. The edges are then stored color by color, block by
+     * block: the blocks of one color can go to different threads, each one
+     * running its block in order, and every point is written by a single
+     * thread. When a block size needs too many colors it is halved.
+     *
+     * \code
+     * for (iColor = 0; iColor < coloring.GetNumColor(); iColor++)
+     * #pragma omp parallel for schedule(dynamic, 1)
+     *     for (iBlock = coloring.GetColorBlockBegin(iColor); iBlock < coloring.GetColorBlockEnd(iColor); iBlock++)
+     *         for (iPos = coloring.GetBlockBegin(iBlock); iPos < coloring.GetBlockEnd(iBlock); iPos++)
+     *             iEdge = coloring.GetEdge(iPos); ...
+     * \endcode
+     */
+    class GeomEdgeColoring
+    {
+    public:
+        GeomEdgeColoring();
+        ~GeomEdgeColoring();
+
+        /*!
+         * \brief Order, block and color the edges.
+         * \param[in] val_numPoint - Number of points.
+         * \param[in] val_numEdge - Number of edges.
+         * \param[in] val_edgeNode - Nodes of the edges, <i>[iEdge*2+iNode]</i>.
+         * \param[in] val_blockSize - Largest number of edges of a block.
+         */
+        void Build(unsigned long val_numPoint, unsigned long val_numEdge, const unsigned long* val_edgeNode, unsigned long val_blockSize = 512);
+
+        unsigned long GetNumEdge() const { return d_edge.size(); };
+
+        /*!
+         * \brief Edge at a position of the colored order.
+         */
+        unsigned long GetEdge(unsigned long val_iPos) const { return d_edge[val_iPos]; };
+
+        /*!
+         * \brief Edge permutation: positions of the colored order to edge indices.
+         */
+        const vector<unsigned long>& GetEdgePermutation() const { return d_edge; };
+
+        unsigned short GetNumColor() const { return (unsigned short)(d_colorPtr.size() - 1); };
+
+        /*!
+         * \brief Range of positions of the edges of a color.
+         */
+        unsigned long GetColorBegin(unsigned short val_iColor) const { return d_blockPtr[d_colorPtr[val_iColor]]; };
+        unsigned long GetColorEnd(unsigned short val_iColor) const { return d_blockPtr[d_colorPtr[val_iColor + 1]]; };
+
+        /*!
+         * \brief Range of the blocks of a color.
+         */
+        unsigned long GetColorBlockBegin(unsigned short val_iColor) const { return d_colorPtr[val_iColor]; };
+        unsigned long GetColorBlockEnd(unsigned short val_iColor) const { return d_colorPtr[val_iColor + 1]; };
+
+        /*!
+         * \brief Range of positions of the edges of a block.
+         */
+        unsigned long GetBlockBegin(unsigned long val_iBlock) const { return d_blockPtr[val_iBlock]; };
+        unsigned long GetBlockEnd(unsigned long val_iBlock) const { return d_blockPtr[val_iBlock + 1]; };
+
+        unsigned long GetNumBlock() const { return d_blockPtr.size() - 1; };
+
+        /*!
+         * \brief Block size actually used.
+         */
+        unsigned long GetBlockSize() const { return d_blockSize; };
+
+    private:
+        bool Color(unsigned long val_numPoint, const unsigned long* val_edgeNode, const vector<unsigned long>& val_sorted);
+
+        static const unsigned short d_maxColor = 64;    /*!< \brief Colors allowed before the block size is halved. */
+
+        unsigned long d_blockSize;                      /*!< \brief Largest number of edges of a block. */
+        vector<unsigned long> d_edge;                   /*!< \brief Edges in the colored order. */
+        vector<unsigned long> d_blockPtr;               /*!< \brief Positions of the blocks. */
+        vector<unsigned long> d_colorPtr;               /*!< \brief Blocks of the colors. */
+    };
+}
+
+#endif
@@ -0,0 +1,178 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Element faces matched through a hash of their sorted nodes
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomFaceMap.hpp"
+
+#include <algorithm>
+
+namespace ARIES
+{
+    /*!
+     * \brief Sorted nodes of a face, padded with the largest index.
+     */
+    struct GeomFaceKey
+    {
+        unsigned long node[4];
+
+        bool operator==(const GeomFaceKey& val_other) const
+        {
+            return node[0] == val_other.node[0] && node[1] == val_other.node[1] &&
+                   node[2] == val_other.node[2] && node[3] == val_other.node[3];
+        }
+
+        unsigned long Hash() const
+        {
+            unsigned long long hash = 1469598103934665603ULL;
+            for (unsigned short iNode = 0; iNode < 4; iNode++)
+            {
+                hash ^= (unsigned long long)node[iNode];
+                hash *= 1099511628211ULL;
+            }
+            return (unsigned long)(hash ^ (hash >> 29));
+        }
+    };
+
+    GeomFaceMap::GeomFaceMap()
+    {
+        d_numBoundary = 0;
+        d_numNonManifold = 0;
+    }
+
+    GeomFaceMap::~GeomFaceMap()
+    {
+    }
+
+    long GeomFaceMap::GetNeighborElem(unsigned long val_iElem, unsigned short val_iFace) const
+    {
+        unsigned long iFace = GetElemFace(val_iElem, val_iFace);
+        return (d_faceElem[2*iFace] == (long)val_iElem && d_faceLocal[2*iFace] == val_iFace) ? d_faceElem[2*iFace + 1] : d_faceElem[2*iFace];
+    }
+
+    unsigned short GeomFaceMap::GetNeighborFace(unsigned long val_iElem, unsigned short val_iFace) const
+    {
+        unsigned long iFace = GetElemFace(val_iElem, val_iFace);
+        return (d_faceElem[2*iFace] == (long)val_iElem && d_faceLocal[2*iFace] == val_iFace) ? d_faceLocal[2*iFace + 1] : d_faceLocal[2*iFace];
+    }
+
+    void GeomFaceMap::Build(unsigned long val_numElem, const unsigned long* val_elemFacePtr,
+                            const unsigned long* val_faceNodePtr, const unsigned long* val_faceNode)
+    {
+        long iElem, iSlot, iBucket;
+        unsigned long numSlot = val_elemFacePtr[val_numElem];
+
+        d_elemFacePtr.assign(val_elemFacePtr, val_elemFacePtr + val_numElem + 1);
+
+        /*--- Key and bucket of every local face ---*/
+        unsigned long numBucket = 1;
+        while (numBucket < numSlot) numBucket *= 2;
+
+        vector<GeomFaceKey> key(numSlot);
+        vector<unsigned long> bucket(numSlot), slotElem(numSlot);
+        vector<unsigned long> bucketPtr(numBucket + 1, 0);
+
+#pragma omp parallel for schedule(static)
+        for (iElem = 0; iElem < (long)val_numElem; iElem++)
+        {
+            for (unsigned long jSlot = val_elemFacePtr[iElem]; jSlot < val_elemFacePtr[iElem + 1]; jSlot++)
+            {
+                GeomFaceKey& faceKey = key[jSlot];
+                unsigned short iNode, nNode = (unsigned short)(val_faceNodePtr[jSlot + 1] - val_faceNodePtr[jSlot]);
+                for (iNode = 0; iNode < 4; iNode++)
+                    faceKey.node[iNode] = (iNode < nNode) ? val_faceNode[val_faceNodePtr[jSlot] + iNode] : (unsigned long)(-1);
+                sort(faceKey.node, faceKey.node + 4);
+
+                slotElem[jSlot] = iElem;
+                bucket[jSlot] = faceKey.Hash() & (numBucket - 1);
+#pragma omp atomic
+                bucketPtr[bucket[jSlot] + 1]++;
+            }
+        }
+
+        for (unsigned long jBucket = 0; jBucket < numBucket; jBucket++) bucketPtr[jBucket + 1] += bucketPtr[jBucket];
+
+        vector<unsigned long> bucketSlot(numSlot), fill(bucketPtr.begin(), bucketPtr.end() - 1);
+
+#pragma omp parallel for schedule(static)
+        for (iSlot = 0; iSlot < (long)numSlot; iSlot++)
+        {
+            unsigned long position;
+#pragma omp atomic capture
+            position = fill[bucket[iSlot]]++;
+            bucketSlot[position] = iSlot;
+        }
+
+        /*--- Match equal keys inside every bucket; the first slot of a face owns it ---*/
+        const unsigned long noSlot = (unsigned long)(-1);
+        vector<unsigned long> partner(numSlot, noSlot);
+        unsigned long numNonManifold = 0;
+
+#pragma omp parallel for schedule(dynamic, 4096) reduction(+:numNonManifold)
+        for (iBucket = 0; iBucket < (long)numBucket; iBucket++)
+        {
+            unsigned long* first = &bucketSlot[0] + bucketPtr[iBucket];
+            unsigned long* last = &bucketSlot[0] + bucketPtr[iBucket + 1];
+            sort(first, last);
+
+            for (unsigned long* slot = first; slot < last; slot++)
+            {
+                if (partner[*slot] != noSlot) continue;
+                unsigned short nMatch = 0;
+                for (unsigned long* other = slot + 1; other < last; other++)
+                {
+                    if (partner[*other] != noSlot || !(key[*slot] == key[*other])) continue;
+                    if (nMatch == 0)
+                    {
+                        partner[*slot] = *other;
+                        partner[*other] = *slot;
+                    }
+                    nMatch++;
+                }
+                if (nMatch > 1) numNonManifold++;
+            }
+        }
+        d_numNonManifold = numNonManifold;
+
+        /*--- Number the faces in the order of their owning slot ---*/
+        d_elemFace.assign(numSlot, 0);
+        unsigned long numFace = 0;
+        for (unsigned long jSlot = 0; jSlot < numSlot; jSlot++)
+            if (partner[jSlot] == noSlot || partner[jSlot] > jSlot) d_elemFace[jSlot] = numFace++;
+
+        d_faceElem.assign(2*numFace, -1);
+        d_faceLocal.assign(2*numFace, 0);
+        d_numBoundary = 0;
+
+#pragma omp parallel for schedule(static)
+        for (iSlot = 0; iSlot < (long)numSlot; iSlot++)
+        {
+            if (partner[iSlot] != noSlot && partner[iSlot] < (unsigned long)iSlot) continue;
+
+            unsigned long iFace = d_elemFace[iSlot];
+            d_faceElem[2*iFace] = slotElem[iSlot];
+            d_faceLocal[2*iFace] = (unsigned short)(iSlot - val_elemFacePtr[slotElem[iSlot]]);
+            if (partner[iSlot] != noSlot)
+            {
+                unsigned long jSlot = partner[iSlot];
+                d_elemFace[jSlot] = iFace;
+                d_faceElem[2*iFace + 1] = slotElem[jSlot];
+                d_faceLocal[2*iFace + 1] = (unsigned short)(jSlot - val_elemFacePtr[slotElem[jSlot]]);
+            }
+        }
+
+        for (unsigned long iFace = 0; iFace < numFace; iFace++)
+            if (d_faceElem[2*iFace + 1] == -1) d_numBoundary++;
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Element faces matched through a hash of their sorted nodes
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMFACEMAP_HPP
+#define ARIES_GEOMFACEMAP_HPP
+
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Unique faces of the elements with face-to-element and element-to-face maps.
+     *
+     * Every face of every element is keyed by its sorted nodes and hashed into
+     * a bucket of a flat table (count, prefix sum, fill). Faces with the same
+     * key can only meet in the same bucket, so matching is a scan of short
+     * buckets that runs in parallel, instead of testing every pair of
+     * elements around a point for a common face. A face seen once is a
+     * boundary face (or lies on a partition boundary); a key seen more than
+     * twice (non-manifold grid) is matched in pairs and counted.
+     */
+    class GeomFaceMap
+    {
+    public:
+        GeomFaceMap();
+        ~GeomFaceMap();
+
+        /*!
+         * \brief Match the faces of the elements.
+         * \param[in] val_numElem - Number of elements.
+         * \param[in] val_elemFacePtr - Offsets of the faces of every element in the face list (size val_numElem+1).
+         * \param[in] val_faceNodePtr - CSR offsets of the nodes of the faces in the face list.
+         * \param[in] val_faceNode - Nodes of the faces (points, not local nodes), at most 4 per face.
+         */
+        void Build(unsigned long val_numElem, const unsigned long* val_elemFacePtr,
+                   const unsigned long* val_faceNodePtr, const unsigned long* val_faceNode);
+
+        unsigned long GetNumFace() const { return d_faceElem.size() / 2; };
+        unsigned long GetNumBoundaryFace() const { return d_numBoundary; };
+        unsigned long GetNumNonManifold() const { return d_numNonManifold; };
+
+        /*!
+         * \brief Element on a side of a face (0 or 1), -1 if the face is on a boundary and val_iSide is 1.
+         */
+        long GetFaceElem(unsigned long val_iFace, unsigned short val_iSide) const { return d_faceElem[2*val_iFace + val_iSide]; };
+
+        /*!
+         * \brief Local index of a face in the element on the side val_iSide.
+         */
+        unsigned short GetFaceLocal(unsigned long val_iFace, unsigned short val_iSide) const { return d_faceLocal[2*val_iFace + val_iSide]; };
+
+        unsigned short GetNumElemFace(unsigned long val_iElem) const { return (unsigned short)(d_elemFacePtr[val_iElem + 1] - d_elemFacePtr[val_iElem]); };
+
+        /*!
+         * \brief Face behind a local face of an element.
+         */
+        unsigned long GetElemFace(unsigned long val_iElem, unsigned short val_iFace) const { return d_elemFace[d_elemFacePtr[val_iElem] + val_iFace]; };
+
+        /*!
+         * \brief Element across a local face of an element, -1 on a boundary.
+         */
+        long GetNeighborElem(unsigned long val_iElem, unsigned short val_iFace) const;
+
+        /*!
+         * \brief Local index of the shared face in the element across a local face of an element.
+         */
+        unsigned short GetNeighborFace(unsigned long val_iElem, unsigned short val_iFace) const;
+
+    private:
+        vector<unsigned long> d_elemFacePtr;    /*!< \brief Offsets of the faces of every element. */
+        vector<unsigned long> d_elemFace;       /*!< \brief Face behind every local face. */
+        vector<long> d_faceElem;                /*!< \brief Elements on both sides of every face. */
+        vector<unsigned short> d_faceLocal;     /*!< \brief Local index of every face in both elements. */
+        unsigned long d_numBoundary;            /*!< \brief Faces with a single element. */
+        unsigned long d_numNonManifold;         /*!< \brief Keys shared by more than two faces. */
+    };
+}
+
+#endif
@@ -0,0 +1,222 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Binary cache of the preprocessed geometry, one file per rank
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomGeometryCache.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ARIES
+{
+    /*!
+     * \brief Header of a cache file, as stored on disk.
+     */
+    struct GeomCacheHeader
+    {
+        char magic[8];
+        unsigned int version;
+        unsigned int numSection;
+        unsigned long long hash;
+        int numRank;
+        int rank;
+        unsigned int numDim;
+        unsigned int sizeLong;
+        unsigned long long numPoint;
+        unsigned long long fileSize;
+    };
+
+    static const char GeomCacheMagic[8] = { 'A', 'R', 'I', 'E', 'S', 'G', 'E', 'O' };
+
+    GeomGeometryCache::GeomGeometryCache() : d_file(Section_Num)
+    {
+        d_hash = 0;
+        d_numRank = 1;
+        d_rank = 0;
+        d_numDim = 0;
+        d_numPoint = 0;
+        for (unsigned short iSection = 0; iSection < Section_Num; iSection++)
+        {
+            d_offset[iSection] = 0;
+            d_mapCount[iSection] = 0;
+            d_mapElemSize[iSection] = 0;
+        }
+        d_map = NULL;
+        d_mapSize = 0;
+    }
+
+    GeomGeometryCache::~GeomGeometryCache()
+    {
+        Close();
+    }
+
+    static void GeomGeometryCacheHash(unsigned long long& val_hash, const char* val_data, unsigned long long val_size)
+    {
+        for (unsigned long long iChar = 0; iChar < val_size; iChar++)
+        {
+            val_hash ^= (unsigned char)val_data[iChar];
+            val_hash *= 1099511628211ULL;
+        }
+    }
+
+    unsigned long long GeomGeometryCache::HashFile(const string& val_fileName)
+    {
+        struct stat status;
+        if (stat(val_fileName.c_str(), &status) != 0) return 0;
+
+        ifstream file(val_fileName.c_str(), ios::in | ios::binary);
+        if (file.fail()) return 0;
+
+        /*--- Size and modification time catch a rewritten file, the sampled blocks a copied one ---*/
+        unsigned long long hash = 14695981039346656037ULL;
+        unsigned long long fileSize = status.st_size, modified = status.st_mtime;
+        GeomGeometryCacheHash(hash, (const char*)&fileSize, sizeof(fileSize));
+        GeomGeometryCacheHash(hash, (const char*)&modified, sizeof(modified));
+
+        unsigned long long numSample = d_numSample, sampleSize = d_sampleSize;
+        if (fileSize <= numSample*sampleSize)
+        {
+            numSample = 1;
+            sampleSize = fileSize;
+        }
+
+        vector<char> buffer(sampleSize + 1);
+        for (unsigned long long iSample = 0; iSample < numSample; iSample++)
+        {
+            unsigned long long offset = (numSample > 1) ? iSample*(fileSize - sampleSize) / (numSample - 1) : 0;
+            file.seekg(offset, ios::beg);
+            file.read(&buffer[0], sampleSize);
+            if ((unsigned long long)file.gcount() != sampleSize) return 0;
+            GeomGeometryCacheHash(hash, &buffer[0], sampleSize);
+        }
+        return hash;
+    }
+
+    string GeomGeometryCache::GetFileName(const string& val_prefix, int val_rank, int val_numRank)
+    {
+        ostringstream name;
+        name << val_prefix << ".geo." << val_rank << "of" << val_numRank;
+        return name.str();
+    }
+
+    void GeomGeometryCache::SetKey(unsigned long long val_hash, int val_numRank, int val_rank, unsigned short val_numDim, unsigned long val_numPoint)
+    {
+        d_hash = val_hash;
+        d_numRank = val_numRank;
+        d_rank = val_rank;
+        d_numDim = val_numDim;
+        d_numPoint = val_numPoint;
+    }
+
+    void GeomGeometryCache::SetSection(SectionType val_type, const void* val_data, unsigned long val_count, unsigned short val_size)
+    {
+        d_file.SetSection(val_type, val_data, val_count, val_size);
+    }
+
+    bool GeomGeometryCache::Write(const string& val_fileName) const
+    {
+        GeomCacheHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, GeomCacheMagic, sizeof(header.magic));
+        header.version = d_version;
+        header.numSection = d_file.GetNumSection();
+        header.hash = d_hash;
+        header.numRank = d_numRank;
+        header.rank = d_rank;
+        header.numDim = d_numDim;
+        header.sizeLong = sizeof(unsigned long);
+        header.numPoint = d_numPoint;
+        header.fileSize = d_file.GetFileSize(sizeof(header));
+
+        return d_file.Write(val_fileName, &header, sizeof(header));
+    }
+
+    bool GeomGeometryCache::Open(const string& val_fileName)
+    {
+        Close();
+
+        int fd = open(val_fileName.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat status;
+        if (fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(GeomCacheHeader))
+        {
+            close(fd);
+            return false;
+        }
+
+        /*--- The mapping stays valid after the descriptor is closed; pages are read on first access ---*/
+        void* map = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (map == MAP_FAILED) return false;
+
+        d_map = map;
+        d_mapSize = status.st_size;
+
+        const GeomCacheHeader* header = (const GeomCacheHeader*)d_map;
+        bool isValid = (memcmp(header->magic, GeomCacheMagic, sizeof(header->magic)) == 0);
+        isValid = isValid && header->version == d_version && header->fileSize == d_mapSize;
+        isValid = isValid && header->hash == d_hash && header->numRank == d_numRank && header->rank == d_rank;
+        isValid = isValid && header->numDim == d_numDim && header->numPoint == d_numPoint;
+        isValid = isValid && header->sizeLong == sizeof(unsigned long);
+        isValid = isValid && sizeof(GeomCacheHeader) + header->numSection*sizeof(GeomSectionEntry) <= d_mapSize;
+
+        if (isValid)
+        {
+            const GeomSectionEntry* table = (const GeomSectionEntry*)(header + 1);
+            for (unsigned int iEntry = 0; iEntry < header->numSection && isValid; iEntry++)
+            {
+                const GeomSectionEntry& section = table[iEntry];
+                isValid = section.type < Section_Num && section.offset + section.count*section.size <= d_mapSize;
+                if (!isValid) break;
+                d_offset[section.type] = section.offset;
+                d_mapCount[section.type] = section.count;
+                d_mapElemSize[section.type] = section.size;
+            }
+        }
+
+        if (!isValid) Close();
+        return isValid;
+    }
+
+    void GeomGeometryCache::Close()
+    {
+        if (d_map != NULL) munmap(d_map, d_mapSize);
+        d_map = NULL;
+        d_mapSize = 0;
+        for (unsigned short iSection = 0; iSection < Section_Num; iSection++)
+        {
+            d_offset[iSection] = 0;
+            d_mapCount[iSection] = 0;
+            d_mapElemSize[iSection] = 0;
+        }
+    }
+
+    const void* GeomGeometryCache::GetSection(SectionType val_type, unsigned short val_size, unsigned long& val_count) const
+    {
+        val_count = 0;
+        if (d_map == NULL || d_offset[val_type] == 0 || d_mapElemSize[val_type] != val_size) return NULL;
+
+        val_count = d_mapCount[val_type];
+        return (const char*)d_map + d_offset[val_type];
+    }
+}
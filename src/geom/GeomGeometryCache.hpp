@@ -0,0 +1,145 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Binary cache of the preprocessed geometry, one file per rank
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMGEOMETRYCACHE_HPP
+#define ARIES_GEOMGEOMETRYCACHE_HPP
+
+#include "GeomSectionFile.hpp"
+
+#include <cstddef>
+#include <string>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Binary file of the flat arrays produced by the geometry preprocessing of one rank.
+     *
+     * The file starts with a header holding the key of the cache (key of the
+     * mesh file, number of ranks, rank, dimensions and number of points),
+     * followed by a table with the type, element size, length and offset of
+     * every section, and the sections themselves, each one aligned on 64
+     * bytes, as laid out and written by GeomSectionFile. Reading maps the
+     * file into memory and hands out pointers into the mapping; a file whose
+     * key, version or section sizes do not match is rejected and the caller
+     * rebuilds the geometry.
+     */
+    class GeomGeometryCache
+    {
+    public:
+        typedef enum
+        {
+            Section_PointElemPtr = 0,       /*!< \brief CSR offsets of the elements around the points. */
+            Section_PointElem = 1,          /*!< \brief Elements around the points. */
+            Section_PointNeighborPtr = 2,   /*!< \brief CSR offsets of the neighbors of the points. */
+            Section_PointNeighbor = 3,      /*!< \brief Neighbors of the points. */
+            Section_PointEdge = 4,          /*!< \brief Edge towards every neighbor. */
+            Section_EdgeNode = 5,           /*!< \brief Nodes of the edges. */
+            Section_EdgeNormal = 6,         /*!< \brief Normals of the edges. */
+            Section_Volume = 7,             /*!< \brief Control volumes. */
+            Section_WallDistance = 8,       /*!< \brief Distance to the nearest wall. */
+            Section_NumVertex = 9,          /*!< \brief Number of vertices of every marker. */
+            Section_VertexNode = 10,        /*!< \brief Points of the boundary vertices. */
+            Section_DomainVolume = 11,      /*!< \brief Volume of the whole domain, summed over the ranks. */
+            Section_Num = 12                /*!< \brief Number of section types. */
+        } SectionType;
+
+        GeomGeometryCache();
+        ~GeomGeometryCache();
+
+        /*!
+         * \brief Key of a file (64-bit FNV-1a of its size, modification time and a sample of
+         *        d_numSample blocks spread from its head to its tail), 0 if it cannot be read.
+         *        The cost does not grow with the size of the mesh.
+         */
+        static unsigned long long HashFile(const string& val_fileName);
+
+        /*!
+         * \brief Name of the cache file of a rank, e.g. <i>mesh.su2.geo.3of16</i>.
+         */
+        static string GetFileName(const string& val_prefix, int val_rank, int val_numRank);
+
+        /*!
+         * \brief Set the key written to, and expected from, the file.
+         * \param[in] val_hash - Hash of the mesh file, the partition and the boundary conditions.
+         * \param[in] val_numRank - Number of ranks of the partition.
+         * \param[in] val_rank - Rank of the file.
+         * \param[in] val_numDim - Number of dimensions of the problem.
+         * \param[in] val_numPoint - Number of local points, halos included.
+         */
+        void SetKey(unsigned long long val_hash, int val_numRank, int val_rank, unsigned short val_numDim, unsigned long val_numPoint);
+
+        /*!
+         * \brief Register a section to write; the array is only read by Write.
+         * \param[in] val_type - Section.
+         * \param[in] val_data - Values.
+         * \param[in] val_count - Number of values.
+         * \param[in] val_size - Size of a value in bytes.
+         */
+        void SetSection(SectionType val_type, const void* val_data, unsigned long val_count, unsigned short val_size);
+
+        /*!
+         * \brief Write the key and the registered sections.
+         * \return <i>true</i> if the file was written completely.
+         */
+        bool Write(const string& val_fileName) const;
+
+        /*!
+         * \brief Map a cache file and check it against the key.
+         * \return <i>true</i> if the file can be used.
+         */
+        bool Open(const string& val_fileName);
+
+        /*!
+         * \brief Unmap the file; the pointers returned by GetSection become invalid.
+         */
+        void Close();
+
+        bool IsOpen() const { return d_map != NULL; };
+
+        /*!
+         * \brief Values of a section of the mapped file.
+         * \param[in] val_type - Section.
+         * \param[in] val_size - Expected size of a value in bytes.
+         * \param[out] val_count - Number of values.
+         * \return Pointer into the mapping, NULL if the section is missing or its values have another size.
+         */
+        const void* GetSection(SectionType val_type, unsigned short val_size, unsigned long& val_count) const;
+
+    private:
+        static const unsigned int d_version = 3;        /*!< \brief Format version, increased on every change of the layout. */
+        static const unsigned int d_numSample = 16;     /*!< \brief Number of blocks of the file hashed by HashFile. */
+        static const unsigned int d_sampleSize = 65536; /*!< \brief Size of the blocks hashed by HashFile. */
+
+        unsigned long long d_hash;                  /*!< \brief Hash of the mesh file. */
+        int d_numRank;                              /*!< \brief Number of ranks of the partition. */
+        int d_rank;                                 /*!< \brief Rank of the file. */
+        unsigned short d_numDim;                    /*!< \brief Number of dimensions of the problem. */
+        unsigned long d_numPoint;                   /*!< \brief Number of local points. */
+
+        GeomSectionFile d_file;                     /*!< \brief Sections to write. */
+
+        void* d_map;                                /*!< \brief Mapped file. */
+        size_t d_mapSize;                           /*!< \brief Size of the mapping. */
+        unsigned long long d_offset[Section_Num];   /*!< \brief Offsets of the sections in the mapping. */
+        unsigned long d_mapCount[Section_Num];      /*!< \brief Number of values of the mapped sections. */
+        unsigned short d_mapElemSize[Section_Num];  /*!< \brief Size of the values of the mapped sections. */
+    };
+}
+
+#endif
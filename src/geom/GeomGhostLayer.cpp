@@ -0,0 +1,321 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Ghost layer of a distributed mesh with global-to-local hash maps
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomGhostLayer.hpp"
+#include "GeomHaloExchange.hpp"
+#include "MeshData.hpp"
+#include "AriesMPI.hpp"
+#include "const_def.h"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+
+namespace ARIES
+{
+    const unsigned long GeomGhostLayer::d_empty = numeric_limits<unsigned long>::max();
+
+    /*!
+     * \brief Mix the bits of a global index, so consecutive indices spread over the table.
+     */
+    static unsigned long GeomGhostLayerHash(unsigned long val_key)
+    {
+        unsigned long long key = val_key;
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        return (unsigned long)key;
+    }
+
+    GeomGhostLayer::GeomGhostLayer()
+    {
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        d_rank = (mpi.GetSize() > 1) ? mpi.GetRank() : 0;
+        d_size = (mpi.GetSize() > 1) ? mpi.GetSize() : 1;
+        d_numKey = 0;
+        d_numOwned = 0;
+        d_firstOwned = 0;
+        d_isContiguous = true;
+        d_sendPtr.assign(1, 0);
+        d_recvPtr.assign(1, 0);
+    }
+
+    GeomGhostLayer::~GeomGhostLayer()
+    {
+
+    }
+
+    unsigned long GeomGhostLayer::FindSlot(unsigned long val_global) const
+    {
+        const unsigned long mask = d_key.size() - 1;
+        unsigned long iSlot = GeomGhostLayerHash(val_global) & mask;
+        while (d_key[iSlot] != d_empty && d_key[iSlot] != val_global) iSlot = (iSlot + 1) & mask;
+        return iSlot;
+    }
+
+    bool GeomGhostLayer::Insert(unsigned long val_global, unsigned long val_local)
+    {
+        /*--- Keep the table at most half full, so the probes stay short ---*/
+        if (2*(d_numKey + 1) > d_key.size()) Rehash(2*d_key.size());
+
+        unsigned long iSlot = FindSlot(val_global);
+        if (d_key[iSlot] == val_global) return false;
+        d_key[iSlot] = val_global;
+        d_value[iSlot] = val_local;
+        d_numKey++;
+        return true;
+    }
+
+    void GeomGhostLayer::Rehash(unsigned long val_capacity)
+    {
+        unsigned long capacity = 16;
+        while (capacity < val_capacity) capacity *= 2;
+
+        vector<unsigned long> key(capacity, d_empty), value(capacity, 0);
+        d_key.swap(key);
+        d_value.swap(value);
+        for (unsigned long iSlot = 0; iSlot < key.size(); iSlot++)
+        {
+            if (key[iSlot] == d_empty) continue;
+            unsigned long jSlot = FindSlot(key[iSlot]);
+            d_key[jSlot] = key[iSlot];
+            d_value[jSlot] = value[iSlot];
+        }
+    }
+
+    long GeomGhostLayer::GetLocal(unsigned long val_global) const
+    {
+        if (d_isContiguous && val_global >= d_firstOwned && val_global - d_firstOwned < d_numOwned) return (long)(val_global - d_firstOwned);
+        if (d_key.empty()) return -1;
+        unsigned long iSlot = FindSlot(val_global);
+        return (d_key[iSlot] == val_global) ? (long)d_value[iSlot] : -1;
+    }
+
+    bool GeomGhostLayer::Build(MeshData* val_meshData, const unsigned long* val_vtxdist)
+    {
+        unsigned long iPoint, iGhost, iNode;
+        int iRank;
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+
+        const vector<unsigned long>& pointGlobal = val_meshData->GetPointGlobal();
+        const vector<unsigned long>& elemNode = val_meshData->GetElemNode();
+        const vector<unsigned long>& boundNode = val_meshData->GetBoundNode();
+        d_numOwned = pointGlobal.size();
+
+        /*--- First global point of every rank ---*/
+        vector<unsigned long> vtxdist(d_size + 1, 0);
+        if (val_vtxdist != NULL)
+        {
+            vtxdist.assign(val_vtxdist, val_vtxdist + d_size + 1);
+        }
+        else
+        {
+            vector<unsigned long> numOwned(d_size, d_numOwned);
+            if (d_size > 1) mpi.Allgather(&d_numOwned, 1, MPI_UNSIGNED_LONG, &numOwned[0], 1, MPI_UNSIGNED_LONG);
+            for (iRank = 0; iRank < d_size; iRank++) vtxdist[iRank + 1] = vtxdist[iRank] + numOwned[iRank];
+        }
+
+        /*--- Owned points are an offset when contiguous (the linear partition), else go to the table ---*/
+        d_firstOwned = pointGlobal.empty() ? vtxdist[d_rank] : pointGlobal[0];
+        d_isContiguous = true;
+        for (iPoint = 0; iPoint < d_numOwned && d_isContiguous; iPoint++)
+            d_isContiguous = (pointGlobal[iPoint] == d_firstOwned + iPoint);
+
+        d_key.clear();
+        d_value.clear();
+        d_numKey = 0;
+        Rehash(d_isContiguous ? 0 : 2*(d_numOwned + d_numOwned/2));
+        if (!d_isContiguous)
+            for (iPoint = 0; iPoint < d_numOwned; iPoint++) Insert(pointGlobal[iPoint], iPoint);
+
+        /*--- Every other node of the elements and boundary elements is a ghost ---*/
+        d_ghostGlobal.clear();
+        for (iNode = 0; iNode < elemNode.size(); iNode++)
+            if (GetLocal(elemNode[iNode]) < 0 && Insert(elemNode[iNode], 0)) d_ghostGlobal.push_back(elemNode[iNode]);
+        for (iNode = 0; iNode < boundNode.size(); iNode++)
+            if (GetLocal(boundNode[iNode]) < 0 && Insert(boundNode[iNode], 0)) d_ghostGlobal.push_back(boundNode[iNode]);
+
+        /*--- The owners hold contiguous ranges, so sorting the ghosts groups them by owner ---*/
+        sort(d_ghostGlobal.begin(), d_ghostGlobal.end());
+        for (iGhost = 0; iGhost < d_ghostGlobal.size(); iGhost++)
+            d_value[FindSlot(d_ghostGlobal[iGhost])] = d_numOwned + iGhost;
+
+        int error = 0;
+        vector<int> requestCount(d_size, 0), demandCount(d_size, 0), requestDispl(d_size + 1, 0), demandDispl(d_size + 1, 0);
+        vector<int> ghostOwner(d_ghostGlobal.size(), d_rank);
+        for (iGhost = 0; iGhost < d_ghostGlobal.size(); iGhost++)
+        {
+            iRank = int(upper_bound(vtxdist.begin(), vtxdist.end(), d_ghostGlobal[iGhost]) - vtxdist.begin()) - 1;
+            if (iRank < 0 || iRank >= d_size || iRank == d_rank) { error = 1; continue; }
+            ghostOwner[iGhost] = iRank;
+            requestCount[iRank]++;
+        }
+
+        /*--- Collective, so every rank takes part even after a local error (its unknown owners count as itself) ---*/
+        if (d_size > 1 && !IsComplete(val_meshData, ghostOwner)) error = 1;
+
+        /*--- One exchange of the requested global points: the owners learn what they send ---*/
+        vector<unsigned long> demand;
+        if (d_size > 1)
+        {
+            mpi.Alltoall(&requestCount[0], 1, MPI_INT, &demandCount[0], 1, MPI_INT);
+            for (iRank = 0; iRank < d_size; iRank++)
+            {
+                requestDispl[iRank + 1] = requestDispl[iRank] + requestCount[iRank];
+                demandDispl[iRank + 1] = demandDispl[iRank] + demandCount[iRank];
+            }
+
+            vector<unsigned long> request(d_ghostGlobal);
+            request.resize(requestDispl[d_size] + 1);
+            demand.resize(demandDispl[d_size] + 1);
+            mpi.Alltoallv(&request[0], &requestCount[0], &requestDispl[0], MPI_UNSIGNED_LONG,
+                          &demand[0], &demandCount[0], &demandDispl[0], MPI_UNSIGNED_LONG);
+        }
+
+        /*--- SEND_RECEIVE lists of the neighbors, in increasing rank ---*/
+        d_neighbor.clear();
+        d_sendPtr.assign(1, 0);
+        d_recvPtr.assign(1, 0);
+        d_sendPoint.clear();
+        d_recvPoint.clear();
+        for (iRank = 0; iRank < d_size; iRank++)
+        {
+            if (requestCount[iRank] == 0 && demandCount[iRank] == 0) continue;
+            d_neighbor.push_back(iRank);
+
+            for (int iDemand = demandDispl[iRank]; iDemand < demandDispl[iRank + 1]; iDemand++)
+            {
+                long iLocal = GetLocal(demand[iDemand]);
+                if (iLocal < 0 || (unsigned long)iLocal >= d_numOwned) { error = 1; continue; }
+                d_sendPoint.push_back((unsigned long)iLocal);
+            }
+            for (int iRequest = requestDispl[iRank]; iRequest < requestDispl[iRank + 1]; iRequest++)
+                d_recvPoint.push_back(d_numOwned + iRequest);
+
+            d_sendPtr.push_back(d_sendPoint.size());
+            d_recvPtr.push_back(d_recvPoint.size());
+        }
+
+        int globalError = error;
+        if (d_size > 1) mpi.Allreduce(&error, &globalError, 1, MPI_INT, MPI_MAX);
+        return globalError == 0;
+    }
+
+    bool GeomGhostLayer::IsComplete(MeshData* val_meshData, const vector<int>& val_ghostOwner) const
+    {
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        const vector<unsigned long>& elemNodePtr = val_meshData->GetElemNodePtr();
+        const vector<unsigned long>& elemNode = val_meshData->GetElemNode();
+        int owner[N_POINTS_HEXAHEDRON];
+
+        /*--- Sum and count of the element signatures: the ones this rank must hold, and the ones it
+        vouches for towards every owner of their nodes when it is the first of them ---*/
+        vector<unsigned long> expect(2*d_size + 1, 0), expectAll(2*d_size + 1, 0);
+        unsigned long haveSum = 0, haveCount = 0;
+        for (unsigned long iElem = 0; iElem + 1 < elemNodePtr.size(); iElem++)
+        {
+            unsigned short iNode, numOwner = 0;
+            unsigned long signature = 0;
+            for (unsigned long jNode = elemNodePtr[iElem]; jNode < elemNodePtr[iElem + 1]; jNode++)
+            {
+                signature = GeomGhostLayerHash(signature ^ elemNode[jNode]) + jNode - elemNodePtr[iElem];
+                unsigned long iLocal = (unsigned long)GetLocal(elemNode[jNode]);
+                int iOwner = (iLocal < d_numOwned) ? d_rank : val_ghostOwner[iLocal - d_numOwned];
+                if (find(owner, owner + numOwner, iOwner) == owner + numOwner && numOwner < N_POINTS_HEXAHEDRON) owner[numOwner++] = iOwner;
+            }
+            if (find(owner, owner + numOwner, d_rank) == owner + numOwner) continue;
+
+            haveSum += signature;
+            haveCount++;
+            if (*min_element(owner, owner + numOwner) != d_rank) continue;
+            for (iNode = 0; iNode < numOwner; iNode++)
+            {
+                expect[owner[iNode]] += signature;
+                expect[d_size + owner[iNode]]++;
+            }
+        }
+
+        mpi.Allreduce(&expect[0], &expectAll[0], 2*d_size, MPI_UNSIGNED_LONG, MPI_SUM);
+        return expectAll[d_rank] == haveSum && expectAll[d_size + d_rank] == haveCount;
+    }
+
+    void GeomGhostLayer::Localize(MeshData* val_meshData, GeomHaloExchange& val_halo) const
+    {
+        long iNode;
+        unsigned long iNeighbor, iPoint;
+
+        vector<double>& coord = val_meshData->GetCoord();
+        vector<unsigned long>& pointGlobal = val_meshData->GetPointGlobal();
+        vector<unsigned long>& elemNode = val_meshData->GetElemNode();
+        vector<unsigned long>& boundPtr = val_meshData->GetBoundPtr();
+        vector<unsigned short>& boundType = val_meshData->GetBoundType();
+        vector<unsigned long>& boundNodePtr = val_meshData->GetBoundNodePtr();
+        vector<unsigned long>& boundNode = val_meshData->GetBoundNode();
+        const unsigned short numDim = val_meshData->GetNumDim();
+
+        /*--- Nodes of the elements and of the boundary elements as local points ---*/
+        const long numElemNode = (long)elemNode.size(), numBoundNode = (long)boundNode.size();
+#pragma omp parallel for schedule(static)
+        for (iNode = 0; iNode < numElemNode; iNode++) elemNode[iNode] = (unsigned long)GetLocal(elemNode[iNode]);
+#pragma omp parallel for schedule(static)
+        for (iNode = 0; iNode < numBoundNode; iNode++) boundNode[iNode] = (unsigned long)GetLocal(boundNode[iNode]);
+
+        pointGlobal.resize(d_numOwned);
+        pointGlobal.insert(pointGlobal.end(), d_ghostGlobal.begin(), d_ghostGlobal.end());
+        coord.resize(pointGlobal.size()*numDim, 0.0);
+
+        /*--- One send and one receive marker per neighbor, made of vertices ---*/
+        if (boundPtr.empty()) boundPtr.assign(1, 0);
+        if (boundNodePtr.empty()) boundNodePtr.assign(1, 0);
+        const unsigned short numMarker = (unsigned short)(boundPtr.size() - 1);
+        for (iNeighbor = 0; iNeighbor < d_neighbor.size(); iNeighbor++)
+        {
+            for (unsigned short iSide = 0; iSide < 2; iSide++)
+            {
+                const unsigned long* point = (iSide == 0) ? GetSendPoint(iNeighbor) : GetRecvPoint(iNeighbor);
+                unsigned long numPoint = (iSide == 0) ? GetNumSend(iNeighbor) : GetNumRecv(iNeighbor);
+                for (iPoint = 0; iPoint < numPoint; iPoint++)
+                {
+                    boundType.push_back(VERTEX);
+                    boundNode.push_back(point[iPoint]);
+                    boundNodePtr.push_back(boundNode.size());
+                }
+                boundPtr.push_back(boundType.size());
+            }
+        }
+
+        val_meshData->SetFlatCount();
+        val_meshData->SetNumPointDomain(d_numOwned);
+        val_meshData->SetNumPointGhost(d_ghostGlobal.size());
+
+        /*--- SEND_TO of the markers: rank+1 on the send side, -(rank+1) on the receive side ---*/
+        vector<short>& markerSendRecv = val_meshData->GetMarkerAllSendRecv();
+        for (iNeighbor = 0; iNeighbor < d_neighbor.size(); iNeighbor++)
+        {
+            unsigned short iMarker = (unsigned short)(numMarker + 2*iNeighbor);
+            val_meshData->SetMarkerTag(iMarker, "SEND_RECEIVE");
+            val_meshData->SetMarkerTag(iMarker + 1, "SEND_RECEIVE");
+            markerSendRecv[iMarker] = (short)(d_neighbor[iNeighbor] + 1);
+            markerSendRecv[iMarker + 1] = (short)(-d_neighbor[iNeighbor] - 1);
+        }
+
+        /*--- Coordinates of the ghosts from their owners ---*/
+        for (iNeighbor = 0; iNeighbor < d_neighbor.size(); iNeighbor++)
+            val_halo.AddPair(d_neighbor[iNeighbor], GetNumSend(iNeighbor), GetSendPoint(iNeighbor),
+                             d_neighbor[iNeighbor], GetNumRecv(iNeighbor), GetRecvPoint(iNeighbor));
+        if (!coord.empty()) val_halo.Exchange(numDim, &coord[0]);
+    }
+}
@@ -0,0 +1,141 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Ghost layer of a distributed mesh with global-to-local hash maps
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMGHOSTLAYER_HPP
+#define ARIES_GEOMGHOSTLAYER_HPP
+
+#include <cstddef>
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    class MeshData;
+    class GeomHaloExchange;
+
+    /*!
+     * \brief Ghost points of the mesh of a rank and the SEND_RECEIVE lists that fill them.
+     *
+     * The rank owns the points of its flat arrays in MeshData (a contiguous
+     * range of global indices, as left by the linear-partition readers), and
+     * its elements and boundary elements name their nodes by global index.
+     * Every node that is not owned is a ghost; its owner is found from the
+     * first global point of every rank, so no array is sized by the global
+     * number of points. The global-to-local numbering of the owned points is an
+     * offset when they are numbered contiguously, and an open-addressing hash
+     * table holds the ghosts (and the owned points otherwise). The ghosts are
+     * numbered after the owned points, grouped by owner, and one all-to-all
+     * exchange of their global indices tells every owner which of its points
+     * to send, which gives both sides of the SEND_RECEIVE lists at once.
+     * Localize then turns the nodes into local indices, appends the ghosts
+     * and one send and one receive marker per neighbor rank to MeshData,
+     * and fills the ghost coordinates through a GeomHaloExchange.
+     *
+     * The ghosts only come from the local elements, so every rank must hold
+     * every element with a node among its points, as MeshReaderSU2,
+     * GeomMeshPipeline and GeomMeshFileNative leave it; a partition of the
+     * elements by index would miss ghosts and send lists. Build checks it:
+     * every rank sums a signature of the elements touching its points, the
+     * first owner of the nodes of every element adds it for every other
+     * owner too, and one reduction of a sum and a count per rank tells each
+     * rank whether it holds them all.
+     */
+    class GeomGhostLayer
+    {
+    public:
+        GeomGhostLayer();
+        ~GeomGhostLayer();
+
+        /*!
+         * \brief Find the ghost points of the mesh and exchange the requests with their owners (collective).
+         * \param[in] val_meshData - Flat arrays of the mesh, nodes as global indices.
+         * \param[in] val_vtxdist - First global point owned by every rank (size+1), <code>NULL</code> to gather it from the number of owned points.
+         * \return <code>false</code> if a rank requested a point its owner does not hold, or misses elements around its points.
+         */
+        bool Build(MeshData* val_meshData, const unsigned long* val_vtxdist = NULL);
+
+        /*!
+         * \brief Renumber the nodes of the mesh to local indices, append the ghost points and the SEND_RECEIVE markers, and fill the ghost coordinates (collective).
+         * \param[in,out] val_meshData - Mesh given to Build.
+         * \param[out] val_halo - Exchange of the SEND_RECEIVE lists, one pair per neighbor rank.
+         */
+        void Localize(MeshData* val_meshData, GeomHaloExchange& val_halo) const;
+
+        /*!
+         * \brief Local index of a global point, -1 if it is neither owned nor a ghost.
+         */
+        long GetLocal(unsigned long val_global) const;
+
+        unsigned long GetNumOwned() const { return d_numOwned; };
+        unsigned long GetNumGhost() const { return d_ghostGlobal.size(); };
+        unsigned long GetGhostGlobal(unsigned long val_iGhost) const { return d_ghostGlobal[val_iGhost]; };
+
+        unsigned long GetNumNeighbor() const { return d_neighbor.size(); };
+        int GetNeighbor(unsigned long val_iNeighbor) const { return d_neighbor[val_iNeighbor]; };
+        unsigned long GetNumSend(unsigned long val_iNeighbor) const { return d_sendPtr[val_iNeighbor + 1] - d_sendPtr[val_iNeighbor]; };
+        unsigned long GetNumRecv(unsigned long val_iNeighbor) const { return d_recvPtr[val_iNeighbor + 1] - d_recvPtr[val_iNeighbor]; };
+
+        /*!
+         * \brief Local points sent to and received from a neighbor rank.
+         */
+        const unsigned long* GetSendPoint(unsigned long val_iNeighbor) const { return d_sendPoint.empty() ? NULL : &d_sendPoint[0] + d_sendPtr[val_iNeighbor]; };
+        const unsigned long* GetRecvPoint(unsigned long val_iNeighbor) const { return d_recvPoint.empty() ? NULL : &d_recvPoint[0] + d_recvPtr[val_iNeighbor]; };
+
+    private:
+        /*!
+         * \brief Slot of a global point in the table: the slot holding it or the empty slot where it goes.
+         */
+        unsigned long FindSlot(unsigned long val_global) const;
+
+        /*!
+         * \brief Insert a global point if it is not in the table yet.
+         * \return <code>true</code> if it was inserted.
+         */
+        bool Insert(unsigned long val_global, unsigned long val_local);
+
+        void Rehash(unsigned long val_capacity);
+
+        /*!
+         * \brief Whether this rank holds every element around its points that another rank holds (collective).
+         * \param[in] val_ghostOwner - Owner rank of every ghost.
+         */
+        bool IsComplete(MeshData* val_meshData, const vector<int>& val_ghostOwner) const;
+
+        static const unsigned long d_empty;     /*!< \brief Key of an empty slot. */
+
+        vector<unsigned long> d_key;            /*!< \brief Global points of the slots of the table. */
+        vector<unsigned long> d_value;          /*!< \brief Local points of the slots of the table. */
+        unsigned long d_numKey;                 /*!< \brief Number of filled slots. */
+
+        unsigned long d_numOwned;               /*!< \brief Number of points owned by this rank. */
+        unsigned long d_firstOwned;             /*!< \brief Global index of the first owned point. */
+        bool d_isContiguous;                    /*!< \brief Whether the owned points are d_firstOwned, d_firstOwned+1, ... (not in the table). */
+        vector<unsigned long> d_ghostGlobal;    /*!< \brief Global index of the ghosts, grouped by owner. */
+
+        vector<int> d_neighbor;                 /*!< \brief Ranks exchanging points with this one, in increasing order. */
+        vector<unsigned long> d_sendPtr;        /*!< \brief Offsets of the sent points of every neighbor. */
+        vector<unsigned long> d_sendPoint;      /*!< \brief Local points sent. */
+        vector<unsigned long> d_recvPtr;        /*!< \brief Offsets of the received points of every neighbor. */
+        vector<unsigned long> d_recvPoint;      /*!< \brief Local points received (ghosts). */
+
+        int d_rank;                             /*!< \brief Rank of this process. */
+        int d_size;                             /*!< \brief Number of ranks. */
+    };
+}
+
+#endif
@@ -0,0 +1,279 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Green-Gauss and least-squares gradients on the dual grid
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomGradient.hpp"
+
+#include "AriesMPI.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace ARIES
+{
+    GeomGradient::GeomGradient()
+    {
+        d_numDim = 0;
+        d_numPoint = 0;
+    }
+
+    GeomGradient::~GeomGradient()
+    {
+    }
+
+    void GeomGradient::SetGeometry(unsigned short val_numDim, unsigned long val_numPoint, const double* val_coord, const double* val_volume,
+                                   unsigned long val_numEdge, const unsigned long* val_edgeNode, const double* val_edgeNormal,
+                                   unsigned long val_numVertex, const unsigned long* val_vertexNode, const double* val_vertexNormal)
+    {
+        unsigned long iEdge, iVertex, iPoint;
+        unsigned short iDim;
+
+        d_numDim = val_numDim;
+        d_numPoint = val_numPoint;
+        d_coord.assign(val_coord, val_coord + val_numPoint*val_numDim);
+        d_volume.assign(val_volume, val_volume + val_numPoint);
+        d_edgeNode.assign(val_edgeNode, val_edgeNode + 2*val_numEdge);
+        d_edgeNormal.assign(val_edgeNormal, val_edgeNormal + val_numEdge*val_numDim);
+        d_coloring.Build(val_numPoint, val_numEdge, val_edgeNode);
+
+        /*--- Boundary vertices sorted by point, so the vertices of a point are summed by one thread ---*/
+        vector<pair<unsigned long, unsigned long> > vertex(val_numVertex);
+        for (iVertex = 0; iVertex < val_numVertex; iVertex++) vertex[iVertex] = make_pair(val_vertexNode[iVertex], iVertex);
+        sort(vertex.begin(), vertex.end());
+
+        d_vertexNode.resize(val_numVertex);
+        d_vertexNormal.resize(val_numVertex*val_numDim);
+        for (iVertex = 0; iVertex < val_numVertex; iVertex++)
+        {
+            d_vertexNode[iVertex] = vertex[iVertex].first;
+            for (iDim = 0; iDim < val_numDim; iDim++)
+                d_vertexNormal[iVertex*val_numDim + iDim] = val_vertexNormal[vertex[iVertex].second*val_numDim + iDim];
+        }
+
+        /*--- Neighbors of the points, from the edges ---*/
+        d_neighborPtr.assign(val_numPoint + 1, 0);
+        for (iEdge = 0; iEdge < 2*val_numEdge; iEdge++) d_neighborPtr[val_edgeNode[iEdge] + 1]++;
+        for (iPoint = 0; iPoint < val_numPoint; iPoint++) d_neighborPtr[iPoint + 1] += d_neighborPtr[iPoint];
+
+        d_neighbor.resize(2*val_numEdge);
+        vector<unsigned long> fill(d_neighborPtr.begin(), d_neighborPtr.end() - 1);
+        for (iEdge = 0; iEdge < val_numEdge; iEdge++)
+        {
+            d_neighbor[fill[val_edgeNode[2*iEdge]]++] = val_edgeNode[2*iEdge + 1];
+            d_neighbor[fill[val_edgeNode[2*iEdge + 1]]++] = val_edgeNode[2*iEdge];
+        }
+
+        SetLeastSquares(false);
+        SetLeastSquares(true);
+    }
+
+    void GeomGradient::SetLeastSquares(bool val_isWeighted)
+    {
+        long iPoint;
+        const unsigned short nDim = d_numDim;
+        vector<double>& inverse = d_inverse[val_isWeighted ? 1 : 0];
+        inverse.assign(d_numPoint*nDim*nDim, 0.0);
+
+#pragma omp parallel for schedule(static)
+        for (iPoint = 0; iPoint < (long)d_numPoint; iPoint++)
+        {
+            unsigned short iDim, jDim;
+            double matrix[3][3] = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 } }, delta[3] = { 0.0, 0.0, 0.0 };
+            double* result = &inverse[iPoint*nDim*nDim];
+
+            for (unsigned long jNeighbor = d_neighborPtr[iPoint]; jNeighbor < d_neighborPtr[iPoint + 1]; jNeighbor++)
+            {
+                unsigned long jPoint = d_neighbor[jNeighbor];
+                double weight = 0.0;
+                for (iDim = 0; iDim < nDim; iDim++)
+                {
+                    delta[iDim] = d_coord[jPoint*nDim + iDim] - d_coord[iPoint*nDim + iDim];
+                    weight += delta[iDim]*delta[iDim];
+                }
+                weight = (val_isWeighted && weight > 0.0) ? 1.0 / weight : 1.0;
+
+                for (iDim = 0; iDim < nDim; iDim++)
+                    for (jDim = 0; jDim < nDim; jDim++)
+                        matrix[iDim][jDim] += weight*delta[iDim]*delta[jDim];
+            }
+
+            /*--- Points with a degenerate stencil get a zero gradient ---*/
+            if (nDim == 2)
+            {
+                double det = matrix[0][0]*matrix[1][1] - matrix[0][1]*matrix[1][0];
+                if (fabs(det) <= 1E-14*(matrix[0][0]*matrix[1][1] + 1E-300)) continue;
+                result[0] = matrix[1][1] / det;  result[1] = -matrix[0][1] / det;
+                result[2] = -matrix[1][0] / det; result[3] = matrix[0][0] / det;
+            }
+            else
+            {
+                double det = matrix[0][0]*(matrix[1][1]*matrix[2][2] - matrix[1][2]*matrix[2][1])
+                           - matrix[0][1]*(matrix[1][0]*matrix[2][2] - matrix[1][2]*matrix[2][0])
+                           + matrix[0][2]*(matrix[1][0]*matrix[2][1] - matrix[1][1]*matrix[2][0]);
+                if (fabs(det) <= 1E-14*(matrix[0][0]*matrix[1][1]*matrix[2][2] + 1E-300)) continue;
+                for (iDim = 0; iDim < 3; iDim++)
+                    for (jDim = 0; jDim < 3; jDim++)
+                    {
+                        /*--- Cofactor of (jDim, iDim) ---*/
+                        unsigned short r0 = (jDim + 1) % 3, r1 = (jDim + 2) % 3, c0 = (iDim + 1) % 3, c1 = (iDim + 2) % 3;
+                        result[iDim*3 + jDim] = (matrix[r0][c0]*matrix[r1][c1] - matrix[r0][c1]*matrix[r1][c0]) / det;
+                    }
+            }
+        }
+    }
+
+    void GeomGradient::Compute(GradientType val_type, unsigned short val_numVar, const double* val_field, double* val_gradient) const
+    {
+        switch (val_type)
+        {
+        case Gradient_GreenGauss: ComputeGreenGauss(val_numVar, val_field, val_gradient); break;
+        case Gradient_LeastSquares: ComputeLeastSquares(false, val_numVar, val_field, val_gradient); break;
+        case Gradient_WeightedLeastSquares: ComputeLeastSquares(true, val_numVar, val_field, val_gradient); break;
+        }
+    }
+
+    void GeomGradient::ComputeGreenGauss(unsigned short val_numVar, const double* val_field, double* val_gradient) const
+    {
+        long iPoint, iBlock;
+        const unsigned short nDim = d_numDim, nVar = val_numVar;
+        const unsigned long nGrad = (unsigned long)nVar*nDim;
+
+#pragma omp parallel for schedule(static)
+        for (iPoint = 0; iPoint < (long)(d_numPoint*nGrad); iPoint++) val_gradient[iPoint] = 0.0;
+
+        /*--- Edges, color by color: the blocks of a color share no point ---*/
+        for (unsigned short iColor = 0; iColor < d_coloring.GetNumColor(); iColor++)
+        {
+#pragma omp parallel for schedule(dynamic, 1)
+            for (iBlock = (long)d_coloring.GetColorBlockBegin(iColor); iBlock < (long)d_coloring.GetColorBlockEnd(iColor); iBlock++)
+            {
+                for (unsigned long iPos = d_coloring.GetBlockBegin(iBlock); iPos < d_coloring.GetBlockEnd(iBlock); iPos++)
+                {
+                    unsigned long iEdge = d_coloring.GetEdge(iPos);
+                    const unsigned long i = d_edgeNode[2*iEdge], j = d_edgeNode[2*iEdge + 1];
+                    const double* normal = &d_edgeNormal[iEdge*nDim];
+                    const double* u_i = &val_field[i*nVar];
+                    const double* u_j = &val_field[j*nVar];
+                    double* grad_i = &val_gradient[i*nGrad];
+                    double* grad_j = &val_gradient[j*nGrad];
+
+                    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+                    {
+                        double average = 0.5*(u_i[iVar] + u_j[iVar]);
+                        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+                        {
+                            grad_i[iVar*nDim + iDim] += average*normal[iDim];
+                            grad_j[iVar*nDim + iDim] -= average*normal[iDim];
+                        }
+                    }
+                }
+            }
+        }
+
+        /*--- Boundary closure, the vertex normals point into the domain ---*/
+        const long nVertex = (long)d_vertexNode.size();
+#pragma omp parallel for schedule(static)
+        for (long iVertex = 0; iVertex < nVertex; iVertex++)
+        {
+            /*--- The first vertex of a point sums all of them ---*/
+            if (iVertex > 0 && d_vertexNode[iVertex - 1] == d_vertexNode[iVertex]) continue;
+
+            const unsigned long i = d_vertexNode[iVertex];
+            const double* u_i = &val_field[i*nVar];
+            double* grad_i = &val_gradient[i*nGrad];
+            for (long jVertex = iVertex; jVertex < nVertex && d_vertexNode[jVertex] == i; jVertex++)
+            {
+                const double* normal = &d_vertexNormal[jVertex*nDim];
+                for (unsigned short iVar = 0; iVar < nVar; iVar++)
+                    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+                        grad_i[iVar*nDim + iDim] -= u_i[iVar]*normal[iDim];
+            }
+        }
+
+#pragma omp parallel for schedule(static)
+        for (iPoint = 0; iPoint < (long)d_numPoint; iPoint++)
+        {
+            double factor = (d_volume[iPoint] > 0.0) ? 1.0 / d_volume[iPoint] : 0.0;
+            for (unsigned long iGrad = 0; iGrad < nGrad; iGrad++) val_gradient[iPoint*nGrad + iGrad] *= factor;
+        }
+    }
+
+    void GeomGradient::ComputeLeastSquares(bool val_isWeighted, unsigned short val_numVar, const double* val_field, double* val_gradient) const
+    {
+        const unsigned short nDim = d_numDim, nVar = val_numVar;
+        const unsigned long nGrad = (unsigned long)nVar*nDim;
+        const vector<double>& inverse = d_inverse[val_isWeighted ? 1 : 0];
+
+#pragma omp parallel
+        {
+            vector<double> rhs(nGrad);
+
+#pragma omp for schedule(static)
+            for (long iPoint = 0; iPoint < (long)d_numPoint; iPoint++)
+            {
+                unsigned short iVar, iDim, jDim;
+                double delta[3] = { 0.0, 0.0, 0.0 };
+                const double* u_i = &val_field[iPoint*nVar];
+                const double* matrix = &inverse[iPoint*nDim*nDim];
+                double* grad_i = &val_gradient[iPoint*nGrad];
+
+                std::fill(rhs.begin(), rhs.end(), 0.0);
+                for (unsigned long jNeighbor = d_neighborPtr[iPoint]; jNeighbor < d_neighborPtr[iPoint + 1]; jNeighbor++)
+                {
+                    unsigned long jPoint = d_neighbor[jNeighbor];
+                    const double* u_j = &val_field[jPoint*nVar];
+                    double weight = 0.0;
+                    for (iDim = 0; iDim < nDim; iDim++)
+                    {
+                        delta[iDim] = d_coord[jPoint*nDim + iDim] - d_coord[iPoint*nDim + iDim];
+                        weight += delta[iDim]*delta[iDim];
+                    }
+                    weight = (val_isWeighted && weight > 0.0) ? 1.0 / weight : 1.0;
+
+                    for (iVar = 0; iVar < nVar; iVar++)
+                    {
+                        double difference = weight*(u_j[iVar] - u_i[iVar]);
+                        for (iDim = 0; iDim < nDim; iDim++) rhs[iVar*nDim + iDim] += difference*delta[iDim];
+                    }
+                }
+
+                for (iVar = 0; iVar < nVar; iVar++)
+                    for (iDim = 0; iDim < nDim; iDim++)
+                    {
+                        double value = 0.0;
+                        for (jDim = 0; jDim < nDim; jDim++) value += matrix[iDim*nDim + jDim]*rhs[iVar*nDim + jDim];
+                        grad_i[iVar*nDim + iDim] = value;
+                    }
+            }
+        }
+    }
+
+    double GeomGradient::Benchmark(GradientType val_type, unsigned short val_numVar, unsigned short val_numRepeat) const
+    {
+        vector<double> field(d_numPoint*val_numVar), gradient(d_numPoint*val_numVar*d_numDim);
+        for (unsigned long iValue = 0; iValue < field.size(); iValue++) field[iValue] = rand() / double(RAND_MAX);
+
+        /*--- One computation to warm up the caches ---*/
+        Compute(val_type, val_numVar, &field[0], &gradient[0]);
+
+        double start = AriesMPI::Wtime();
+        for (unsigned short iRepeat = 0; iRepeat < val_numRepeat; iRepeat++)
+            Compute(val_type, val_numVar, &field[0], &gradient[0]);
+        double elapsed = AriesMPI::Wtime() - start;
+
+        return (elapsed > 0.0) ? double(d_numPoint)*val_numVar*val_numRepeat / elapsed : 0.0;
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Green-Gauss and least-squares gradients on the dual grid
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMGRADIENT_HPP
+#define ARIES_GEOMGRADIENT_HPP
+
+#include "GeomEdgeColoring.hpp"
+
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Gradients of point fields on the median dual grid, shared by the solvers.
+     *
+     * The geometry is copied once into flat arrays: coordinates, control
+     * volumes, edge nodes and normals, boundary vertex nodes and normals.
+     * Green-Gauss sums 0.5*(u_i+u_j)*n_ij over the edges and u_i*n over the
+     * boundary vertices (normals point into the domain) and divides by the
+     * control volume; the edge loop runs color by color on the blocks of a
+     * GeomEdgeColoring, so no two threads write the same point. Weighted
+     * least squares solves, at every point, M_i g_i = sum_j w_ij d_ij (u_j-u_i)
+     * with d_ij = x_j-x_i and w_ij = 1/|d_ij|^2 (or 1); the inverses of the
+     * geometric matrices M_i are computed once with the geometry, so a
+     * gradient is a gather over the neighbors and a small matrix product,
+     * threaded over the points. The variables of a point are stored together
+     * so the innermost loops run over contiguous values. Gradients are only
+     * complete on the points whose neighbors are all local; halo points need
+     * a halo exchange afterwards.
+     */
+    class GeomGradient
+    {
+    public:
+        typedef enum
+        {
+            Gradient_GreenGauss = 0,            /*!< \brief Green-Gauss on the dual control volumes. */
+            Gradient_LeastSquares = 1,          /*!< \brief Unweighted least squares. */
+            Gradient_WeightedLeastSquares = 2   /*!< \brief Inverse-distance-squared weighted least squares. */
+        } GradientType;
+
+        GeomGradient();
+        ~GeomGradient();
+
+        /*!
+         * \brief Copy the dual grid; every later call uses this geometry.
+         * \param[in] val_numDim - Number of dimensions of the problem.
+         * \param[in] val_numPoint - Number of points.
+         * \param[in] val_coord - Coordinates, <i>[iPoint*nDim+iDim]</i>.
+         * \param[in] val_volume - Control volumes.
+         * \param[in] val_numEdge - Number of edges.
+         * \param[in] val_edgeNode - Nodes of the edges, <i>[iEdge*2+iNode]</i>.
+         * \param[in] val_edgeNormal - Normals of the edges, from the first node to the second, <i>[iEdge*nDim+iDim]</i>.
+         * \param[in] val_numVertex - Number of boundary vertices.
+         * \param[in] val_vertexNode - Point of every boundary vertex.
+         * \param[in] val_vertexNormal - Normals of the vertices, into the domain, <i>[iVertex*nDim+iDim]</i>.
+         */
+        void SetGeometry(unsigned short val_numDim, unsigned long val_numPoint, const double* val_coord, const double* val_volume,
+                         unsigned long val_numEdge, const unsigned long* val_edgeNode, const double* val_edgeNormal,
+                         unsigned long val_numVertex, const unsigned long* val_vertexNode, const double* val_vertexNormal);
+
+        /*!
+         * \brief Compute the gradients of a field.
+         * \param[in] val_type - Method.
+         * \param[in] val_numVar - Number of variables per point.
+         * \param[in] val_field - Field, <i>[iPoint*nVar+iVar]</i>.
+         * \param[out] val_gradient - Gradients, <i>[(iPoint*nVar+iVar)*nDim+iDim]</i>.
+         */
+        void Compute(GradientType val_type, unsigned short val_numVar, const double* val_field, double* val_gradient) const;
+
+        /*!
+         * \brief Time the computation on a random field (run by GEOM_GeometryPhysical::SetGradient_Engine when ARIES_BENCHMARK is set).
+         * \param[in] val_type - Method.
+         * \param[in] val_numVar - Number of variables per point.
+         * \param[in] val_numRepeat - Number of computations timed.
+         * \return Point gradients (one variable at one point) computed per second.
+         */
+        double Benchmark(GradientType val_type, unsigned short val_numVar, unsigned short val_numRepeat) const;
+
+        unsigned long GetNumPoint() const { return d_numPoint; };
+        const GeomEdgeColoring& GetEdgeColoring() const { return d_coloring; };
+
+    private:
+        void ComputeGreenGauss(unsigned short val_numVar, const double* val_field, double* val_gradient) const;
+        void ComputeLeastSquares(bool val_isWeighted, unsigned short val_numVar, const double* val_field, double* val_gradient) const;
+        void SetLeastSquares(bool val_isWeighted);
+
+        unsigned short d_numDim;                /*!< \brief Number of dimensions of the problem. */
+        unsigned long d_numPoint;               /*!< \brief Number of points. */
+        vector<double> d_coord;                 /*!< \brief Coordinates of the points. */
+        vector<double> d_volume;                /*!< \brief Control volumes. */
+
+        vector<unsigned long> d_edgeNode;       /*!< \brief Nodes of the edges. */
+        vector<double> d_edgeNormal;            /*!< \brief Normals of the edges. */
+        GeomEdgeColoring d_coloring;            /*!< \brief Conflict-free order of the edges. */
+
+        vector<unsigned long> d_vertexNode;     /*!< \brief Points of the boundary vertices. */
+        vector<double> d_vertexNormal;          /*!< \brief Normals of the boundary vertices. */
+
+        vector<unsigned long> d_neighborPtr;    /*!< \brief CSR offsets of the neighbors. */
+        vector<unsigned long> d_neighbor;       /*!< \brief Neighbors of the points. */
+        vector<double> d_inverse[2];            /*!< \brief Inverse least-squares matrices, unweighted and weighted, <i>[iPoint*nDim*nDim]</i>. */
+    };
+}
+
+#endif
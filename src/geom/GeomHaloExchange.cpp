@@ -0,0 +1,190 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Reusable halo exchange of point data over persistent requests
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomHaloExchange.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ARIES
+{
+    GeomHaloExchange::GeomHaloExchange()
+    {
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        d_rank = (mpi.GetSize() > 1) ? mpi.GetRank() : 0;
+        d_numDim = 0;
+        d_sendPtr.assign(1, 0);
+        d_recvPtr.assign(1, 0);
+    }
+
+    GeomHaloExchange::~GeomHaloExchange()
+    {
+        FreeChannels();
+    }
+
+    void GeomHaloExchange::FreeChannels()
+    {
+        /*--- Requests can only be freed while MPI is running ---*/
+        int finalized = 1;
+        AriesMPI::Finalized(&finalized);
+        if (!finalized)
+            for (map<unsigned short, Channel>::iterator it = d_channel.begin(); it != d_channel.end(); ++it)
+                for (unsigned long iRequest = 0; iRequest < it->second.request.size(); iRequest++)
+                    AriesMPI::Request_free(&it->second.request[iRequest]);
+        d_channel.clear();
+    }
+
+    void GeomHaloExchange::AddPair(int val_sendRank, unsigned long val_numSend, const unsigned long* val_sendPoint,
+                                   int val_recvRank, unsigned long val_numRecv, const unsigned long* val_recvPoint,
+                                   const unsigned short* val_recvRotation)
+    {
+        FreeChannels();
+
+        /*--- The k-th pair with a rank uses tag k on both sides ---*/
+        d_sendTag.push_back((int)count(d_sendRank.begin(), d_sendRank.end(), val_sendRank));
+        d_recvTag.push_back((int)count(d_recvRank.begin(), d_recvRank.end(), val_recvRank));
+        d_sendRank.push_back(val_sendRank);
+        d_recvRank.push_back(val_recvRank);
+
+        d_sendPoint.insert(d_sendPoint.end(), val_sendPoint, val_sendPoint + val_numSend);
+        d_recvPoint.insert(d_recvPoint.end(), val_recvPoint, val_recvPoint + val_numRecv);
+        if (val_recvRotation != NULL) d_recvRotation.insert(d_recvRotation.end(), val_recvRotation, val_recvRotation + val_numRecv);
+        else d_recvRotation.resize(d_recvPoint.size(), 0);
+
+        d_sendPtr.push_back(d_sendPoint.size());
+        d_recvPtr.push_back(d_recvPoint.size());
+    }
+
+    void GeomHaloExchange::SetRotation(unsigned short val_numDim, unsigned short val_numRotation, const double* val_matrix)
+    {
+        d_numDim = val_numDim;
+        d_rotation.assign(val_matrix, val_matrix + 9*val_numRotation);
+        d_isIdentity.assign(val_numRotation, true);
+
+        for (unsigned short iRotation = 0; iRotation < val_numRotation; iRotation++)
+            for (unsigned short iEntry = 0; iEntry < 9; iEntry++)
+                if (fabs(d_rotation[9*iRotation + iEntry] - ((iEntry % 4 == 0) ? 1.0 : 0.0)) > 1.0E-15) d_isIdentity[iRotation] = false;
+    }
+
+    GeomHaloExchange::Channel& GeomHaloExchange::GetChannel(unsigned short val_numVar)
+    {
+        map<unsigned short, Channel>::iterator it = d_channel.find(val_numVar);
+        if (it != d_channel.end()) return it->second;
+
+        Channel& channel = d_channel[val_numVar];
+        channel.send.resize(d_sendPoint.size()*val_numVar + 1);
+        channel.recv.resize(d_recvPoint.size()*val_numVar + 1);
+        channel.isActive = false;
+
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        for (unsigned long iPair = 0; iPair < d_sendRank.size(); iPair++)
+        {
+            if (d_recvRank[iPair] != d_rank)
+            {
+                channel.request.push_back(AriesMPI::Request());
+                mpi.Recv_init(&channel.recv[d_recvPtr[iPair]*val_numVar], int((d_recvPtr[iPair + 1] - d_recvPtr[iPair])*val_numVar), MPI_DOUBLE,
+                              d_recvRank[iPair], d_recvTag[iPair], &channel.request.back());
+            }
+            if (d_sendRank[iPair] != d_rank)
+            {
+                channel.request.push_back(AriesMPI::Request());
+                mpi.Send_init(&channel.send[d_sendPtr[iPair]*val_numVar], int((d_sendPtr[iPair + 1] - d_sendPtr[iPair])*val_numVar), MPI_DOUBLE,
+                              d_sendRank[iPair], d_sendTag[iPair], &channel.request.back());
+            }
+        }
+        return channel;
+    }
+
+    double* GeomHaloExchange::GetSendBuffer(unsigned short val_numVar)
+    {
+        return &GetChannel(val_numVar).send[0];
+    }
+
+    void GeomHaloExchange::Start(unsigned short val_numVar)
+    {
+        Channel& channel = GetChannel(val_numVar);
+        if (!channel.request.empty()) AriesMPI::Startall((int)channel.request.size(), &channel.request[0]);
+        channel.isActive = true;
+    }
+
+    const double* GeomHaloExchange::Finish(unsigned short val_numVar, bool val_isVector)
+    {
+        unsigned long iPair, jPair, iRecv;
+        Channel& channel = GetChannel(val_numVar);
+        if (!channel.isActive) Start(val_numVar);
+
+        /*--- Messages to this rank: the k-th send to self matches the k-th receive from self ---*/
+        for (iPair = 0; iPair < d_recvRank.size(); iPair++)
+        {
+            if (d_recvRank[iPair] != d_rank) continue;
+            for (jPair = 0; jPair < d_sendRank.size(); jPair++)
+                if (d_sendRank[jPair] == d_rank && d_sendTag[jPair] == d_recvTag[iPair]) break;
+            if (jPair == d_sendRank.size()) continue;
+
+            unsigned long numValue = min(d_recvPtr[iPair + 1] - d_recvPtr[iPair], d_sendPtr[jPair + 1] - d_sendPtr[jPair])*val_numVar;
+            copy(channel.send.begin() + d_sendPtr[jPair]*val_numVar, channel.send.begin() + d_sendPtr[jPair]*val_numVar + numValue,
+                 channel.recv.begin() + d_recvPtr[iPair]*val_numVar);
+        }
+
+        if (!channel.request.empty())
+        {
+            vector<AriesMPI::Status> status(channel.request.size());
+            AriesMPI::Waitall((int)channel.request.size(), &channel.request[0], &status[0]);
+        }
+        channel.isActive = false;
+
+        /*--- Periodic rotation of the received vectors ---*/
+        if (val_isVector && !d_isIdentity.empty())
+        {
+            double rotated[3];
+            unsigned short iDim, jDim;
+            for (iRecv = 0; iRecv < d_recvPoint.size(); iRecv++)
+            {
+                unsigned short iRotation = d_recvRotation[iRecv];
+                if (iRotation >= d_isIdentity.size() || d_isIdentity[iRotation]) continue;
+
+                const double* matrix = &d_rotation[9*iRotation];
+                double* value = &channel.recv[iRecv*val_numVar];
+                for (iDim = 0; iDim < d_numDim; iDim++)
+                {
+                    rotated[iDim] = 0.0;
+                    for (jDim = 0; jDim < d_numDim; jDim++) rotated[iDim] += matrix[3*iDim + jDim]*value[jDim];
+                }
+                for (iDim = 0; iDim < d_numDim; iDim++) value[iDim] = rotated[iDim];
+            }
+        }
+
+        return &channel.recv[0];
+    }
+
+    void GeomHaloExchange::Exchange(unsigned short val_numVar, double* val_field, bool val_isVector)
+    {
+        unsigned long iSend, iRecv;
+        unsigned short iVar;
+
+        double* send = GetSendBuffer(val_numVar);
+        for (iSend = 0; iSend < d_sendPoint.size(); iSend++)
+            for (iVar = 0; iVar < val_numVar; iVar++)
+                send[iSend*val_numVar + iVar] = val_field[d_sendPoint[iSend]*val_numVar + iVar];
+
+        Start(val_numVar);
+        const double* recv = Finish(val_numVar, val_isVector);
+
+        for (iRecv = 0; iRecv < d_recvPoint.size(); iRecv++)
+            for (iVar = 0; iVar < val_numVar; iVar++)
+                val_field[d_recvPoint[iRecv]*val_numVar + iVar] = recv[iRecv*val_numVar + iVar];
+    }
+}
@@ -0,0 +1,130 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Reusable halo exchange of point data over persistent requests
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMHALOEXCHANGE_HPP
+#define ARIES_GEOMHALOEXCHANGE_HPP
+
+#include "AriesMPI.hpp"
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Communication pattern of the send/receive halos, set up once and reused for any point field.
+     *
+     * The pattern is a list of pairs, each one sending the values of some local
+     * points to a rank and receiving the values of other local points from a
+     * rank (the SEND_RECEIVE markers). For every number of variables per point
+     * the buffers and the persistent send and receive requests are created on
+     * first use, so an exchange is a single start of all the requests, a wait
+     * and an unpack, with no allocation. Messages to this rank (periodic halos
+     * in serial) are copied directly. Received vectors (coordinates, grid
+     * velocities) can be rotated by the periodic rotation of their point.
+     */
+    class GeomHaloExchange
+    {
+    public:
+        GeomHaloExchange();
+        ~GeomHaloExchange();
+
+        /*!
+         * \brief Add a pair of messages. Pairs with the same ranks must be added in the same order on both sides.
+         * \param[in] val_sendRank - Rank the values are sent to.
+         * \param[in] val_numSend - Number of points sent.
+         * \param[in] val_sendPoint - Local points sent.
+         * \param[in] val_recvRank - Rank the values are received from.
+         * \param[in] val_numRecv - Number of points received.
+         * \param[in] val_recvPoint - Local points received.
+         * \param[in] val_recvRotation - Periodic rotation of every received point (NULL for none).
+         */
+        void AddPair(int val_sendRank, unsigned long val_numSend, const unsigned long* val_sendPoint,
+                     int val_recvRank, unsigned long val_numRecv, const unsigned long* val_recvPoint,
+                     const unsigned short* val_recvRotation = NULL);
+
+        /*!
+         * \brief Set the periodic rotation matrices, <i>[iRotation*9+iDim*3+jDim]</i>; rotation 0 is left out if it is the identity.
+         */
+        void SetRotation(unsigned short val_numDim, unsigned short val_numRotation, const double* val_matrix);
+
+        unsigned long GetNumSend() const { return d_sendPoint.size(); };
+        unsigned long GetSendPoint(unsigned long val_iSend) const { return d_sendPoint[val_iSend]; };
+        unsigned long GetNumRecv() const { return d_recvPoint.size(); };
+        unsigned long GetRecvPoint(unsigned long val_iRecv) const { return d_recvPoint[val_iRecv]; };
+
+        /*!
+         * \brief Buffer to fill with the values of the sent points, <i>[iSend*nVar+iVar]</i>.
+         */
+        double* GetSendBuffer(unsigned short val_numVar);
+
+        /*!
+         * \brief Start the messages of a filled send buffer.
+         */
+        void Start(unsigned short val_numVar);
+
+        /*!
+         * \brief Wait for the messages started by Start.
+         * \param[in] val_numVar - Number of variables per point.
+         * \param[in] val_isVector - Rotate the received values as vectors of nDim components.
+         * \return Values of the received points, <i>[iRecv*nVar+iVar]</i>.
+         */
+        const double* Finish(unsigned short val_numVar, bool val_isVector = false);
+
+        /*!
+         * \brief Pack, exchange and unpack a field stored as <i>[iPoint*nVar+iVar]</i>.
+         */
+        void Exchange(unsigned short val_numVar, double* val_field, bool val_isVector = false);
+
+    private:
+        /*!
+         * \brief Buffers and persistent requests for a number of variables per point.
+         */
+        struct Channel
+        {
+            vector<double> send;
+            vector<double> recv;
+            vector<AriesMPI::Request> request;
+            bool isActive;
+        };
+
+        Channel& GetChannel(unsigned short val_numVar);
+        void FreeChannels();
+
+        vector<int> d_sendRank;                 /*!< \brief Rank of every pair sends to. */
+        vector<int> d_recvRank;                 /*!< \brief Rank of every pair receives from. */
+        vector<int> d_sendTag;                  /*!< \brief Tag of the message sent by every pair. */
+        vector<int> d_recvTag;                  /*!< \brief Tag of the message received by every pair. */
+        vector<unsigned long> d_sendPtr;        /*!< \brief Offsets of the sent points of every pair. */
+        vector<unsigned long> d_recvPtr;        /*!< \brief Offsets of the received points of every pair. */
+        vector<unsigned long> d_sendPoint;      /*!< \brief Sent points. */
+        vector<unsigned long> d_recvPoint;      /*!< \brief Received points. */
+        vector<unsigned short> d_recvRotation;  /*!< \brief Periodic rotation of the received points. */
+
+        unsigned short d_numDim;                /*!< \brief Number of components of a rotated vector. */
+        vector<double> d_rotation;              /*!< \brief Rotation matrices. */
+        vector<bool> d_isIdentity;              /*!< \brief Rotations that can be skipped. */
+
+        map<unsigned short, Channel> d_channel; /*!< \brief Buffers for every number of variables. */
+        int d_rank;                             /*!< \brief Rank of this process. */
+    };
+}
+
+#endif
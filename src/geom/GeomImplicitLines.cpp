@@ -0,0 +1,132 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Lines of strong coupling in stretched regions of the dual grid
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomImplicitLines.hpp"
+
+#include <cmath>
+
+namespace ARIES
+{
+    GeomImplicitLines::GeomImplicitLines()
+    {
+        d_linePtr.assign(1, 0);
+    }
+
+    GeomImplicitLines::~GeomImplicitLines()
+    {
+    }
+
+    void GeomImplicitLines::Build(unsigned short val_numDim, unsigned long val_numPoint, unsigned long val_numEdge, const unsigned long* val_edgeNode,
+                                  const double* val_edgeNormal, const double* val_coord, const bool* val_isStart, const bool* val_isAllowed,
+                                  double val_threshold)
+    {
+        long iEdge, iPoint;
+        unsigned long jPoint;
+
+        d_linePtr.assign(1, 0);
+        d_linePoint.clear();
+        d_pointLine.assign(val_numPoint, -1);
+
+        /*--- Coupling of the edges: area of the dual face over the length ---*/
+        vector<double> coupling(val_numEdge);
+#pragma omp parallel for schedule(static)
+        for (iEdge = 0; iEdge < long(val_numEdge); iEdge++)
+        {
+            const double* coord0 = &val_coord[val_edgeNode[iEdge*2]*val_numDim];
+            const double* coord1 = &val_coord[val_edgeNode[iEdge*2 + 1]*val_numDim];
+            const double* normal = &val_edgeNormal[iEdge*val_numDim];
+            double area = 0.0, length = 0.0;
+            for (unsigned short iDim = 0; iDim < val_numDim; iDim++)
+            {
+                area += normal[iDim]*normal[iDim];
+                length += (coord1[iDim] - coord0[iDim])*(coord1[iDim] - coord0[iDim]);
+            }
+            coupling[iEdge] = (length > 0.0) ? sqrt(area / length) : 0.0;
+        }
+
+        /*--- Edges around the points (count, then fill) ---*/
+        vector<unsigned long> pointEdgePtr(val_numPoint + 1, 0), pointEdge(2*val_numEdge);
+        for (iEdge = 0; iEdge < long(val_numEdge); iEdge++)
+        {
+            pointEdgePtr[val_edgeNode[iEdge*2] + 1]++;
+            pointEdgePtr[val_edgeNode[iEdge*2 + 1] + 1]++;
+        }
+        for (jPoint = 0; jPoint < val_numPoint; jPoint++) pointEdgePtr[jPoint + 1] += pointEdgePtr[jPoint];
+
+        vector<unsigned long> position(pointEdgePtr.begin(), pointEdgePtr.end() - 1);
+        for (iEdge = 0; iEdge < long(val_numEdge); iEdge++)
+        {
+            pointEdge[position[val_edgeNode[iEdge*2]]++] = iEdge;
+            pointEdge[position[val_edgeNode[iEdge*2 + 1]]++] = iEdge;
+        }
+
+        /*--- Two strongest neighbors of every point, and whether the point is stretched ---*/
+        vector<long> strongest(val_numPoint, -1), second(val_numPoint, -1);
+        vector<unsigned char> isStretched(val_numPoint, 0);
+#pragma omp parallel for schedule(static)
+        for (iPoint = 0; iPoint < long(val_numPoint); iPoint++)
+        {
+            double maxCoupling = -1.0, secondCoupling = -1.0, minCoupling = -1.0;
+            for (unsigned long iPos = pointEdgePtr[iPoint]; iPos < pointEdgePtr[iPoint + 1]; iPos++)
+            {
+                unsigned long jEdge = pointEdge[iPos];
+                long kPoint = (val_edgeNode[jEdge*2] == (unsigned long)iPoint) ? val_edgeNode[jEdge*2 + 1] : val_edgeNode[jEdge*2];
+                double value = coupling[jEdge];
+                if (value > maxCoupling)
+                {
+                    second[iPoint] = strongest[iPoint]; secondCoupling = maxCoupling;
+                    strongest[iPoint] = kPoint; maxCoupling = value;
+                }
+                else if (value > secondCoupling)
+                {
+                    second[iPoint] = kPoint; secondCoupling = value;
+                }
+                if (minCoupling < 0.0 || value < minCoupling) minCoupling = value;
+            }
+            isStretched[iPoint] = (strongest[iPoint] >= 0 && maxCoupling >= val_threshold*minCoupling);
+        }
+
+        /*--- Grow the lines from the wall, in the order of the points ---*/
+        for (jPoint = 0; jPoint < val_numPoint; jPoint++)
+        {
+            if (!val_isStart[jPoint] || !val_isAllowed[jPoint] || !isStretched[jPoint] || d_pointLine[jPoint] >= 0) continue;
+
+            long iLine = d_linePtr.size() - 1;
+            unsigned long lastPoint = jPoint, begin = d_linePoint.size();
+            d_linePoint.push_back(jPoint);
+            d_pointLine[jPoint] = iLine;
+
+            for (;;)
+            {
+                long nextPoint = strongest[lastPoint];
+                if (nextPoint >= 0 && d_pointLine[nextPoint] == iLine) nextPoint = second[lastPoint];
+                if (nextPoint < 0 || !val_isAllowed[nextPoint] || !isStretched[nextPoint] || d_pointLine[nextPoint] >= 0) break;
+                if (strongest[nextPoint] != (long)lastPoint && second[nextPoint] != (long)lastPoint) break;
+                d_linePoint.push_back(nextPoint);
+                d_pointLine[nextPoint] = iLine;
+                lastPoint = nextPoint;
+            }
+
+            /*--- A single point is not a line ---*/
+            if (d_linePoint.size() - begin < 2)
+            {
+                d_pointLine[jPoint] = -1;
+                d_linePoint.resize(begin);
+            }
+            else d_linePtr.push_back(d_linePoint.size());
+        }
+    }
+}
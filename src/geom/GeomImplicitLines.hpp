@@ -0,0 +1,88 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Lines of strong coupling in stretched regions of the dual grid
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMIMPLICITLINES_HPP
+#define ARIES_GEOMIMPLICITLINES_HPP
+
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Lines of points along the direction of strong coupling, for semi-coarsening and line-implicit smoothing.
+     *
+     * The coupling of an edge is the area of its dual face over its length,
+     * the coefficient of a diffusion operator on the edge. A point is
+     * stretched when its strongest coupling is at least a threshold times its
+     * weakest one, as in the boundary layer of a RANS mesh where the edges
+     * normal to the wall carry large faces over short distances. Lines start
+     * at the wall points and follow the strongest coupling of the last point
+     * (the second strongest when the first one goes back along the line) as
+     * long as the next point is stretched, free and couples back to the last
+     * point as one of its two strongest neighbors; the lines therefore
+     * stop where the mesh becomes isotropic. Isotropic meshes have no lines.
+     */
+    class GeomImplicitLines
+    {
+    public:
+        GeomImplicitLines();
+        ~GeomImplicitLines();
+
+        /*!
+         * \brief Build the lines.
+         * \param[in] val_numDim - Number of dimensions of the problem.
+         * \param[in] val_numPoint - Number of points.
+         * \param[in] val_numEdge - Number of edges.
+         * \param[in] val_edgeNode - Nodes of the edges, <i>[iEdge*2+iNode]</i>.
+         * \param[in] val_edgeNormal - Normals of the dual faces of the edges, <i>[iEdge*nDim+iDim]</i>.
+         * \param[in] val_coord - Coordinates, <i>[iPoint*nDim+iDim]</i>.
+         * \param[in] val_isStart - Points where the lines start (wall points).
+         * \param[in] val_isAllowed - Points that can be part of a line.
+         * \param[in] val_threshold - Ratio between the strongest and the weakest coupling of a stretched point.
+         */
+        void Build(unsigned short val_numDim, unsigned long val_numPoint, unsigned long val_numEdge, const unsigned long* val_edgeNode,
+                   const double* val_edgeNormal, const double* val_coord, const bool* val_isStart, const bool* val_isAllowed,
+                   double val_threshold);
+
+        unsigned long GetNumLine() const { return d_linePtr.size() - 1; };
+        unsigned long GetNumLinePoint(unsigned long val_iLine) const { return d_linePtr[val_iLine + 1] - d_linePtr[val_iLine]; };
+
+        /*!
+         * \brief Points of a line, from the wall outwards.
+         */
+        const unsigned long* GetLinePoint(unsigned long val_iLine) const { return &d_linePoint[d_linePtr[val_iLine]]; };
+
+        /*!
+         * \brief Line of a point, -1 if the point is in no line.
+         */
+        long GetLine(unsigned long val_iPoint) const { return d_pointLine[val_iPoint]; };
+
+        /*!
+         * \brief Number of points in the lines.
+         */
+        unsigned long GetNumPointInLine() const { return d_linePoint.size(); };
+
+    private:
+        vector<unsigned long> d_linePtr;    /*!< \brief CSR offsets of the points of the lines. */
+        vector<unsigned long> d_linePoint;  /*!< \brief Points of the lines. */
+        vector<long> d_pointLine;           /*!< \brief Line of every point. */
+    };
+}
+
+#endif
@@ -0,0 +1,191 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    k-d tree for nearest neighbor searches on point clouds
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomKDTree.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ARIES
+{
+    /*!
+     * \brief Orders point indices along one coordinate direction.
+     */
+    class GeomKDTreeLess
+    {
+    public:
+        GeomKDTreeLess(const double* val_coord, unsigned short val_numDim, unsigned short val_dim)
+            : d_coord(val_coord), d_numDim(val_numDim), d_dim(val_dim) {}
+        bool operator()(unsigned long val_a, unsigned long val_b) const
+        {
+            return d_coord[val_a*d_numDim + d_dim] < d_coord[val_b*d_numDim + d_dim];
+        }
+    private:
+        const double* d_coord;
+        unsigned short d_numDim, d_dim;
+    };
+
+    GeomKDTree::GeomKDTree(unsigned short val_numDim)
+    {
+        d_numDim = val_numDim;
+        d_numPoint = 0;
+        d_bucketSize = 8;
+    }
+
+    GeomKDTree::~GeomKDTree()
+    {
+    }
+
+    void GeomKDTree::Build(unsigned long val_numPoint, const double* val_coord)
+    {
+        unsigned long iPoint;
+
+        d_numPoint = val_numPoint;
+        d_coord.assign(val_coord, val_coord + val_numPoint*d_numDim);
+        d_index.resize(val_numPoint);
+        for (iPoint = 0; iPoint < val_numPoint; iPoint++) d_index[iPoint] = iPoint;
+
+        d_node.clear();
+        if (val_numPoint == 0) return;
+        d_node.reserve(2*(val_numPoint / d_bucketSize) + 1);
+        BuildNode(0, val_numPoint);
+    }
+
+    unsigned long GeomKDTree::BuildNode(unsigned long val_begin, unsigned long val_end)
+    {
+        unsigned long iNode = d_node.size(), iPoint;
+        unsigned short iDim;
+
+        KDNode kdNode;
+        kdNode.begin = val_begin;
+        kdNode.end = val_end;
+        kdNode.child[0] = kdNode.child[1] = 0;
+        kdNode.dim = 0;
+        kdNode.split = 0.0;
+        d_node.push_back(kdNode);
+
+        if (val_end - val_begin <= d_bucketSize) return iNode;
+
+        /*--- Split at the median of the widest direction ---*/
+        double minCoord[3], maxCoord[3];
+        for (iDim = 0; iDim < d_numDim; iDim++)
+        {
+            minCoord[iDim] = numeric_limits<double>::max();
+            maxCoord[iDim] = -numeric_limits<double>::max();
+        }
+        for (iPoint = val_begin; iPoint < val_end; iPoint++)
+        {
+            const double* coord = &d_coord[d_index[iPoint]*d_numDim];
+            for (iDim = 0; iDim < d_numDim; iDim++)
+            {
+                minCoord[iDim] = min(minCoord[iDim], coord[iDim]);
+                maxCoord[iDim] = max(maxCoord[iDim], coord[iDim]);
+            }
+        }
+        unsigned short splitDim = 0;
+        for (iDim = 1; iDim < d_numDim; iDim++)
+            if (maxCoord[iDim] - minCoord[iDim] > maxCoord[splitDim] - minCoord[splitDim]) splitDim = iDim;
+
+        unsigned long middle = val_begin + (val_end - val_begin) / 2;
+        nth_element(d_index.begin() + val_begin, d_index.begin() + middle, d_index.begin() + val_end,
+                    GeomKDTreeLess(&d_coord[0], d_numDim, splitDim));
+
+        d_node[iNode].dim = splitDim;
+        d_node[iNode].split = d_coord[d_index[middle]*d_numDim + splitDim];
+
+        unsigned long left = BuildNode(val_begin, middle);
+        unsigned long right = BuildNode(middle, val_end);
+        d_node[iNode].child[0] = left;
+        d_node[iNode].child[1] = right;
+
+        return iNode;
+    }
+
+    double GeomKDTree::Distance2(unsigned long val_iPoint, const double* val_coord) const
+    {
+        double dist2 = 0.0;
+        const double* coord = &d_coord[val_iPoint*d_numDim];
+        for (unsigned short iDim = 0; iDim < d_numDim; iDim++)
+            dist2 += (coord[iDim] - val_coord[iDim])*(coord[iDim] - val_coord[iDim]);
+        return dist2;
+    }
+
+    unsigned long GeomKDTree::FindNearest(const double* val_coord, double& val_dist, unsigned long val_skip) const
+    {
+        unsigned long best = GetNoPoint();
+        double bestDist2 = numeric_limits<double>::max();
+
+        if (d_numPoint > 0) SearchNearest(0, val_coord, val_skip, best, bestDist2);
+
+        val_dist = (best != GetNoPoint()) ? sqrt(bestDist2) : numeric_limits<double>::max();
+        return best;
+    }
+
+    void GeomKDTree::SearchNearest(unsigned long val_iNode, const double* val_coord, unsigned long val_skip,
+                                   unsigned long& val_best, double& val_bestDist2) const
+    {
+        const KDNode& kdNode = d_node[val_iNode];
+
+        if (kdNode.child[0] == 0)
+        {
+            for (unsigned long iPoint = kdNode.begin; iPoint < kdNode.end; iPoint++)
+            {
+                unsigned long jPoint = d_index[iPoint];
+                if (jPoint == val_skip) continue;
+                double dist2 = Distance2(jPoint, val_coord);
+                if (dist2 < val_bestDist2)
+                {
+                    val_bestDist2 = dist2;
+                    val_best = jPoint;
+                }
+            }
+            return;
+        }
+
+        /*--- Visit the side of the location first, the other only if the ball crosses the plane ---*/
+        double delta = val_coord[kdNode.dim] - kdNode.split;
+        unsigned short nearSide = (delta < 0.0) ? 0 : 1;
+        SearchNearest(kdNode.child[nearSide], val_coord, val_skip, val_best, val_bestDist2);
+        if (delta*delta < val_bestDist2)
+            SearchNearest(kdNode.child[1 - nearSide], val_coord, val_skip, val_best, val_bestDist2);
+    }
+
+    void GeomKDTree::FindRadius(const double* val_coord, double val_radius, vector<unsigned long>& val_point) const
+    {
+        val_point.clear();
+        if (d_numPoint > 0) SearchRadius(0, val_coord, val_radius*val_radius, val_point);
+    }
+
+    void GeomKDTree::SearchRadius(unsigned long val_iNode, const double* val_coord, double val_radius2,
+                                  vector<unsigned long>& val_point) const
+    {
+        const KDNode& kdNode = d_node[val_iNode];
+
+        if (kdNode.child[0] == 0)
+        {
+            for (unsigned long iPoint = kdNode.begin; iPoint < kdNode.end; iPoint++)
+                if (Distance2(d_index[iPoint], val_coord) <= val_radius2) val_point.push_back(d_index[iPoint]);
+            return;
+        }
+
+        double delta = val_coord[kdNode.dim] - kdNode.split;
+        if (delta < 0.0 || delta*delta <= val_radius2)
+            SearchRadius(kdNode.child[0], val_coord, val_radius2, val_point);
+        if (delta >= 0.0 || delta*delta <= val_radius2)
+            SearchRadius(kdNode.child[1], val_coord, val_radius2, val_point);
+    }
+}
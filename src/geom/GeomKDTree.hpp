@@ -0,0 +1,96 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    k-d tree for nearest neighbor searches on point clouds
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMKDTREE_HPP
+#define ARIES_GEOMKDTREE_HPP
+
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Static k-d tree over a set of points.
+     *
+     * The points are split at the median of their widest extent until a
+     * bucket holds a few points, so the tree is balanced regardless of the
+     * point distribution. A copy of the coordinates is kept, so the caller's
+     * arrays may go out of scope after Build. Queries are read-only and may be
+     * issued from several threads at once.
+     */
+    class GeomKDTree
+    {
+    public:
+        GeomKDTree(unsigned short val_numDim);
+        ~GeomKDTree();
+
+        /*!
+         * \brief Build the tree.
+         * \param[in] val_numPoint - Number of points.
+         * \param[in] val_coord - Coordinates, <i>val_coord[iPoint*nDim+iDim]</i>.
+         */
+        void Build(unsigned long val_numPoint, const double* val_coord);
+
+        /*!
+         * \brief Closest point to a given location.
+         * \param[in] val_coord - Location.
+         * \param[out] val_dist - Distance to the closest point.
+         * \param[in] val_skip - Point that must not be returned (e.g. the location itself).
+         * \return Index of the closest point, or <i>GetNoPoint()</i> if there is none.
+         */
+        unsigned long FindNearest(const double* val_coord, double& val_dist, unsigned long val_skip) const;
+        unsigned long FindNearest(const double* val_coord, double& val_dist) const { return FindNearest(val_coord, val_dist, GetNoPoint()); };
+
+        /*!
+         * \brief All the points closer than a given radius to a location.
+         * \param[in] val_coord - Location.
+         * \param[in] val_radius - Search radius.
+         * \param[out] val_point - Indices of the points found (unsorted).
+         */
+        void FindRadius(const double* val_coord, double val_radius, vector<unsigned long>& val_point) const;
+
+        unsigned long GetNumPoint() const { return d_numPoint; };
+        const double* GetCoord(unsigned long val_iPoint) const { return &d_coord[val_iPoint*d_numDim]; };
+        static unsigned long GetNoPoint() { return (unsigned long)(-1); };
+
+    private:
+        struct KDNode
+        {
+            unsigned long begin, end;           /*!< \brief Range of d_index held by the node. */
+            unsigned long child[2];             /*!< \brief Children (0 for a bucket). */
+            unsigned short dim;                 /*!< \brief Split direction. */
+            double split;                       /*!< \brief Split coordinate. */
+        };
+
+        unsigned long BuildNode(unsigned long val_begin, unsigned long val_end);
+        void SearchNearest(unsigned long val_iNode, const double* val_coord, unsigned long val_skip,
+                           unsigned long& val_best, double& val_bestDist2) const;
+        void SearchRadius(unsigned long val_iNode, const double* val_coord, double val_radius2,
+                          vector<unsigned long>& val_point) const;
+        double Distance2(unsigned long val_iPoint, const double* val_coord) const;
+
+        unsigned short d_numDim;                /*!< \brief Number of dimensions of the problem. */
+        unsigned long d_numPoint;               /*!< \brief Number of points in the tree. */
+        unsigned long d_bucketSize;             /*!< \brief Maximum number of points of a leaf. */
+        vector<double> d_coord;                 /*!< \brief Coordinates of the points. */
+        vector<unsigned long> d_index;          /*!< \brief Points ordered by leaf. */
+        vector<KDNode> d_node;                  /*!< \brief Tree nodes, the root is the first one. */
+    };
+}
+
+#endif
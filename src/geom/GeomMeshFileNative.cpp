@@ -0,0 +1,563 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Binary ARIES mesh file, read in parallel by byte ranges
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomMeshFileNative.hpp"
+#include "GeomMeshFileSU2.hpp"
+#include "MeshData.hpp"
+#include "const_def.h"
+
+#ifdef ARIES_HAVE_CGNS
+#include "cgnslib.h"
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace ARIES
+{
+    /*!
+     * \brief Header of a mesh file, as stored on disk.
+     */
+    struct GeomMeshHeader
+    {
+        char magic[8];
+        unsigned int version;
+        unsigned int numSection;
+        unsigned int numDim;
+        unsigned int numMarker;
+        unsigned int sizeLong;
+        unsigned int byteOrder;
+        unsigned long long numPoint;
+        unsigned long long numPointDomain;
+        unsigned long long fileSize;
+    };
+
+    static const char GeomMeshMagic[8] = { 'A', 'R', 'I', 'E', 'S', 'M', 'S', 'H' };
+    static const unsigned int GeomMeshByteOrder = 0x01020304;
+    static const unsigned long long GeomMeshBlock = 1 << 20;
+
+    /*--- VTK type of the element sections, Section_Tria to Section_Pyra ---*/
+    static const unsigned short GeomMeshVtkType[] = { 0, TRIANGLE, RECTANGLE, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID };
+
+    /*!
+     * \brief Register the arrays of a converted mesh and write them.
+     */
+    static bool GeomMeshWrite(const string& val_fileName, unsigned short val_numDim, unsigned long val_numPointDomain, const vector<double>& val_coord,
+                              const vector<unsigned long>* val_elemNode, const vector<string>& val_tag, const vector<unsigned long>& val_markerPtr,
+                              const vector<unsigned short>& val_boundType, const vector<unsigned long>& val_boundNodePtr,
+                              const vector<unsigned long>& val_boundNode, unsigned int val_tagSize, unsigned long val_elemBlock)
+    {
+        unsigned short iSection, iMarker, numMarker = val_tag.size();
+        unsigned long numPoint = val_coord.size() / val_numDim;
+
+        /*--- Tags padded with zeros to a fixed size ---*/
+        vector<char> tag(numMarker*val_tagSize, '\0');
+        for (iMarker = 0; iMarker < numMarker; iMarker++)
+        {
+            if (val_tag[iMarker].size() >= val_tagSize) return false;
+            memcpy(&tag[iMarker*val_tagSize], val_tag[iMarker].c_str(), val_tag[iMarker].size());
+        }
+
+        /*--- Node range of every block of elements, so that a rank only reads the blocks reaching its points ---*/
+        vector<unsigned long> elemRange;
+        for (iSection = GeomMeshFileNative::Section_Tria; iSection <= GeomMeshFileNative::Section_Pyra; iSection++)
+        {
+            unsigned long blockSize = val_elemBlock*GeomMeshFileSU2::GetNumElemNode(GeomMeshVtkType[iSection]);
+            for (unsigned long first = 0; first < val_elemNode[iSection].size(); first += blockSize)
+            {
+                vector<unsigned long>::const_iterator begin = val_elemNode[iSection].begin() + first;
+                vector<unsigned long>::const_iterator end = val_elemNode[iSection].begin() + min(first + blockSize, (unsigned long)val_elemNode[iSection].size());
+                elemRange.push_back(*min_element(begin, end));
+                elemRange.push_back(*max_element(begin, end));
+            }
+        }
+
+        GeomMeshFileNative file;
+        file.SetHeader(val_numDim, numPoint, val_numPointDomain, numMarker);
+        file.SetSection(GeomMeshFileNative::Section_Coord, val_coord.empty() ? NULL : &val_coord[0], val_coord.size(), sizeof(double));
+        for (iSection = GeomMeshFileNative::Section_Tria; iSection <= GeomMeshFileNative::Section_Pyra; iSection++)
+            if (!val_elemNode[iSection].empty())
+                file.SetSection(GeomMeshFileNative::SectionType(iSection), &val_elemNode[iSection][0], val_elemNode[iSection].size(), sizeof(unsigned long));
+        if (!elemRange.empty())
+            file.SetSection(GeomMeshFileNative::Section_ElemRange, &elemRange[0], elemRange.size(), sizeof(unsigned long));
+        if (numMarker > 0)
+        {
+            file.SetSection(GeomMeshFileNative::Section_MarkerTag, &tag[0], tag.size(), sizeof(char));
+            file.SetSection(GeomMeshFileNative::Section_MarkerPtr, &val_markerPtr[0], val_markerPtr.size(), sizeof(unsigned long));
+            if (!val_boundType.empty())
+            {
+                file.SetSection(GeomMeshFileNative::Section_BoundType, &val_boundType[0], val_boundType.size(), sizeof(unsigned short));
+                file.SetSection(GeomMeshFileNative::Section_BoundNode, &val_boundNode[0], val_boundNode.size(), sizeof(unsigned long));
+            }
+            file.SetSection(GeomMeshFileNative::Section_BoundNodePtr, &val_boundNodePtr[0], val_boundNodePtr.size(), sizeof(unsigned long));
+        }
+        return file.Write(val_fileName);
+    }
+
+    GeomMeshFileNative::GeomMeshFileNative() : d_file(Section_Num)
+    {
+        d_numDim = 0;
+        d_numPoint = 0;
+        d_numPointDomain = 0;
+        d_numMarker = 0;
+        d_fd = -1;
+        d_isCollective = false;
+    }
+
+    GeomMeshFileNative::~GeomMeshFileNative()
+    {
+        CloseFile();
+    }
+
+    void GeomMeshFileNative::SetHeader(unsigned short val_numDim, unsigned long val_numPoint, unsigned long val_numPointDomain, unsigned short val_numMarker)
+    {
+        d_numDim = val_numDim;
+        d_numPoint = val_numPoint;
+        d_numPointDomain = val_numPointDomain;
+        d_numMarker = val_numMarker;
+    }
+
+    void GeomMeshFileNative::SetSection(SectionType val_type, const void* val_data, unsigned long val_count, unsigned short val_size)
+    {
+        d_file.SetSection(val_type, val_data, val_count, val_size);
+    }
+
+    bool GeomMeshFileNative::Write(const string& val_fileName) const
+    {
+        GeomMeshHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, GeomMeshMagic, sizeof(header.magic));
+        header.version = d_version;
+        header.numSection = d_file.GetNumSection();
+        header.numDim = d_numDim;
+        header.numMarker = d_numMarker;
+        header.sizeLong = sizeof(unsigned long);
+        header.byteOrder = GeomMeshByteOrder;
+        header.numPoint = d_numPoint;
+        header.numPointDomain = d_numPointDomain;
+        header.fileSize = d_file.GetFileSize(sizeof(header));
+
+        return d_file.Write(val_fileName, &header, sizeof(header));
+    }
+
+    bool GeomMeshFileNative::Read(const string& val_fileName, MeshData* val_meshData)
+    {
+        if (!OpenFile(val_fileName)) return false;
+        bool isRead = ReadPartition(val_meshData);
+        CloseFile();
+        return isRead;
+    }
+
+    bool GeomMeshFileNative::OpenFile(const string& val_fileName)
+    {
+        CloseFile();
+
+#ifdef ARIES_HAVE_MPI
+        /*--- Collective reads let the MPI library aggregate the ranges of the ranks on a parallel file system ---*/
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        if (AriesMPI::UsingMPI() && mpi.GetSize() > 1)
+        {
+            if (MPI_File_open(mpi.GetCommunicator(), (char*)val_fileName.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &d_mpiFile) != MPI_SUCCESS)
+                return false;
+            d_isCollective = true;
+            return true;
+        }
+#endif
+        d_fd = open(val_fileName.c_str(), O_RDONLY);
+        return d_fd >= 0;
+    }
+
+    void GeomMeshFileNative::CloseFile()
+    {
+#ifdef ARIES_HAVE_MPI
+        if (d_isCollective) MPI_File_close(&d_mpiFile);
+#endif
+        if (d_fd >= 0) close(d_fd);
+        d_fd = -1;
+        d_isCollective = false;
+    }
+
+    bool GeomMeshFileNative::ReadRange(unsigned long long val_offset, unsigned long long val_size, void* val_data, bool val_isCollective)
+    {
+        char* data = (char*)val_data;
+
+#ifdef ARIES_HAVE_MPI
+        if (d_isCollective)
+        {
+            /*--- Blocks of 1 MiB, then the rest, so the counts fit in an int ---*/
+            MPI_Datatype block;
+            MPI_Status status;
+            MPI_Type_contiguous(GeomMeshBlock, MPI_BYTE, &block);
+            MPI_Type_commit(&block);
+            int numBlock = int(val_size / GeomMeshBlock), numRest = int(val_size % GeomMeshBlock);
+            bool isRead;
+            if (val_isCollective)
+            {
+                isRead = MPI_File_read_at_all(d_mpiFile, val_offset, data, numBlock, block, &status) == MPI_SUCCESS;
+                isRead = MPI_File_read_at_all(d_mpiFile, val_offset + numBlock*GeomMeshBlock, data + numBlock*GeomMeshBlock, numRest, MPI_BYTE,
+                                              &status) == MPI_SUCCESS && isRead;
+            }
+            else
+            {
+                isRead = MPI_File_read_at(d_mpiFile, val_offset, data, numBlock, block, &status) == MPI_SUCCESS;
+                isRead = MPI_File_read_at(d_mpiFile, val_offset + numBlock*GeomMeshBlock, data + numBlock*GeomMeshBlock, numRest, MPI_BYTE,
+                                          &status) == MPI_SUCCESS && isRead;
+            }
+            MPI_Type_free(&block);
+            return isRead;
+        }
+#else
+        (void)val_isCollective;
+#endif
+
+        /*--- pread may return less than asked ---*/
+        while (val_size > 0)
+        {
+            ssize_t numRead = pread(d_fd, data, val_size, val_offset);
+            if (numRead <= 0) return false;
+            data += numRead;
+            val_offset += numRead;
+            val_size -= numRead;
+        }
+        return true;
+    }
+
+    bool GeomMeshFileNative::ReadPartition(MeshData* val_meshData)
+    {
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        int rank = (mpi.GetSize() > 1) ? mpi.GetRank() : 0, size = max(mpi.GetSize(), 1);
+        unsigned short iSection, iMarker;
+        unsigned long iPoint, iElem;
+
+        /*--- Header and table, checked against the layout of this machine ---*/
+        GeomMeshHeader header;
+        if (!ReadRange(0, sizeof(header), &header)) return false;
+        bool isValid = (memcmp(header.magic, GeomMeshMagic, sizeof(header.magic)) == 0);
+        isValid = isValid && header.version == d_version && header.byteOrder == GeomMeshByteOrder && header.sizeLong == sizeof(unsigned long);
+        isValid = isValid && header.numSection <= Section_Num && (header.numDim == 2 || header.numDim == 3);
+        if (!isValid) return false;
+
+        vector<GeomSectionEntry> table(header.numSection);
+        if (!table.empty() && !ReadRange(sizeof(header), table.size()*sizeof(GeomSectionEntry), &table[0])) return false;
+
+        GeomSectionEntry section[Section_Num];
+        memset(section, 0, sizeof(section));
+        for (unsigned long iEntry = 0; iEntry < table.size(); iEntry++)
+        {
+            if (table[iEntry].type >= Section_Num || table[iEntry].offset + table[iEntry].count*table[iEntry].size > header.fileSize) return false;
+            section[table[iEntry].type] = table[iEntry];
+        }
+        if (section[Section_Coord].size != sizeof(double) || section[Section_Coord].count != header.numPoint*header.numDim) return false;
+
+        d_numDim = header.numDim;
+        d_numPoint = header.numPoint;
+        d_numPointDomain = header.numPointDomain;
+        d_numMarker = header.numMarker;
+
+        vector<double>& coord = val_meshData->GetCoord();
+        vector<unsigned long>& pointGlobal = val_meshData->GetPointGlobal();
+        vector<unsigned short>& elemType = val_meshData->GetElemType();
+        vector<unsigned long>& elemNodePtr = val_meshData->GetElemNodePtr();
+        vector<unsigned long>& elemNode = val_meshData->GetElemNode();
+        vector<unsigned long>& boundPtr = val_meshData->GetBoundPtr();
+        vector<unsigned short>& boundType = val_meshData->GetBoundType();
+        vector<unsigned long>& boundNodePtr = val_meshData->GetBoundNodePtr();
+        vector<unsigned long>& boundNode = val_meshData->GetBoundNode();
+
+        /*--- Points: one range of the coordinates ---*/
+        unsigned long pointBegin = GeomMeshFileSU2::GetLinearBegin(d_numPoint, rank, size), pointEnd = GeomMeshFileSU2::GetLinearBegin(d_numPoint, rank + 1, size);
+        coord.resize((pointEnd - pointBegin)*d_numDim);
+        pointGlobal.resize(pointEnd - pointBegin);
+        if (!ReadRange(section[Section_Coord].offset + pointBegin*d_numDim*sizeof(double), coord.size()*sizeof(double),
+                       coord.empty() ? NULL : &coord[0])) return false;
+        for (iPoint = pointBegin; iPoint < pointEnd; iPoint++) pointGlobal[iPoint - pointBegin] = iPoint;
+
+        /*--- Elements with a node in the partition: the blocks whose node range reaches it, filtered ---*/
+        unsigned long numElem = 0, numBlock = 0;
+        for (iSection = Section_Tria; iSection <= Section_Pyra; iSection++)
+        {
+            if (section[iSection].count > 0 && section[iSection].size != sizeof(unsigned long)) return false;
+            unsigned long numTypeElem = section[iSection].count / GeomMeshFileSU2::GetNumElemNode(GeomMeshVtkType[iSection]);
+            numElem += numTypeElem;
+            numBlock += (numTypeElem + d_elemBlock - 1) / d_elemBlock;
+        }
+        if (section[Section_ElemRange].count != 2*numBlock || (numBlock > 0 && section[Section_ElemRange].size != sizeof(unsigned long))) return false;
+        vector<unsigned long> elemRange(2*numBlock + 1);
+        if (!ReadRange(section[Section_ElemRange].offset, 2*numBlock*sizeof(unsigned long), &elemRange[0])) return false;
+
+        elemType.clear();
+        elemNodePtr.assign(1, 0);
+        elemNode.clear();
+        vector<unsigned long> block(d_elemBlock*N_POINTS_HEXAHEDRON);
+        unsigned long iBlock = 0;
+        for (iSection = Section_Tria; iSection <= Section_Pyra; iSection++)
+        {
+            unsigned short iNode, numNode = GeomMeshFileSU2::GetNumElemNode(GeomMeshVtkType[iSection]);
+            unsigned long numTypeElem = section[iSection].count / numNode;
+            for (unsigned long first = 0; first < numTypeElem; first += d_elemBlock, iBlock++)
+            {
+                if (elemRange[2*iBlock + 1] < pointBegin || elemRange[2*iBlock] >= pointEnd) continue;
+
+                /*--- The blocks read differ between the ranks, so the reads are independent ---*/
+                unsigned long last = min(first + d_elemBlock, numTypeElem);
+                if (!ReadRange(section[iSection].offset + first*numNode*sizeof(unsigned long), (last - first)*numNode*sizeof(unsigned long), &block[0], false))
+                    return false;
+                for (iElem = 0; iElem < last - first; iElem++)
+                {
+                    const unsigned long* node = &block[iElem*numNode];
+                    bool isOwned = false;
+                    for (iNode = 0; iNode < numNode && !isOwned; iNode++) isOwned = (node[iNode] >= pointBegin && node[iNode] < pointEnd);
+                    if (!isOwned) continue;
+                    elemType.push_back(GeomMeshVtkType[iSection]);
+                    elemNode.insert(elemNode.end(), node, node + numNode);
+                    elemNodePtr.push_back(elemNode.size());
+                }
+            }
+        }
+
+        /*--- Markers: the tags and offsets, then the boundary elements of every marker with a node in the partition ---*/
+        vector<char> tag(d_numMarker*d_tagSize + 1, '\0');
+        vector<unsigned long> markerPtr(d_numMarker + 1, 0);
+        if (d_numMarker > 0)
+        {
+            if (section[Section_MarkerTag].count != d_numMarker*d_tagSize || section[Section_MarkerPtr].count != d_numMarker + 1u) return false;
+            if (!ReadRange(section[Section_MarkerTag].offset, d_numMarker*d_tagSize, &tag[0])) return false;
+            if (!ReadRange(section[Section_MarkerPtr].offset, markerPtr.size()*sizeof(unsigned long), &markerPtr[0])) return false;
+            if (section[Section_BoundNodePtr].count != markerPtr[d_numMarker] + 1) return false;
+            if (section[Section_BoundType].count != markerPtr[d_numMarker] || section[Section_BoundNodePtr].size != sizeof(unsigned long)) return false;
+        }
+
+        unsigned long numBound = markerPtr[d_numMarker];
+        vector<unsigned short> type(numBound + 1);
+        vector<unsigned long> nodePtr(numBound + 1, 0);
+        if (d_numMarker > 0)
+        {
+            if (!ReadRange(section[Section_BoundType].offset, numBound*sizeof(unsigned short), &type[0])) return false;
+            if (!ReadRange(section[Section_BoundNodePtr].offset, nodePtr.size()*sizeof(unsigned long), &nodePtr[0])) return false;
+        }
+        vector<unsigned long> node(nodePtr[numBound] + 1);
+        if (section[Section_BoundNode].count != nodePtr[numBound]) return false;
+        if (d_numMarker > 0 && !ReadRange(section[Section_BoundNode].offset, nodePtr[numBound]*sizeof(unsigned long), &node[0])) return false;
+
+        boundPtr.assign(1, 0);
+        boundType.clear();
+        boundNodePtr.assign(1, 0);
+        boundNode.clear();
+        for (iMarker = 0; iMarker < d_numMarker; iMarker++)
+        {
+            for (iElem = markerPtr[iMarker]; iElem < markerPtr[iMarker + 1]; iElem++)
+            {
+                bool isOwned = false;
+                for (unsigned long iNode = nodePtr[iElem]; iNode < nodePtr[iElem + 1] && !isOwned; iNode++)
+                    isOwned = (node[iNode] >= pointBegin && node[iNode] < pointEnd);
+                if (!isOwned) continue;
+                boundType.push_back(type[iElem]);
+                boundNode.insert(boundNode.end(), node.begin() + nodePtr[iElem], node.begin() + nodePtr[iElem + 1]);
+                boundNodePtr.push_back(boundNode.size());
+            }
+            boundPtr.push_back(boundType.size());
+        }
+
+        /*--- Counts of the mesh ---*/
+        unsigned long numPointDomain = 0;
+        for (iPoint = pointBegin; iPoint < pointEnd; iPoint++)
+            if (iPoint < d_numPointDomain) numPointDomain++;
+
+        val_meshData->SetFlatCount();
+        val_meshData->SetNumDim(d_numDim);
+        val_meshData->SetNumPointDomain(numPointDomain);
+        val_meshData->SetNumPointGlobal(d_numPoint);
+        val_meshData->SetNumPointDomainGlobal(d_numPointDomain);
+        val_meshData->SetNumElemGlobal(numElem);
+        for (iMarker = 0; iMarker < d_numMarker; iMarker++)
+            val_meshData->SetMarkerTag(iMarker, string(&tag[iMarker*d_tagSize]));
+
+        return true;
+    }
+
+    bool GeomMeshFileNative::ConvertSU2(const string& val_su2Name, const string& val_fileName)
+    {
+        GeomMeshFileSU2 su2File;
+        if (!su2File.Open(val_su2Name) || !su2File.BuildIndex()) return false;
+
+        const char* end = su2File.GetEnd();
+        unsigned short iDim, numDim = su2File.GetNumDim();
+        unsigned long iPoint, iElem, vtkType, node;
+
+        /*--- Coordinates ---*/
+        vector<double> coord(su2File.GetNumPoint()*numDim);
+        const char* row = (su2File.GetNumPoint() > 0) ? su2File.GetPointRow(0) : NULL;
+        for (iPoint = 0; iPoint < su2File.GetNumPoint(); iPoint++)
+        {
+            const char* cursor = row;
+            for (iDim = 0; iDim < numDim; iDim++) cursor = GeomMeshFileSU2::ParseDouble(cursor, end, coord[iPoint*numDim + iDim]);
+            if (cursor == NULL) return false;
+            row = su2File.NextRow(cursor);
+        }
+
+        /*--- Connectivity, split by type ---*/
+        vector<unsigned long> elemNode[Section_Num];
+        row = (su2File.GetNumElem() > 0) ? su2File.GetElemRow(0) : NULL;
+        for (iElem = 0; iElem < su2File.GetNumElem(); iElem++)
+        {
+            const char* cursor = GeomMeshFileSU2::ParseUnsigned(row, end, vtkType);
+            SectionType type = GetElemSection(vtkType);
+            if (cursor == NULL || type == Section_Num) return false;
+            for (unsigned short iNode = 0; iNode < GeomMeshFileSU2::GetNumElemNode(vtkType); iNode++)
+            {
+                cursor = GeomMeshFileSU2::ParseUnsigned(cursor, end, node);
+                if (cursor == NULL) return false;
+                elemNode[type].push_back(node);
+            }
+            row = su2File.NextRow(cursor);
+        }
+
+        /*--- Markers ---*/
+        vector<string> tag;
+        vector<unsigned long> markerPtr, boundNodePtr, boundNode;
+        vector<unsigned short> boundType;
+        if (!su2File.ReadMarkers(tag, markerPtr, boundType, boundNodePtr, boundNode)) return false;
+
+        return GeomMeshWrite(val_fileName, numDim, su2File.GetNumPointDomain(), coord, elemNode, tag, markerPtr, boundType, boundNodePtr, boundNode,
+                             d_tagSize, d_elemBlock);
+    }
+
+    bool GeomMeshFileNative::ConvertCGNS(const string& val_cgnsName, const string& val_fileName)
+    {
+#ifdef ARIES_HAVE_CGNS
+        int fn, cellDim, physDim, numCgnsSection, iCgnsSection, numBoundary, parentFlag, numNode;
+        cgsize_t zoneSize[3], rangeMin = 1, rangeMax, start, last;
+        ZoneType_t zoneType;
+        ElementType_t cgnsType;
+        char name[CGIO_MAX_NAME_LENGTH + 1];
+        const char* coordName[3] = { "CoordinateX", "CoordinateY", "CoordinateZ" };
+
+        if (cg_open(val_cgnsName.c_str(), CG_MODE_READ, &fn) != CG_OK) return false;
+
+        bool isRead = cg_base_read(fn, 1, name, &cellDim, &physDim) == CG_OK && (cellDim == 2 || cellDim == 3);
+        isRead = isRead && cg_zone_type(fn, 1, 1, &zoneType) == CG_OK && zoneType == Unstructured;
+        isRead = isRead && cg_zone_read(fn, 1, 1, name, zoneSize) == CG_OK;
+        if (!isRead)
+        {
+            cg_close(fn);
+            return false;
+        }
+
+        /*--- Coordinates, interleaved ---*/
+        unsigned short iDim, numDim = cellDim;
+        unsigned long iPoint, iNode, numPoint = zoneSize[0];
+        vector<double> coord(numPoint*numDim), component(numPoint);
+        rangeMax = numPoint;
+        for (iDim = 0; iDim < numDim && isRead; iDim++)
+        {
+            isRead = cg_coord_read(fn, 1, 1, coordName[iDim], RealDouble, &rangeMin, &rangeMax, &component[0]) == CG_OK;
+            for (iPoint = 0; iPoint < numPoint && isRead; iPoint++) coord[iPoint*numDim + iDim] = component[iPoint];
+        }
+
+        /*--- Sections of the dimension of the cells are interior elements, the others of one dimension less are markers ---*/
+        vector<unsigned long> elemNode[Section_Num], markerPtr(1, 0), boundNodePtr(1, 0), boundNode;
+        vector<unsigned short> boundType;
+        vector<string> tag;
+        isRead = isRead && cg_nsections(fn, 1, 1, &numCgnsSection) == CG_OK;
+        for (iCgnsSection = 1; iCgnsSection <= numCgnsSection && isRead; iCgnsSection++)
+        {
+            isRead = cg_section_read(fn, 1, 1, iCgnsSection, name, &cgnsType, &start, &last, &numBoundary, &parentFlag) == CG_OK;
+            isRead = isRead && cg_npe(cgnsType, &numNode) == CG_OK;
+            if (!isRead) break;
+
+            unsigned short vtkType, elemDim;
+            switch (cgnsType)
+            {
+                case BAR_2:   vtkType = LINE;        elemDim = 1; break;
+                case TRI_3:   vtkType = TRIANGLE;    elemDim = 2; break;
+                case QUAD_4:  vtkType = RECTANGLE;   elemDim = 2; break;
+                case TETRA_4: vtkType = TETRAHEDRON; elemDim = 3; break;
+                case HEXA_8:  vtkType = HEXAHEDRON;  elemDim = 3; break;
+                case PENTA_6: vtkType = PRISM;       elemDim = 3; break;
+                case PYRA_5:  vtkType = PYRAMID;     elemDim = 3; break;
+                default:      vtkType = 0;           elemDim = 0; break;
+            }
+            if (vtkType == 0)
+            {
+                std::cout << "CGNS section " << name << ": mixed and high-order sections cannot be converted!!" << std::endl;
+                isRead = false;
+                break;
+            }
+            if (elemDim + 1 < cellDim) continue;
+
+            unsigned long iElem, numElem = last - start + 1;
+            vector<cgsize_t> connectivity(numElem*numNode);
+            isRead = cg_elements_read(fn, 1, 1, iCgnsSection, &connectivity[0], NULL) == CG_OK;
+
+            /*--- CGNS numbers the nodes from 1 ---*/
+            if (elemDim == cellDim)
+            {
+                SectionType type = GetElemSection(vtkType);
+                for (iNode = 0; iNode < connectivity.size(); iNode++) elemNode[type].push_back(connectivity[iNode] - 1);
+            }
+            else
+            {
+                tag.push_back(name);
+                for (iElem = 0; iElem < numElem; iElem++)
+                {
+                    for (iNode = 0; iNode < (unsigned long)numNode; iNode++) boundNode.push_back(connectivity[iElem*numNode + iNode] - 1);
+                    boundType.push_back(vtkType);
+                    boundNodePtr.push_back(boundNode.size());
+                }
+                markerPtr.push_back(boundType.size());
+            }
+        }
+        cg_close(fn);
+        if (!isRead) return false;
+
+        return GeomMeshWrite(val_fileName, numDim, numPoint, coord, elemNode, tag, markerPtr, boundType, boundNodePtr, boundNode, d_tagSize, d_elemBlock);
+#else
+        (void)val_cgnsName;
+        (void)val_fileName;
+        std::cout << "ARIES built without CGNS support!!" << std::endl;
+        return false;
+#endif
+    }
+
+    GeomMeshFileNative::SectionType GeomMeshFileNative::GetElemSection(unsigned short val_vtkType)
+    {
+        switch (val_vtkType)
+        {
+            case TRIANGLE:    return Section_Tria;
+            case RECTANGLE:   return Section_Quad;
+            case TETRAHEDRON: return Section_Tetr;
+            case HEXAHEDRON:  return Section_Hexa;
+            case PRISM:       return Section_Pris;
+            case PYRAMID:     return Section_Pyra;
+            default:          return Section_Num;
+        }
+    }
+
+    bool GeomMeshFileNative::IsNativeFile(const string& val_fileName)
+    {
+        char magic[sizeof(GeomMeshMagic)];
+        ifstream file(val_fileName.c_str(), ios::in | ios::binary);
+        file.read(magic, sizeof(magic));
+        return file && memcmp(magic, GeomMeshMagic, sizeof(magic)) == 0;
+    }
+}
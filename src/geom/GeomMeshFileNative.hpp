@@ -0,0 +1,153 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Binary ARIES mesh file, read in parallel by byte ranges
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMMESHFILENATIVE_HPP
+#define ARIES_GEOMMESHFILENATIVE_HPP
+
+#include "AriesMPI.hpp"
+#include "GeomSectionFile.hpp"
+
+#include <cstddef>
+#include <string>
+
+using namespace std;
+
+namespace ARIES
+{
+    class MeshData;
+
+    /*!
+     * \brief Binary mesh file of ARIES: header, table of sections and typed contiguous sections.
+     *
+     * The layout is the one of GeomSectionFile, shared with GeomGeometryCache:
+     * a header (dimensions, numbers of points, elements and markers, size of
+     * an unsigned long), a table with the type, value size, length and offset
+     * of every section, then the sections aligned on 64 bytes. The
+     * coordinates are one section, the connectivity one section per element
+     * type, with the smallest and largest node of every block of d_elemBlock
+     * elements in one more section, and the markers five sections (tags,
+     * boundary elements of every marker, their types, and the CSR of their
+     * nodes). Since every offset is known from the table, a rank reads the
+     * byte range of its linear partition of the points, then keeps every
+     * element and boundary element with a node among them, as MeshReaderSU2
+     * and GeomMeshPipeline do: only the element blocks whose node range
+     * reaches the partition are read, and all the (smaller) boundary sections.
+     * Values go straight into MeshData with pread, or with MPI-IO reads when
+     * MPI is running; no value is parsed. The files are written by ConvertSU2
+     * and ConvertCGNS, once per mesh.
+     */
+    class GeomMeshFileNative
+    {
+    public:
+        typedef enum
+        {
+            Section_Coord = 0,          /*!< \brief Coordinates of the points, <i>[iPoint*nDim+iDim]</i>. */
+            Section_Tria = 1,           /*!< \brief Nodes of the triangles. */
+            Section_Quad = 2,           /*!< \brief Nodes of the quadrilaterals. */
+            Section_Tetr = 3,           /*!< \brief Nodes of the tetrahedra. */
+            Section_Hexa = 4,           /*!< \brief Nodes of the hexahedra. */
+            Section_Pris = 5,           /*!< \brief Nodes of the prisms. */
+            Section_Pyra = 6,           /*!< \brief Nodes of the pyramids. */
+            Section_MarkerTag = 7,      /*!< \brief Tags of the markers, d_tagSize characters each. */
+            Section_MarkerPtr = 8,      /*!< \brief CSR offsets of the boundary elements of the markers. */
+            Section_BoundType = 9,      /*!< \brief VTK type of the boundary elements. */
+            Section_BoundNodePtr = 10,  /*!< \brief CSR offsets of the nodes of the boundary elements. */
+            Section_BoundNode = 11,     /*!< \brief Nodes of the boundary elements. */
+            Section_ElemRange = 12,     /*!< \brief Smallest and largest node of every block of d_elemBlock elements, type after type. */
+            Section_Num = 13            /*!< \brief Number of section types. */
+        } SectionType;
+
+        GeomMeshFileNative();
+        ~GeomMeshFileNative();
+
+        /*!
+         * \brief Set the header written to the file.
+         * \param[in] val_numDim - Number of dimensions of the problem.
+         * \param[in] val_numPoint - Number of points.
+         * \param[in] val_numPointDomain - Number of points of the domain.
+         * \param[in] val_numMarker - Number of markers.
+         */
+        void SetHeader(unsigned short val_numDim, unsigned long val_numPoint, unsigned long val_numPointDomain, unsigned short val_numMarker);
+
+        /*!
+         * \brief Register a section to write; the array is only read by Write.
+         */
+        void SetSection(SectionType val_type, const void* val_data, unsigned long val_count, unsigned short val_size);
+
+        /*!
+         * \brief Write the header and the registered sections.
+         * \return <i>true</i> if the file was written completely.
+         */
+        bool Write(const string& val_fileName) const;
+
+        /*!
+         * \brief Read the linear partition of this rank into the flat arrays of a mesh.
+         * \return <i>false</i> if the file cannot be read or is not a mesh file of this machine.
+         */
+        bool Read(const string& val_fileName, MeshData* val_meshData);
+
+        /*!
+         * \brief Convert an ASCII SU2 mesh (first zone).
+         */
+        static bool ConvertSU2(const string& val_su2Name, const string& val_fileName);
+
+        /*!
+         * \brief Convert a CGNS mesh (first base and zone, unstructured); the boundary sections become the markers.
+         */
+        static bool ConvertCGNS(const string& val_cgnsName, const string& val_fileName);
+
+        /*!
+         * \brief Section of the interior elements of a VTK type, Section_Num for another type.
+         */
+        static SectionType GetElemSection(unsigned short val_vtkType);
+
+        /*!
+         * \brief Whether a file starts with the magic number of this format.
+         */
+        static bool IsNativeFile(const string& val_fileName);
+
+    private:
+        bool OpenFile(const string& val_fileName);
+        void CloseFile();
+        bool ReadPartition(MeshData* val_meshData);
+
+        /*!
+         * \brief Read <i>val_size</i> bytes at <i>val_offset</i>.
+         * \param[in] val_isCollective - Whether every rank makes the same calls (collective with MPI-IO), otherwise the read is independent.
+         */
+        bool ReadRange(unsigned long long val_offset, unsigned long long val_size, void* val_data, bool val_isCollective = true);
+
+        static const unsigned int d_version = 2;        /*!< \brief Format version, increased on every change of the layout. */
+        static const unsigned int d_tagSize = 64;       /*!< \brief Characters stored for a marker tag. */
+        static const unsigned long d_elemBlock = 16384; /*!< \brief Elements of a block of Section_ElemRange. */
+
+        unsigned short d_numDim;                    /*!< \brief Number of dimensions of the problem. */
+        unsigned long d_numPoint;                   /*!< \brief Number of points. */
+        unsigned long d_numPointDomain;             /*!< \brief Number of points of the domain. */
+        unsigned short d_numMarker;                 /*!< \brief Number of markers. */
+
+        GeomSectionFile d_file;                     /*!< \brief Sections to write. */
+
+        int d_fd;                                   /*!< \brief Descriptor of the file for pread. */
+#ifdef ARIES_HAVE_MPI
+        MPI_File d_mpiFile;                         /*!< \brief File for the collective reads. */
+#endif
+        bool d_isCollective;                        /*!< \brief Whether the reads go through MPI-IO. */
+    };
+}
+
+#endif
@@ -0,0 +1,433 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Memory-mapped SU2 mesh file with an offset index of its rows
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomMeshFileSU2.hpp"
+#include "const_def.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ARIES
+{
+    /*!
+     * \brief Powers of ten that are exact in double precision.
+     */
+    static const double GeomMeshFilePow10[] =
+    {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    static inline bool GeomMeshFileIsBlank(char val_char)
+    {
+        return val_char == ' ' || val_char == '\t' || val_char == '\r';
+    }
+
+    static inline bool GeomMeshFileIsDigit(char val_char)
+    {
+        return val_char >= '0' && val_char <= '9';
+    }
+
+    /*!
+     * \brief Whether a line starts with a keyword; <i>val_value</i> is set to the character after it.
+     */
+    static bool GeomMeshFileKeyword(const char* val_line, const char* val_end, const char* val_keyword, const char*& val_value)
+    {
+        size_t length = strlen(val_keyword);
+        while (val_line < val_end && GeomMeshFileIsBlank(*val_line)) val_line++;
+        if ((size_t)(val_end - val_line) < length || strncmp(val_line, val_keyword, length) != 0) return false;
+        val_value = val_line + length;
+        return true;
+    }
+
+    GeomMeshFileSU2::GeomMeshFileSU2()
+    {
+        d_data = NULL;
+        d_size = 0;
+        d_isMapped = false;
+        d_numDim = 0;
+        d_numPoint = 0;
+        d_numPointDomain = 0;
+        d_numElem = 0;
+        d_markerOffset = 0;
+    }
+
+    GeomMeshFileSU2::~GeomMeshFileSU2()
+    {
+        Close();
+    }
+
+    bool GeomMeshFileSU2::Open(const string& val_fileName)
+    {
+        Close();
+
+        int fd = open(val_fileName.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat status;
+        if (fstat(fd, &status) != 0 || status.st_size == 0)
+        {
+            close(fd);
+            return false;
+        }
+
+        /*--- Pages are read on first access, so a rank only reads the rows it parses ---*/
+        void* map = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        d_size = status.st_size;
+
+        if (map != MAP_FAILED)
+        {
+            d_data = (const char*)map;
+            d_isMapped = true;
+            return true;
+        }
+
+        /*--- No mapping (some parallel file systems): one read into a buffer ---*/
+        ifstream file(val_fileName.c_str(), ios::in | ios::binary);
+        d_buffer.resize(d_size);
+        file.read(&d_buffer[0], d_size);
+        if (!file)
+        {
+            d_buffer.clear();
+            d_size = 0;
+            return false;
+        }
+        d_data = &d_buffer[0];
+        return true;
+    }
+
+    void GeomMeshFileSU2::Close()
+    {
+        if (d_isMapped) munmap((void*)d_data, d_size);
+        d_buffer.clear();
+        d_data = NULL;
+        d_size = 0;
+        d_isMapped = false;
+
+        d_numDim = 0;
+        d_numPoint = 0;
+        d_numPointDomain = 0;
+        d_numElem = 0;
+        d_markerOffset = 0;
+        d_pointOffset.clear();
+        d_elemOffset.clear();
+        d_elemMinNode.clear();
+        d_elemMaxNode.clear();
+    }
+
+    bool GeomMeshFileSU2::BuildIndex()
+    {
+        const char* end = GetEnd();
+        const char* line = d_data;
+        const char* value;
+        unsigned long iRow, number;
+        bool isDimSet = false;
+
+        while (line < end)
+        {
+            if (GeomMeshFileKeyword(line, end, "NDIME=", value))
+            {
+                /*--- A second NDIME starts the next zone ---*/
+                if (isDimSet) break;
+                if (ParseUnsigned(value, end, number) == NULL) return false;
+                d_numDim = number;
+                isDimSet = true;
+                line = NextRow(line);
+            }
+            else if (GeomMeshFileKeyword(line, end, "NPOIN=", value))
+            {
+                /*--- Number of points, optionally followed by the number of points of the domain ---*/
+                value = ParseUnsigned(value, end, d_numPoint);
+                if (value == NULL) return false;
+                if (ParseUnsigned(value, end, d_numPointDomain) == NULL) d_numPointDomain = d_numPoint;
+                if (d_numPointDomain > d_numPoint) return false;
+
+                line = NextRow(line);
+                d_pointOffset.clear();
+                for (iRow = 0; iRow < d_numPoint; iRow++)
+                {
+                    if (line >= end) return false;
+                    if (iRow % d_blockSize == 0) d_pointOffset.push_back(line - d_data);
+                    line = NextRow(line);
+                }
+            }
+            else if (GeomMeshFileKeyword(line, end, "NELEM=", value))
+            {
+                if (ParseUnsigned(value, end, d_numElem) == NULL) return false;
+
+                line = NextRow(line);
+                d_elemOffset.clear();
+                d_elemMinNode.clear();
+                d_elemMaxNode.clear();
+                for (iRow = 0; iRow < d_numElem; iRow++)
+                {
+                    if (line >= end) return false;
+                    if (iRow % d_blockSize == 0)
+                    {
+                        d_elemOffset.push_back(line - d_data);
+                        d_elemMinNode.push_back((unsigned long)-1);
+                        d_elemMaxNode.push_back(0);
+                    }
+
+                    /*--- Node range of the block, so the ranks can skip the blocks they do not need ---*/
+                    unsigned long vtkType, node;
+                    const char* cursor = ParseUnsigned(line, end, vtkType);
+                    unsigned short iNode, numNode = (cursor == NULL) ? 0 : GetNumElemNode(vtkType);
+                    if (numNode == 0) return false;
+                    for (iNode = 0; iNode < numNode; iNode++)
+                    {
+                        cursor = ParseUnsigned(cursor, end, node);
+                        if (cursor == NULL) return false;
+                        if (node < d_elemMinNode.back()) d_elemMinNode.back() = node;
+                        if (node > d_elemMaxNode.back()) d_elemMaxNode.back() = node;
+                    }
+                    line = NextRow(cursor);
+                }
+            }
+            else if (GeomMeshFileKeyword(line, end, "NMARK=", value))
+            {
+                /*--- The markers close the zone ---*/
+                d_markerOffset = line - d_data;
+                break;
+            }
+            else line = NextRow(line);
+        }
+
+        return isDimSet && d_pointOffset.size() == GetNumBlock(d_numPoint) && d_elemOffset.size() == GetNumBlock();
+    }
+
+    void GeomMeshFileSU2::PackIndex(vector<unsigned long>& val_index) const
+    {
+        val_index.clear();
+        val_index.push_back(d_numDim);
+        val_index.push_back(d_numPoint);
+        val_index.push_back(d_numPointDomain);
+        val_index.push_back(d_numElem);
+        val_index.push_back(d_markerOffset);
+        val_index.insert(val_index.end(), d_pointOffset.begin(), d_pointOffset.end());
+        val_index.insert(val_index.end(), d_elemOffset.begin(), d_elemOffset.end());
+        val_index.insert(val_index.end(), d_elemMinNode.begin(), d_elemMinNode.end());
+        val_index.insert(val_index.end(), d_elemMaxNode.begin(), d_elemMaxNode.end());
+    }
+
+    void GeomMeshFileSU2::UnpackIndex(const vector<unsigned long>& val_index)
+    {
+        d_numDim = val_index[0];
+        d_numPoint = val_index[1];
+        d_numPointDomain = val_index[2];
+        d_numElem = val_index[3];
+        d_markerOffset = val_index[4];
+
+        vector<unsigned long>::const_iterator position = val_index.begin() + 5;
+        unsigned long numPointBlock = GetNumBlock(d_numPoint), numElemBlock = GetNumBlock();
+        d_pointOffset.assign(position, position + numPointBlock); position += numPointBlock;
+        d_elemOffset.assign(position, position + numElemBlock); position += numElemBlock;
+        d_elemMinNode.assign(position, position + numElemBlock); position += numElemBlock;
+        d_elemMaxNode.assign(position, position + numElemBlock);
+    }
+
+    bool GeomMeshFileSU2::ReadMarkers(vector<string>& val_tag, vector<unsigned long>& val_markerPtr, vector<unsigned short>& val_type,
+                                      vector<unsigned long>& val_nodePtr, vector<unsigned long>& val_node) const
+    {
+        const char* end = GetEnd();
+        const char* value;
+        unsigned long iMarker, numMarker, iBound, numBound, vtkType, node;
+
+        val_tag.clear();
+        val_markerPtr.assign(1, 0);
+        val_type.clear();
+        val_nodePtr.assign(1, 0);
+        val_node.clear();
+        if (d_markerOffset == 0) return true;
+
+        const char* line = d_data + d_markerOffset;
+        if (!GeomMeshFileKeyword(line, end, "NMARK=", value) || ParseUnsigned(value, end, numMarker) == NULL) return false;
+        line = NextRow(line);
+
+        for (iMarker = 0; iMarker < numMarker; iMarker++)
+        {
+            /*--- Tag without blanks, as in MeshReaderSU2 ---*/
+            while (line < end && !GeomMeshFileKeyword(line, end, "MARKER_TAG=", value)) line = NextRow(line);
+            if (line >= end) return false;
+            string tag;
+            for (; value < end && *value != '\n'; value++)
+                if (!GeomMeshFileIsBlank(*value)) tag += *value;
+            val_tag.push_back(tag);
+            line = NextRow(line);
+
+            if (!GeomMeshFileKeyword(line, end, "MARKER_ELEMS=", value) || ParseUnsigned(value, end, numBound) == NULL) return false;
+            line = NextRow(line);
+            if (line < end && GeomMeshFileKeyword(line, end, "SEND_TO=", value)) line = NextRow(line);
+
+            for (iBound = 0; iBound < numBound; iBound++)
+            {
+                if (line >= end) return false;
+                const char* cursor = ParseUnsigned(line, end, vtkType);
+                unsigned short iNode, numNode = (cursor == NULL) ? 0 : GetNumElemNode(vtkType);
+                if (numNode == 0) return false;
+                for (iNode = 0; iNode < numNode; iNode++)
+                {
+                    cursor = ParseUnsigned(cursor, end, node);
+                    if (cursor == NULL) return false;
+                    val_node.push_back(node);
+                }
+                val_type.push_back(vtkType);
+                val_nodePtr.push_back(val_node.size());
+                line = NextRow(cursor);
+            }
+            val_markerPtr.push_back(val_type.size());
+        }
+        return true;
+    }
+
+    const char* GeomMeshFileSU2::GetRow(const vector<unsigned long>& val_offset, unsigned long val_iRow) const
+    {
+        const char* row = d_data + val_offset[val_iRow / d_blockSize];
+        for (unsigned long iRow = 0; iRow < val_iRow % d_blockSize; iRow++) row = NextRow(row);
+        return row;
+    }
+
+    const char* GeomMeshFileSU2::GetPointRow(unsigned long val_iRow) const
+    {
+        return GetRow(d_pointOffset, val_iRow);
+    }
+
+    const char* GeomMeshFileSU2::GetElemRow(unsigned long val_iRow) const
+    {
+        return GetRow(d_elemOffset, val_iRow);
+    }
+
+    const char* GeomMeshFileSU2::NextRow(const char* val_row) const
+    {
+        const char* end = GetEnd();
+        const char* newLine = (const char*)memchr(val_row, '\n', end - val_row);
+        return (newLine == NULL) ? end : newLine + 1;
+    }
+
+    const char* GeomMeshFileSU2::ParseUnsigned(const char* val_begin, const char* val_end, unsigned long& val_value)
+    {
+        if (val_begin == NULL) return NULL;
+
+        const char* cursor = val_begin;
+        while (cursor < val_end && GeomMeshFileIsBlank(*cursor)) cursor++;
+        if (cursor == val_end || !GeomMeshFileIsDigit(*cursor)) return NULL;
+
+        unsigned long value = 0;
+        while (cursor < val_end && GeomMeshFileIsDigit(*cursor)) value = 10*value + (*cursor++ - '0');
+        val_value = value;
+        return cursor;
+    }
+
+    const char* GeomMeshFileSU2::ParseDouble(const char* val_begin, const char* val_end, double& val_value)
+    {
+        if (val_begin == NULL) return NULL;
+
+        const char* cursor = val_begin;
+        while (cursor < val_end && GeomMeshFileIsBlank(*cursor)) cursor++;
+        const char* start = cursor;
+
+        bool isNegative = false;
+        if (cursor < val_end && (*cursor == '-' || *cursor == '+')) isNegative = (*cursor++ == '-');
+
+        /*--- Up to 19 significant digits in an integer, the others only move the exponent ---*/
+        unsigned long long mantissa = 0;
+        int exponent = 0, numDigit = 0, numSignificant = 0;
+        while (cursor < val_end && GeomMeshFileIsDigit(*cursor))
+        {
+            if (numSignificant < 19) { mantissa = 10*mantissa + (*cursor - '0'); if (mantissa > 0) numSignificant++; }
+            else exponent++;
+            cursor++; numDigit++;
+        }
+        if (cursor < val_end && *cursor == '.')
+        {
+            cursor++;
+            while (cursor < val_end && GeomMeshFileIsDigit(*cursor))
+            {
+                if (numSignificant < 19) { mantissa = 10*mantissa + (*cursor - '0'); exponent--; if (mantissa > 0) numSignificant++; }
+                cursor++; numDigit++;
+            }
+        }
+        if (numDigit == 0) return NULL;
+
+        /*--- Exponent, with the Fortran 'D' as well ---*/
+        if (cursor < val_end && (*cursor == 'e' || *cursor == 'E' || *cursor == 'd' || *cursor == 'D'))
+        {
+            const char* mark = cursor++;
+            bool isNegativeExp = false;
+            if (cursor < val_end && (*cursor == '-' || *cursor == '+')) isNegativeExp = (*cursor++ == '-');
+            if (cursor < val_end && GeomMeshFileIsDigit(*cursor))
+            {
+                int value = 0;
+                while (cursor < val_end && GeomMeshFileIsDigit(*cursor))
+                {
+                    if (value < 100000) value = 10*value + (*cursor - '0');
+                    cursor++;
+                }
+                exponent += isNegativeExp ? -value : value;
+            }
+            else cursor = mark;
+        }
+
+        /*--- Exact when the mantissa and the power of ten are exact doubles, else the C library rounds it ---*/
+        if (mantissa < (1ULL << 53) && exponent >= -22 && exponent <= 22)
+        {
+            double value = double(mantissa);
+            value = (exponent < 0) ? value / GeomMeshFilePow10[-exponent] : value*GeomMeshFilePow10[exponent];
+            val_value = isNegative ? -value : value;
+        }
+        else
+        {
+            char token[128];
+            size_t length = cursor - start;
+            if (length >= sizeof(token)) return NULL;
+            memcpy(token, start, length);
+            token[length] = '\0';
+            for (size_t iChar = 0; iChar < length; iChar++)
+                if (token[iChar] == 'd' || token[iChar] == 'D') token[iChar] = 'e';
+            val_value = strtod(token, NULL);
+        }
+        return cursor;
+    }
+
+    unsigned short GeomMeshFileSU2::GetNumElemNode(unsigned long val_vtkType)
+    {
+        switch (val_vtkType)
+        {
+            case VERTEX:      return 1;
+            case LINE:        return N_POINTS_LINE;
+            case TRIANGLE:    return N_POINTS_TRIANGLE;
+            case RECTANGLE:   return N_POINTS_QUADRILATERAL;
+            case TETRAHEDRON: return N_POINTS_TETRAHEDRON;
+            case HEXAHEDRON:  return N_POINTS_HEXAHEDRON;
+            case PRISM:       return N_POINTS_PRISM;
+            case PYRAMID:     return N_POINTS_PYRAMID;
+            default:          return 0;
+        }
+    }
+
+    unsigned long GeomMeshFileSU2::GetLinearBegin(unsigned long val_num, int val_rank, int val_size)
+    {
+        return val_rank*(val_num / val_size) + min((unsigned long)val_rank, val_num % val_size);
+    }
+}
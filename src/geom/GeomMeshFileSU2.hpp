@@ -0,0 +1,165 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Memory-mapped SU2 mesh file with an offset index of its rows
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMMESHFILESU2_HPP
+#define ARIES_GEOMMESHFILESU2_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Read-only view of an ASCII SU2 mesh file, mapped in memory, with an index of its rows.
+     *
+     * One scan of the file (BuildIndex) finds the NDIME, NPOIN, NELEM and
+     * NMARK keywords and records the byte offset of every block of
+     * d_blockSize rows of the point and element sections, plus the smallest
+     * and largest node of the elements of every block. The index is a few
+     * numbers per thousand rows, so it is built by one rank and sent to the
+     * others (PackIndex/UnpackIndex); a rank then jumps to the rows of its
+     * linear partition of the points, skips the element blocks that have no
+     * node in that partition, and only the pages it touches are read from
+     * disk. Numbers are parsed in place by ParseUnsigned and ParseDouble,
+     * without streams, locale or copies of the lines; when the file cannot
+     * be mapped it is read into one buffer instead.
+     */
+    class GeomMeshFileSU2
+    {
+    public:
+        GeomMeshFileSU2();
+        ~GeomMeshFileSU2();
+
+        /*!
+         * \brief Map the file.
+         * \return <code>false</code> if the file cannot be opened or is empty.
+         */
+        bool Open(const string& val_fileName);
+
+        /*!
+         * \brief Unmap the file and clear the index.
+         */
+        void Close();
+
+        /*!
+         * \brief Scan the file once and build the index of the sections.
+         * \return <code>false</code> if a section is truncated or NPOIN is improperly specified.
+         */
+        bool BuildIndex();
+
+        /*!
+         * \brief Index as a flat array, to be broadcast to the ranks that did not build it.
+         */
+        void PackIndex(vector<unsigned long>& val_index) const;
+
+        /*!
+         * \brief Set the index packed by PackIndex on another rank.
+         */
+        void UnpackIndex(const vector<unsigned long>& val_index);
+
+        unsigned short GetNumDim() const { return d_numDim; };
+        unsigned long GetNumPoint() const { return d_numPoint; };
+        unsigned long GetNumPointDomain() const { return d_numPointDomain; };
+        unsigned long GetNumElem() const { return d_numElem; };
+        unsigned long GetNumBlock() const { return GetNumBlock(d_numElem); };
+        unsigned long GetBlockSize() const { return d_blockSize; };
+
+        /*!
+         * \brief Smallest and largest node of the elements of a block.
+         */
+        unsigned long GetBlockMinNode(unsigned long val_iBlock) const { return d_elemMinNode[val_iBlock]; };
+        unsigned long GetBlockMaxNode(unsigned long val_iBlock) const { return d_elemMaxNode[val_iBlock]; };
+
+        /*!
+         * \brief Byte offset of the NMARK line, 0 if the file has no markers.
+         */
+        unsigned long GetMarkerOffset() const { return d_markerOffset; };
+
+        /*!
+         * \brief Parse the boundary elements of all the markers, after NMARK.
+         * \param[out] val_tag - Tags of the markers.
+         * \param[out] val_markerPtr - CSR offsets of the boundary elements of the markers.
+         * \param[out] val_type - VTK type of the boundary elements.
+         * \param[out] val_nodePtr - CSR offsets of the nodes of the boundary elements.
+         * \param[out] val_node - Nodes of the boundary elements.
+         * \return <code>false</code> if a marker is truncated or improperly specified.
+         */
+        bool ReadMarkers(vector<string>& val_tag, vector<unsigned long>& val_markerPtr, vector<unsigned short>& val_type,
+                         vector<unsigned long>& val_nodePtr, vector<unsigned long>& val_node) const;
+
+        /*!
+         * \brief Start of a row of the point or of the element section.
+         */
+        const char* GetPointRow(unsigned long val_iRow) const;
+        const char* GetElemRow(unsigned long val_iRow) const;
+
+        /*!
+         * \brief Start of the row after the one of <i>val_row</i>.
+         */
+        const char* NextRow(const char* val_row) const;
+
+        const char* GetEnd() const { return d_data + d_size; };
+
+        /*!
+         * \brief Parse an unsigned integer after blanks, stopping at the end of the line.
+         * \return The character after the number, <code>NULL</code> if there is no number or <i>val_begin</i> is <code>NULL</code>, so calls can be chained.
+         */
+        static const char* ParseUnsigned(const char* val_begin, const char* val_end, unsigned long& val_value);
+
+        /*!
+         * \brief Parse a floating-point number after blanks, stopping at the end of the line.
+         * \return The character after the number, <code>NULL</code> if there is no number.
+         */
+        static const char* ParseDouble(const char* val_begin, const char* val_end, double& val_value);
+
+        /*!
+         * \brief Number of nodes of a VTK element type, 0 for an unknown type.
+         */
+        static unsigned short GetNumElemNode(unsigned long val_vtkType);
+
+        /*!
+         * \brief First index of a rank in a linear partition, the remainder going to the first ranks (as in MeshReaderSU2).
+         */
+        static unsigned long GetLinearBegin(unsigned long val_num, int val_rank, int val_size);
+
+    private:
+        const char* GetRow(const vector<unsigned long>& val_offset, unsigned long val_iRow) const;
+        static unsigned long GetNumBlock(unsigned long val_numRow) { return (val_numRow + d_blockSize - 1) / d_blockSize; };
+
+        static const unsigned long d_blockSize = 1024;  /*!< \brief Rows per entry of the index. */
+
+        const char* d_data;                     /*!< \brief Contents of the file. */
+        size_t d_size;                          /*!< \brief Size of the file. */
+        bool d_isMapped;                        /*!< \brief Whether d_data is a mapping or the buffer. */
+        vector<char> d_buffer;                  /*!< \brief Contents of the file when it cannot be mapped. */
+
+        unsigned short d_numDim;                /*!< \brief Number of dimensions. */
+        unsigned long d_numPoint;               /*!< \brief Number of points, ghost points included. */
+        unsigned long d_numPointDomain;         /*!< \brief Number of points of the domain. */
+        unsigned long d_numElem;                /*!< \brief Number of interior elements. */
+        unsigned long d_markerOffset;           /*!< \brief Byte offset of the NMARK line. */
+        vector<unsigned long> d_pointOffset;    /*!< \brief Byte offsets of the blocks of point rows. */
+        vector<unsigned long> d_elemOffset;     /*!< \brief Byte offsets of the blocks of element rows. */
+        vector<unsigned long> d_elemMinNode;    /*!< \brief Smallest node of the elements of every block. */
+        vector<unsigned long> d_elemMaxNode;    /*!< \brief Largest node of the elements of every block. */
+    };
+}
+
+#endif
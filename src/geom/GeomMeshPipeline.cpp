@@ -0,0 +1,360 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Pipelined read of an SU2 mesh: an I/O thread feeding parsed chunks to MeshData
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomMeshPipeline.hpp"
+#include "MeshData.hpp"
+#include "AriesMPI.hpp"
+#include "const_def.h"
+
+#include <algorithm>
+
+#include <sched.h>
+
+namespace ARIES
+{
+    GeomMeshPipeline::GeomMeshPipeline(unsigned short val_numSlot)
+    {
+        d_slot.resize(max(val_numSlot, (unsigned short)1));
+        d_pointBegin = d_pointEnd = 0;
+        d_numParsed = d_numAppended = 0;
+        d_consumerWait = d_producerWait = 0.0;
+        d_isValid = true;
+        d_pointElemPtr.assign(1, 0);
+        ARIES_omp_init_lock(&d_lock);
+    }
+
+    GeomMeshPipeline::~GeomMeshPipeline()
+    {
+        ARIES_omp_destroy_lock(&d_lock);
+    }
+
+    bool GeomMeshPipeline::Read(const string& val_fileName, MeshData* val_meshData)
+    {
+        unsigned long iBlock, iPoint;
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        const int rank = (mpi.GetSize() > 1) ? mpi.GetRank() : 0, size = (mpi.GetSize() > 1) ? mpi.GetSize() : 1;
+
+        /*--- The master scans the file, the others get the index ---*/
+        vector<unsigned long> index;
+        int isOpen = d_file.Open(val_fileName) ? 1 : 0, isOpenAll = isOpen;
+        if (size > 1) mpi.Allreduce(&isOpen, &isOpenAll, 1, MPI_INT, MPI_MIN);
+        if (isOpenAll == 1 && rank == MASTER_NODE && d_file.BuildIndex()) d_file.PackIndex(index);
+        if (isOpenAll == 1 && size > 1)
+        {
+            unsigned long indexSize = index.size();
+            mpi.Bcast(&indexSize, 1, MPI_UNSIGNED_LONG, MASTER_NODE);
+            index.resize(indexSize);
+            if (indexSize > 0) mpi.Bcast(&index[0], (int)indexSize, MPI_UNSIGNED_LONG, MASTER_NODE);
+            if (rank != MASTER_NODE && indexSize > 0) d_file.UnpackIndex(index);
+        }
+        if (isOpenAll == 0 || index.empty())
+        {
+            d_file.Close();
+            return false;
+        }
+
+        d_pointBegin = GeomMeshFileSU2::GetLinearBegin(d_file.GetNumPoint(), rank, size);
+        d_pointEnd = GeomMeshFileSU2::GetLinearBegin(d_file.GetNumPoint(), rank + 1, size);
+
+        /*--- Tasks in the order of the file: point blocks of the partition, element blocks reaching it, markers ---*/
+        d_taskType.clear();
+        d_taskBlock.clear();
+        const unsigned long blockSize = d_file.GetBlockSize();
+        if (d_pointEnd > d_pointBegin)
+        {
+            for (iBlock = d_pointBegin / blockSize; iBlock <= (d_pointEnd - 1) / blockSize; iBlock++)
+            {
+                d_taskType.push_back(Task_Point);
+                d_taskBlock.push_back(iBlock);
+            }
+        }
+        for (iBlock = 0; iBlock < d_file.GetNumBlock(); iBlock++)
+        {
+            if (d_file.GetBlockMaxNode(iBlock) < d_pointBegin || d_file.GetBlockMinNode(iBlock) >= d_pointEnd) continue;
+            d_taskType.push_back(Task_Elem);
+            d_taskBlock.push_back(iBlock);
+        }
+        d_taskType.push_back(Task_Marker);
+        d_taskBlock.push_back(0);
+
+        vector<double>& coord = val_meshData->GetCoord();
+        coord.clear();
+        coord.reserve((d_pointEnd - d_pointBegin)*d_file.GetNumDim());
+        val_meshData->GetPointGlobal().clear();
+        val_meshData->GetPointGlobal().reserve(d_pointEnd - d_pointBegin);
+        val_meshData->GetElemType().clear();
+        val_meshData->GetElemNodePtr().assign(1, 0);
+        val_meshData->GetElemNode().clear();
+        d_pointElemPtr.assign(d_pointEnd - d_pointBegin + 1, 0);
+        d_pointElem.clear();
+        d_tag.clear();
+
+        /*--- The I/O thread parses the tasks while this one appends them ---*/
+        d_numParsed = d_numAppended = 0;
+        d_consumerWait = d_producerWait = 0.0;
+        d_isValid = true;
+        if (ARIES_omp_get_max_threads() > 1 && d_slot.size() > 1)
+        {
+            /*--- The team can get fewer threads than asked for (dynamic adjustment, thread limit,
+            nested region); a lone thread would wait on itself, so it reads the tasks in turn ---*/
+#pragma omp parallel num_threads(2)
+            {
+                if (ARIES_omp_get_num_threads() < 2) ReadSequential(val_meshData);
+                else if (ARIES_omp_get_thread_num() == 0) Produce();
+                else Consume(val_meshData);
+            }
+        }
+        else ReadSequential(val_meshData);
+
+        /*--- Elements around the owned points: the counts were made while reading ---*/
+        const vector<unsigned long>& elemNodePtr = val_meshData->GetElemNodePtr();
+        const vector<unsigned long>& elemNode = val_meshData->GetElemNode();
+        for (iPoint = 0; iPoint < d_pointEnd - d_pointBegin; iPoint++) d_pointElemPtr[iPoint + 1] += d_pointElemPtr[iPoint];
+        d_pointElem.resize(d_pointElemPtr.back());
+        vector<unsigned long> fill(d_pointElemPtr.begin(), d_pointElemPtr.end() - 1);
+        for (unsigned long iElem = 0; iElem + 1 < elemNodePtr.size(); iElem++)
+            for (unsigned long iNode = elemNodePtr[iElem]; iNode < elemNodePtr[iElem + 1]; iNode++)
+                if (IsOwned(elemNode[iNode])) d_pointElem[fill[elemNode[iNode] - d_pointBegin]++] = iElem;
+
+        /*--- Counts of the mesh ---*/
+        unsigned long numPointDomain = 0;
+        for (iPoint = d_pointBegin; iPoint < d_pointEnd; iPoint++)
+            if (iPoint < d_file.GetNumPointDomain()) numPointDomain++;
+
+        val_meshData->SetFlatCount();
+        val_meshData->SetNumDim(d_file.GetNumDim());
+        val_meshData->SetNumPointDomain(numPointDomain);
+        val_meshData->SetNumPointGlobal(d_file.GetNumPoint());
+        val_meshData->SetNumPointDomainGlobal(d_file.GetNumPointDomain());
+        val_meshData->SetNumElemGlobal(d_file.GetNumElem());
+        for (unsigned short iMarker = 0; iMarker < d_tag.size() && iMarker < val_meshData->GetNumMarker(); iMarker++)
+            val_meshData->SetMarkerTag(iMarker, d_tag[iMarker]);
+        d_file.Close();
+
+        int isValid = d_isValid ? 1 : 0, isValidAll = isValid;
+        if (size > 1) mpi.Allreduce(&isValid, &isValidAll, 1, MPI_INT, MPI_MIN);
+        return isValidAll == 1;
+    }
+
+    void GeomMeshPipeline::ReadSequential(MeshData* val_meshData)
+    {
+        for (unsigned long iTask = 0; iTask < d_taskType.size(); iTask++)
+        {
+            ParseTask(iTask, d_slot[0]);
+            AppendChunk(iTask, d_slot[0], val_meshData);
+        }
+    }
+
+    void GeomMeshPipeline::Produce()
+    {
+        const unsigned long numSlot = d_slot.size();
+        for (unsigned long iTask = 0; iTask < d_taskType.size(); iTask++)
+        {
+            /*--- Wait for the slot of the task to be appended ---*/
+            double start = AriesMPI::Wtime();
+            bool isFree = false;
+            while (!isFree)
+            {
+                ARIES_omp_set_lock(&d_lock);
+                isFree = (iTask - d_numAppended < numSlot);
+                ARIES_omp_unset_lock(&d_lock);
+                if (!isFree) sched_yield();
+            }
+            d_producerWait += AriesMPI::Wtime() - start;
+
+            ParseTask(iTask, d_slot[iTask % numSlot]);
+
+            ARIES_omp_set_lock(&d_lock);
+            d_numParsed = iTask + 1;
+            ARIES_omp_unset_lock(&d_lock);
+        }
+    }
+
+    void GeomMeshPipeline::Consume(MeshData* val_meshData)
+    {
+        const unsigned long numSlot = d_slot.size();
+        for (unsigned long iTask = 0; iTask < d_taskType.size(); iTask++)
+        {
+            /*--- Wait for the task to be parsed ---*/
+            double start = AriesMPI::Wtime();
+            bool isParsed = false;
+            while (!isParsed)
+            {
+                ARIES_omp_set_lock(&d_lock);
+                isParsed = (iTask < d_numParsed);
+                ARIES_omp_unset_lock(&d_lock);
+                if (!isParsed) sched_yield();
+            }
+            d_consumerWait += AriesMPI::Wtime() - start;
+
+            AppendChunk(iTask, d_slot[iTask % numSlot], val_meshData);
+
+            ARIES_omp_set_lock(&d_lock);
+            d_numAppended = iTask + 1;
+            ARIES_omp_unset_lock(&d_lock);
+        }
+    }
+
+    void GeomMeshPipeline::ParseTask(unsigned long val_iTask, Chunk& val_chunk) const
+    {
+        val_chunk.isValid = true;
+        val_chunk.coord.clear();
+        val_chunk.pointGlobal.clear();
+        val_chunk.type.clear();
+        val_chunk.nodePtr.assign(1, 0);
+        val_chunk.node.clear();
+        val_chunk.markerPtr.assign(1, 0);
+        val_chunk.tag.clear();
+
+        switch (d_taskType[val_iTask])
+        {
+            case Task_Point: ParsePoint(d_taskBlock[val_iTask], val_chunk); break;
+            case Task_Elem:  ParseElem(d_taskBlock[val_iTask], val_chunk); break;
+            default:         ParseMarker(val_chunk); break;
+        }
+    }
+
+    void GeomMeshPipeline::ParsePoint(unsigned long val_iBlock, Chunk& val_chunk) const
+    {
+        const char* end = d_file.GetEnd();
+        const unsigned short numDim = d_file.GetNumDim();
+        unsigned long first = max(val_iBlock*d_file.GetBlockSize(), d_pointBegin);
+        unsigned long last = min((val_iBlock + 1)*d_file.GetBlockSize(), d_pointEnd);
+
+        val_chunk.coord.resize((last - first)*numDim);
+        val_chunk.pointGlobal.resize(last - first);
+        const char* row = d_file.GetPointRow(first);
+        for (unsigned long iPoint = first; iPoint < last; iPoint++)
+        {
+            const char* cursor = row;
+            for (unsigned short iDim = 0; iDim < numDim; iDim++)
+                cursor = GeomMeshFileSU2::ParseDouble(cursor, end, val_chunk.coord[(iPoint - first)*numDim + iDim]);
+            if (cursor == NULL)
+            {
+                val_chunk.isValid = false;
+                return;
+            }
+            val_chunk.pointGlobal[iPoint - first] = iPoint;
+            row = d_file.NextRow(cursor);
+        }
+    }
+
+    void GeomMeshPipeline::ParseElem(unsigned long val_iBlock, Chunk& val_chunk) const
+    {
+        const char* end = d_file.GetEnd();
+        unsigned long first = val_iBlock*d_file.GetBlockSize();
+        unsigned long last = min(first + d_file.GetBlockSize(), d_file.GetNumElem());
+        unsigned long vtkType, node[N_POINTS_HEXAHEDRON];
+
+        val_chunk.type.reserve(last - first);
+        val_chunk.nodePtr.reserve(last - first + 1);
+        val_chunk.node.reserve((last - first)*N_POINTS_TETRAHEDRON);
+        const char* row = d_file.GetElemRow(first);
+        for (unsigned long iElem = first; iElem < last; iElem++)
+        {
+            const char* cursor = GeomMeshFileSU2::ParseUnsigned(row, end, vtkType);
+            unsigned short iNode, numNode = GeomMeshFileSU2::GetNumElemNode(vtkType);
+            bool isOwned = false;
+            for (iNode = 0; iNode < numNode; iNode++)
+            {
+                cursor = GeomMeshFileSU2::ParseUnsigned(cursor, end, node[iNode]);
+                if (cursor != NULL) isOwned = isOwned || IsOwned(node[iNode]);
+            }
+            if (cursor == NULL || numNode == 0 || numNode > N_POINTS_HEXAHEDRON)
+            {
+                val_chunk.isValid = false;
+                return;
+            }
+            row = d_file.NextRow(cursor);
+
+            /*--- Elements with a node in the partition only ---*/
+            if (!isOwned) continue;
+            val_chunk.type.push_back((unsigned short)vtkType);
+            val_chunk.node.insert(val_chunk.node.end(), node, node + numNode);
+            val_chunk.nodePtr.push_back(val_chunk.node.size());
+        }
+    }
+
+    void GeomMeshPipeline::ParseMarker(Chunk& val_chunk) const
+    {
+        vector<unsigned long> markerPtr, nodePtr, node;
+        vector<unsigned short> type;
+        if (!d_file.ReadMarkers(val_chunk.tag, markerPtr, type, nodePtr, node))
+        {
+            val_chunk.isValid = false;
+            return;
+        }
+
+        /*--- Boundary elements with a node in the partition only ---*/
+        for (unsigned long iMarker = 0; iMarker + 1 < markerPtr.size(); iMarker++)
+        {
+            for (unsigned long iBound = markerPtr[iMarker]; iBound < markerPtr[iMarker + 1]; iBound++)
+            {
+                bool isOwned = false;
+                for (unsigned long iNode = nodePtr[iBound]; iNode < nodePtr[iBound + 1] && !isOwned; iNode++) isOwned = IsOwned(node[iNode]);
+                if (!isOwned) continue;
+                val_chunk.type.push_back(type[iBound]);
+                val_chunk.node.insert(val_chunk.node.end(), node.begin() + nodePtr[iBound], node.begin() + nodePtr[iBound + 1]);
+                val_chunk.nodePtr.push_back(val_chunk.node.size());
+            }
+            val_chunk.markerPtr.push_back(val_chunk.type.size());
+        }
+    }
+
+    void GeomMeshPipeline::AppendChunk(unsigned long val_iTask, const Chunk& val_chunk, MeshData* val_meshData)
+    {
+        unsigned long iElem, iNode;
+        d_isValid = d_isValid && val_chunk.isValid;
+        if (!val_chunk.isValid) return;
+
+        switch (d_taskType[val_iTask])
+        {
+            case Task_Point:
+            {
+                vector<double>& coord = val_meshData->GetCoord();
+                vector<unsigned long>& pointGlobal = val_meshData->GetPointGlobal();
+                coord.insert(coord.end(), val_chunk.coord.begin(), val_chunk.coord.end());
+                pointGlobal.insert(pointGlobal.end(), val_chunk.pointGlobal.begin(), val_chunk.pointGlobal.end());
+                break;
+            }
+            case Task_Elem:
+            {
+                vector<unsigned short>& elemType = val_meshData->GetElemType();
+                vector<unsigned long>& elemNodePtr = val_meshData->GetElemNodePtr();
+                vector<unsigned long>& elemNode = val_meshData->GetElemNode();
+                const unsigned long nodeBegin = elemNode.size();
+
+                elemType.insert(elemType.end(), val_chunk.type.begin(), val_chunk.type.end());
+                elemNode.insert(elemNode.end(), val_chunk.node.begin(), val_chunk.node.end());
+                for (iElem = 1; iElem < val_chunk.nodePtr.size(); iElem++) elemNodePtr.push_back(nodeBegin + val_chunk.nodePtr[iElem]);
+
+                /*--- First pass of the point-to-element connectivity, while the next blocks are parsed ---*/
+                for (iNode = 0; iNode < val_chunk.node.size(); iNode++)
+                    if (IsOwned(val_chunk.node[iNode])) d_pointElemPtr[val_chunk.node[iNode] - d_pointBegin + 1]++;
+                break;
+            }
+            default:
+            {
+                val_meshData->GetBoundPtr() = val_chunk.markerPtr;
+                val_meshData->GetBoundType() = val_chunk.type;
+                val_meshData->GetBoundNodePtr() = val_chunk.nodePtr;
+                val_meshData->GetBoundNode() = val_chunk.node;
+                d_tag = val_chunk.tag;
+                break;
+            }
+        }
+    }
+}
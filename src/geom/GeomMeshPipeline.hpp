@@ -0,0 +1,145 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Pipelined read of an SU2 mesh: an I/O thread feeding parsed chunks to MeshData
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMMESHPIPELINE_HPP
+#define ARIES_GEOMMESHPIPELINE_HPP
+
+#include "GeomMeshFileSU2.hpp"
+#include "AriesOMP.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    class MeshData;
+
+    /*!
+     * \brief Read of the partition of a rank from an SU2 mesh, overlapped with the point-to-element connectivity.
+     *
+     * The rank keeps the points of its linear partition and every element
+     * and boundary element with a node among them, as MeshReaderSU2 does.
+     * The work is cut into tasks of GeomMeshFileSU2 blocks (the point rows,
+     * the element rows whose nodes can reach the partition, then the
+     * markers). A dedicated I/O thread parses the tasks in order into a ring
+     * of d_numSlot chunks and the calling thread takes them out in the same
+     * order, appends them to the flat arrays of MeshData and counts the
+     * elements around every owned point, so faulting the pages of the file
+     * and parsing the numbers overlap with the assembly of the mesh. The ring
+     * bounds the memory held by parsed chunks; the two threads only share
+     * the two counters of the ring, behind one lock. At the end the counts
+     * become the CSR offsets of the elements around the owned points, which
+     * are filled in one pass. Without OpenMP, or when the team gets a single
+     * thread, the tasks are parsed and appended one after the other.
+     */
+    class GeomMeshPipeline
+    {
+    public:
+        /*!
+         * \param[in] val_numSlot - Number of parsed chunks held at most between the two threads.
+         */
+        GeomMeshPipeline(unsigned short val_numSlot = 8);
+        ~GeomMeshPipeline();
+
+        /*!
+         * \brief Read the partition of this rank into the flat arrays of a mesh (collective).
+         * \return <code>false</code> if the file cannot be opened or a section is improperly specified on a rank.
+         */
+        bool Read(const string& val_fileName, MeshData* val_meshData);
+
+        /*!
+         * \brief Elements around an owned point (local element indices); the point is the index in the partition.
+         */
+        unsigned long GetNumPointElem(unsigned long val_iPoint) const { return d_pointElemPtr[val_iPoint + 1] - d_pointElemPtr[val_iPoint]; };
+        const unsigned long* GetPointElem(unsigned long val_iPoint) const { return &d_pointElem[d_pointElemPtr[val_iPoint]]; };
+
+        /*!
+         * \brief Time the consumer waited for the I/O thread and the I/O thread for a free slot, in seconds.
+         */
+        double GetConsumerWait() const { return d_consumerWait; };
+        double GetProducerWait() const { return d_producerWait; };
+
+    private:
+        typedef enum
+        {
+            Task_Point = 0,     /*!< \brief Block of point rows. */
+            Task_Elem = 1,      /*!< \brief Block of element rows. */
+            Task_Marker = 2     /*!< \brief All the markers. */
+        } TaskType;
+
+        /*!
+         * \brief Rows of a task parsed by the I/O thread, in the layout of the flat arrays of MeshData.
+         */
+        struct Chunk
+        {
+            bool isValid;
+            vector<double> coord;
+            vector<unsigned long> pointGlobal;
+            vector<unsigned short> type;
+            vector<unsigned long> nodePtr;
+            vector<unsigned long> node;
+            vector<unsigned long> markerPtr;
+            vector<string> tag;
+        };
+
+        /*!
+         * \brief Parse a task into a chunk (I/O thread).
+         */
+        void ParseTask(unsigned long val_iTask, Chunk& val_chunk) const;
+        void ParsePoint(unsigned long val_iBlock, Chunk& val_chunk) const;
+        void ParseElem(unsigned long val_iBlock, Chunk& val_chunk) const;
+        void ParseMarker(Chunk& val_chunk) const;
+
+        /*!
+         * \brief Append a parsed chunk to the mesh and count the elements around the owned points (calling thread).
+         */
+        void AppendChunk(unsigned long val_iTask, const Chunk& val_chunk, MeshData* val_meshData);
+
+        /*!
+         * \brief Parse and append the tasks one after the other in the calling thread.
+         */
+        void ReadSequential(MeshData* val_meshData);
+
+        void Produce();
+        void Consume(MeshData* val_meshData);
+
+        bool IsOwned(unsigned long val_node) const { return val_node >= d_pointBegin && val_node < d_pointEnd; };
+
+        GeomMeshFileSU2 d_file;                 /*!< \brief Mapped mesh file with the index of its rows. */
+        unsigned long d_pointBegin;             /*!< \brief First point of the partition. */
+        unsigned long d_pointEnd;               /*!< \brief Point after the last one of the partition. */
+
+        vector<unsigned short> d_taskType;      /*!< \brief Type of the tasks, in the order of the file. */
+        vector<unsigned long> d_taskBlock;      /*!< \brief Block of the tasks. */
+
+        vector<Chunk> d_slot;                   /*!< \brief Ring of parsed chunks. */
+        unsigned long d_numParsed;              /*!< \brief Tasks parsed by the I/O thread. */
+        unsigned long d_numAppended;            /*!< \brief Tasks appended to the mesh. */
+        ARIES_omp_lock_t d_lock;                /*!< \brief Lock of the two counters of the ring. */
+        double d_consumerWait;                  /*!< \brief Time the consumer waited for chunks. */
+        double d_producerWait;                  /*!< \brief Time the I/O thread waited for free slots. */
+
+        vector<string> d_tag;                   /*!< \brief Tags of the markers. */
+        bool d_isValid;                         /*!< \brief Whether every chunk appended so far was parsed. */
+        vector<unsigned long> d_pointElemPtr;   /*!< \brief CSR offsets of the elements around the owned points. */
+        vector<unsigned long> d_pointElem;      /*!< \brief Elements around the owned points. */
+    };
+}
+
+#endif
@@ -0,0 +1,561 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Mesh quality metrics with histograms, updated incrementally
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomMeshQuality.hpp"
+
+#include "AriesMPI.hpp"
+#include "const_def.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+
+namespace ARIES
+{
+    /*--- Local numbering of the edges and faces of the elements (VTK ordering) ---*/
+    static const unsigned short Quality_TriaEdge[3][2] = { {0,1}, {1,2}, {2,0} };
+    static const unsigned short Quality_QuadEdge[4][2] = { {0,1}, {1,2}, {2,3}, {3,0} };
+    static const unsigned short Quality_TetrEdge[6][2] = { {0,1}, {1,2}, {2,0}, {0,3}, {1,3}, {2,3} };
+    static const unsigned short Quality_HexaEdge[12][2] = { {0,1}, {1,2}, {2,3}, {3,0}, {4,5}, {5,6}, {6,7}, {7,4}, {0,4}, {1,5}, {2,6}, {3,7} };
+    static const unsigned short Quality_PrisEdge[9][2] = { {0,1}, {1,2}, {2,0}, {3,4}, {4,5}, {5,3}, {0,3}, {1,4}, {2,5} };
+    static const unsigned short Quality_PyraEdge[8][2] = { {0,1}, {1,2}, {2,3}, {3,0}, {0,4}, {1,4}, {2,4}, {3,4} };
+
+    /*--- Faces are ordered so that their right-hand normal points out of the element ---*/
+    static const unsigned short Quality_TetrFace[4][4] = { {0,2,1,0}, {0,1,3,0}, {1,2,3,0}, {0,3,2,0} };
+    static const unsigned short Quality_HexaFace[6][4] = { {0,3,2,1}, {4,5,6,7}, {0,1,5,4}, {1,2,6,5}, {2,3,7,6}, {3,0,4,7} };
+    static const unsigned short Quality_PrisFace[5][4] = { {0,1,2,0}, {3,5,4,0}, {0,3,4,1}, {1,4,5,2}, {2,5,3,0} };
+    static const unsigned short Quality_PyraFace[5][4] = { {0,3,2,1}, {0,1,4,0}, {1,2,4,0}, {2,3,4,0}, {3,0,4,0} };
+    static const unsigned short Quality_TetrFaceSize[4] = { 3, 3, 3, 3 };
+    static const unsigned short Quality_HexaFaceSize[6] = { 4, 4, 4, 4, 4, 4 };
+    static const unsigned short Quality_PrisFaceSize[5] = { 3, 3, 4, 4, 4 };
+    static const unsigned short Quality_PyraFaceSize[5] = { 4, 3, 3, 3, 3 };
+
+    /*--- Ratios are clamped so that a degenerate entity does not spoil the mean ---*/
+    static const double Quality_MaxRatio = 1.0E6;
+    static const double Quality_Degree = 180.0 / acos(-1.0);
+
+    GeomMeshQuality::GeomMeshQuality(unsigned short val_numDim, unsigned short val_numBin)
+    {
+        d_numDim = val_numDim;
+        d_numBin = (val_numBin > 0) ? val_numBin : 1;
+        d_numPoint = 0;
+        d_elemValid = false;
+        d_edgeValid = false;
+
+        d_localHistogram.assign(Quality_Num*d_numBin, 0.0);
+        d_localSum.assign(Quality_Num, 0.0);
+        d_localCount.assign(Quality_Num, 0.0);
+        d_localMin.assign(Quality_Num, 0.0);
+        d_localMax.assign(Quality_Num, 0.0);
+        d_localInvalid = 0.0;
+
+        d_globalHistogram.assign(Quality_Num*d_numBin, 0.0);
+        d_min.assign(Quality_Num, 0.0);
+        d_max.assign(Quality_Num, 0.0);
+        d_sum.assign(Quality_Num, 0.0);
+        d_count.assign(Quality_Num, 0.0);
+        d_numInvalid = 0.0;
+    }
+
+    GeomMeshQuality::~GeomMeshQuality()
+    {
+    }
+
+    void GeomMeshQuality::SetElements(unsigned long val_numPoint, const bool* val_pointOwned, unsigned long val_numElem, const unsigned short* val_vtkType,
+                                      const unsigned long* val_elemPtr, const unsigned long* val_elemNode, const bool* val_elemOwned)
+    {
+        unsigned long iPoint, iElem, iNode;
+
+        d_numPoint = val_numPoint;
+        d_vtkType.assign(val_vtkType, val_vtkType + val_numElem);
+        d_elemPtr.assign(val_elemPtr, val_elemPtr + val_numElem + 1);
+        d_elemNode.assign(val_elemNode, val_elemNode + val_elemPtr[val_numElem]);
+        d_pointOwned.assign(val_numPoint, true);
+        d_elemOwned.assign(val_numElem, true);
+        if (val_pointOwned != NULL) d_pointOwned.assign(val_pointOwned, val_pointOwned + val_numPoint);
+        if (val_elemOwned != NULL) d_elemOwned.assign(val_elemOwned, val_elemOwned + val_numElem);
+
+        /*--- Elements around the points (count, then fill) ---*/
+        d_pointElemPtr.assign(val_numPoint + 1, 0);
+        for (iNode = 0; iNode < d_elemNode.size(); iNode++) d_pointElemPtr[d_elemNode[iNode] + 1]++;
+        for (iPoint = 0; iPoint < val_numPoint; iPoint++) d_pointElemPtr[iPoint + 1] += d_pointElemPtr[iPoint];
+        d_pointElem.resize(d_elemNode.size());
+        vector<unsigned long> fill(d_pointElemPtr.begin(), d_pointElemPtr.end() - 1);
+        for (iElem = 0; iElem < val_numElem; iElem++)
+            for (iNode = d_elemPtr[iElem]; iNode < d_elemPtr[iElem + 1]; iNode++)
+                d_pointElem[fill[d_elemNode[iNode]]++] = iElem;
+
+        d_skewness.assign(val_numElem, 0.0);
+        d_aspectRatio.assign(val_numElem, 1.0);
+        d_elemVolume.assign(val_numElem, 0.0);
+        d_elemInvalid.assign(val_numElem, false);
+        d_volumeRatio.assign(val_numPoint, 1.0);
+        d_pointInvalid.assign(val_numPoint, false);
+
+        d_localHistogram.assign(Quality_Num*d_numBin, 0.0);
+        d_localSum.assign(Quality_Num, 0.0);
+        d_localCount.assign(Quality_Num, 0.0);
+        d_localInvalid = 0.0;
+        d_coord.clear();
+        d_elemValid = false;
+        d_edgeValid = false;
+    }
+
+    void GeomMeshQuality::SetEdges(unsigned long val_numEdge, const unsigned long* val_edgeNode, const bool* val_isOwned)
+    {
+        unsigned long iPoint, iEdge;
+        unsigned short iNode, iType;
+
+        d_edgeNode.assign(val_edgeNode, val_edgeNode + 2*val_numEdge);
+        d_edgeOwned.assign(val_numEdge, true);
+        if (val_isOwned != NULL) d_edgeOwned.assign(val_isOwned, val_isOwned + val_numEdge);
+
+        d_pointEdgePtr.assign(d_numPoint + 1, 0);
+        for (iEdge = 0; iEdge < 2*val_numEdge; iEdge++) d_pointEdgePtr[d_edgeNode[iEdge] + 1]++;
+        for (iPoint = 0; iPoint < d_numPoint; iPoint++) d_pointEdgePtr[iPoint + 1] += d_pointEdgePtr[iPoint];
+        d_pointEdge.resize(2*val_numEdge);
+        vector<unsigned long> fill(d_pointEdgePtr.begin(), d_pointEdgePtr.end() - 1);
+        for (iEdge = 0; iEdge < val_numEdge; iEdge++)
+            for (iNode = 0; iNode < 2; iNode++)
+                d_pointEdge[fill[d_edgeNode[2*iEdge + iNode]]++] = iEdge;
+
+        /*--- Forget the contribution of the previous dual grid ---*/
+        for (iType = Quality_Orthogonality; iType <= Quality_DualVolumeRatio; iType++)
+        {
+            for (unsigned short iBin = 0; iBin < d_numBin; iBin++) d_localHistogram[iType*d_numBin + iBin] = 0.0;
+            d_localSum[iType] = 0.0;
+            d_localCount[iType] = 0.0;
+        }
+        for (iPoint = 0; iPoint < d_pointInvalid.size(); iPoint++)
+            if (d_pointInvalid[iPoint] && d_pointOwned[iPoint]) d_localInvalid -= 1.0;
+        d_pointInvalid.assign(d_numPoint, false);
+
+        d_orthogonality.assign(val_numEdge, 0.0);
+        d_dualVolumeRatio.assign(val_numEdge, 1.0);
+        d_edgeNormal.assign(d_numDim*val_numEdge, 0.0);
+        d_dualVolume.assign(d_numPoint, 0.0);
+        d_edgeValid = false;
+    }
+
+    void GeomMeshQuality::SetDualGrid(const double* val_edgeNormal, const double* val_volume)
+    {
+        copy(val_edgeNormal, val_edgeNormal + d_edgeNormal.size(), d_edgeNormal.begin());
+        copy(val_volume, val_volume + d_dualVolume.size(), d_dualVolume.begin());
+    }
+
+    double GeomMeshQuality::GetBinBound(QualityType val_type, unsigned short val_iBin) const
+    {
+        double fraction = double(val_iBin) / double(d_numBin);
+        switch (val_type)
+        {
+        case Quality_Skewness:      return fraction;
+        case Quality_Orthogonality: return 90.0*fraction;
+        default:                    return pow(10.0, 3.0*fraction);
+        }
+    }
+
+    unsigned short GeomMeshQuality::GetBin(QualityType val_type, double val_value) const
+    {
+        double fraction;
+        switch (val_type)
+        {
+        case Quality_Skewness:      fraction = val_value; break;
+        case Quality_Orthogonality: fraction = val_value / 90.0; break;
+        default:                    fraction = log10(max(val_value, 1.0)) / 3.0; break;
+        }
+        long iBin = long(fraction*d_numBin);
+        return (unsigned short)min(max(iBin, 0L), long(d_numBin - 1));
+    }
+
+    void GeomMeshQuality::SetValue(QualityType val_type, double val_old, double val_new, bool val_isNew)
+    {
+        if (!val_isNew)
+        {
+            d_localHistogram[val_type*d_numBin + GetBin(val_type, val_old)] -= 1.0;
+            d_localSum[val_type] -= val_old;
+            d_localCount[val_type] -= 1.0;
+        }
+        d_localHistogram[val_type*d_numBin + GetBin(val_type, val_new)] += 1.0;
+        d_localSum[val_type] += val_new;
+        d_localCount[val_type] += 1.0;
+    }
+
+    void GeomMeshQuality::SetMinMax()
+    {
+        unsigned long iEntity;
+        const double big = numeric_limits<double>::max();
+
+        d_localMin.assign(Quality_Num, big);
+        d_localMax.assign(Quality_Num, -big);
+
+        for (iEntity = 0; iEntity < d_skewness.size(); iEntity++)
+        {
+            if (!d_elemOwned[iEntity]) continue;
+            d_localMin[Quality_Skewness] = min(d_localMin[Quality_Skewness], d_skewness[iEntity]);
+            d_localMax[Quality_Skewness] = max(d_localMax[Quality_Skewness], d_skewness[iEntity]);
+            d_localMin[Quality_AspectRatio] = min(d_localMin[Quality_AspectRatio], d_aspectRatio[iEntity]);
+            d_localMax[Quality_AspectRatio] = max(d_localMax[Quality_AspectRatio], d_aspectRatio[iEntity]);
+        }
+        for (iEntity = 0; iEntity < d_volumeRatio.size(); iEntity++)
+        {
+            if (!d_pointOwned[iEntity]) continue;
+            d_localMin[Quality_VolumeRatio] = min(d_localMin[Quality_VolumeRatio], d_volumeRatio[iEntity]);
+            d_localMax[Quality_VolumeRatio] = max(d_localMax[Quality_VolumeRatio], d_volumeRatio[iEntity]);
+        }
+        if (d_edgeValid)
+        {
+            for (iEntity = 0; iEntity < d_orthogonality.size(); iEntity++)
+            {
+                if (!d_edgeOwned[iEntity]) continue;
+                d_localMin[Quality_Orthogonality] = min(d_localMin[Quality_Orthogonality], d_orthogonality[iEntity]);
+                d_localMax[Quality_Orthogonality] = max(d_localMax[Quality_Orthogonality], d_orthogonality[iEntity]);
+                d_localMin[Quality_DualVolumeRatio] = min(d_localMin[Quality_DualVolumeRatio], d_dualVolumeRatio[iEntity]);
+                d_localMax[Quality_DualVolumeRatio] = max(d_localMax[Quality_DualVolumeRatio], d_dualVolumeRatio[iEntity]);
+            }
+        }
+    }
+
+    void GeomMeshQuality::ComputeElement(unsigned long val_iElem, const double* val_coord, double& val_skewness, double& val_aspectRatio, double& val_volume, bool& val_isInverted) const
+    {
+        unsigned short iDim, iNode, iEdge, iFace, nEdge = 0, nFace = 0;
+        const unsigned short (*edge)[2] = NULL;
+        const unsigned short (*face)[4] = NULL;
+        const unsigned short* faceSize = NULL;
+        static const unsigned short Quality_PlaneFace[1][4] = { {0,1,2,3} };
+        unsigned short planeFaceSize[1];
+
+        const unsigned long* elemNode = &d_elemNode[d_elemPtr[val_iElem]];
+        unsigned short nNode = (unsigned short)(d_elemPtr[val_iElem + 1] - d_elemPtr[val_iElem]);
+        bool isVolume = false;
+
+        switch (d_vtkType[val_iElem])
+        {
+        case TRIANGLE:    edge = Quality_TriaEdge; nEdge = 3; face = Quality_PlaneFace; nFace = 1; planeFaceSize[0] = 3; faceSize = planeFaceSize; break;
+        case RECTANGLE:   edge = Quality_QuadEdge; nEdge = 4; face = Quality_PlaneFace; nFace = 1; planeFaceSize[0] = 4; faceSize = planeFaceSize; break;
+        case TETRAHEDRON: edge = Quality_TetrEdge; nEdge = 6; face = Quality_TetrFace; nFace = 4; faceSize = Quality_TetrFaceSize; isVolume = true; break;
+        case HEXAHEDRON:  edge = Quality_HexaEdge; nEdge = 12; face = Quality_HexaFace; nFace = 6; faceSize = Quality_HexaFaceSize; isVolume = true; break;
+        case PRISM:       edge = Quality_PrisEdge; nEdge = 9; face = Quality_PrisFace; nFace = 5; faceSize = Quality_PrisFaceSize; isVolume = true; break;
+        case PYRAMID:     edge = Quality_PyraEdge; nEdge = 8; face = Quality_PyraFace; nFace = 5; faceSize = Quality_PyraFaceSize; isVolume = true; break;
+        default:
+            val_skewness = 0.0; val_aspectRatio = 1.0; val_volume = 0.0; val_isInverted = false;
+            if (nNode == 2)
+                for (iDim = 0; iDim < d_numDim; iDim++)
+                    val_volume += pow(val_coord[elemNode[1]*d_numDim + iDim] - val_coord[elemNode[0]*d_numDim + iDim], 2.0);
+            val_volume = sqrt(val_volume);
+            return;
+        }
+
+        /*--- Aspect ratio: longest over shortest edge ---*/
+        double minLength = numeric_limits<double>::max(), maxLength = 0.0;
+        for (iEdge = 0; iEdge < nEdge; iEdge++)
+        {
+            double length2 = 0.0;
+            for (iDim = 0; iDim < d_numDim; iDim++)
+            {
+                double delta = val_coord[elemNode[edge[iEdge][1]]*d_numDim + iDim] - val_coord[elemNode[edge[iEdge][0]]*d_numDim + iDim];
+                length2 += delta*delta;
+            }
+            minLength = min(minLength, length2);
+            maxLength = max(maxLength, length2);
+        }
+        val_aspectRatio = (minLength > 0.0) ? min(sqrt(maxLength / minLength), Quality_MaxRatio) : Quality_MaxRatio;
+
+        /*--- Element centroid ---*/
+        double center[3] = { 0.0, 0.0, 0.0 };
+        for (iNode = 0; iNode < nNode; iNode++)
+            for (iDim = 0; iDim < d_numDim; iDim++) center[iDim] += val_coord[elemNode[iNode]*d_numDim + iDim] / double(nNode);
+
+        /*--- Equiangle skewness of every face, and signed volume of the pyramids (or triangles) from the centroid;
+              the element is inverted as soon as one of them is not positive ---*/
+        val_skewness = 0.0;
+        val_volume = 0.0;
+        val_isInverted = false;
+        for (iFace = 0; iFace < nFace; iFace++)
+        {
+            unsigned short nCorner = faceSize[iFace];
+            double idealAngle = 180.0*double(nCorner - 2) / double(nCorner);
+            double faceCenter[3] = { 0.0, 0.0, 0.0 };
+            for (iNode = 0; iNode < nCorner; iNode++)
+                for (iDim = 0; iDim < d_numDim; iDim++) faceCenter[iDim] += val_coord[elemNode[face[iFace][iNode]]*d_numDim + iDim] / double(nCorner);
+
+            for (iNode = 0; iNode < nCorner; iNode++)
+            {
+                const double* prev = &val_coord[elemNode[face[iFace][(iNode + nCorner - 1) % nCorner]]*d_numDim];
+                const double* curr = &val_coord[elemNode[face[iFace][iNode]]*d_numDim];
+                const double* next = &val_coord[elemNode[face[iFace][(iNode + 1) % nCorner]]*d_numDim];
+
+                double u[3] = { 0.0, 0.0, 0.0 }, v[3] = { 0.0, 0.0, 0.0 }, w[3] = { 0.0, 0.0, 0.0 };
+                double uu = 0.0, vv = 0.0, uv = 0.0;
+                for (iDim = 0; iDim < d_numDim; iDim++)
+                {
+                    u[iDim] = prev[iDim] - curr[iDim];
+                    v[iDim] = next[iDim] - curr[iDim];
+                    uu += u[iDim]*u[iDim]; vv += v[iDim]*v[iDim]; uv += u[iDim]*v[iDim];
+                }
+                if (uu > 0.0 && vv > 0.0)
+                {
+                    double angle = acos(max(-1.0, min(1.0, uv / sqrt(uu*vv))))*Quality_Degree;
+                    val_skewness = max(val_skewness, max((angle - idealAngle) / (180.0 - idealAngle), (idealAngle - angle) / idealAngle));
+                }
+                else val_skewness = 1.0;
+
+                /*--- Triangle (center, curr, next) of the fan of the face ---*/
+                const double* base = isVolume ? faceCenter : center;
+                for (iDim = 0; iDim < d_numDim; iDim++)
+                {
+                    u[iDim] = curr[iDim] - base[iDim];
+                    v[iDim] = next[iDim] - base[iDim];
+                    w[iDim] = base[iDim] - center[iDim];
+                }
+                double cross[3] = { u[1]*v[2] - u[2]*v[1], u[2]*v[0] - u[0]*v[2], u[0]*v[1] - u[1]*v[0] };
+                double subVolume;
+                if (isVolume) subVolume = (cross[0]*w[0] + cross[1]*w[1] + cross[2]*w[2]) / 6.0;
+                else if (d_numDim == 2) subVolume = 0.5*cross[2];
+                else subVolume = 0.5*sqrt(cross[0]*cross[0] + cross[1]*cross[1] + cross[2]*cross[2]);
+                if (subVolume <= 0.0) val_isInverted = true;
+                val_volume += subVolume;
+            }
+        }
+        val_skewness = min(val_skewness, 1.0);
+    }
+
+    void GeomMeshQuality::ComputeEdge(unsigned long val_iEdge, const double* val_coord, double& val_orthogonality, double& val_volumeRatio) const
+    {
+        unsigned long iPoint = d_edgeNode[2*val_iEdge], jPoint = d_edgeNode[2*val_iEdge + 1];
+        const double* normal = &d_edgeNormal[val_iEdge*d_numDim];
+        double ee = 0.0, nn = 0.0, en = 0.0;
+
+        for (unsigned short iDim = 0; iDim < d_numDim; iDim++)
+        {
+            double delta = val_coord[jPoint*d_numDim + iDim] - val_coord[iPoint*d_numDim + iDim];
+            ee += delta*delta; nn += normal[iDim]*normal[iDim]; en += delta*normal[iDim];
+        }
+        val_orthogonality = (ee > 0.0 && nn > 0.0) ? acos(min(1.0, fabs(en) / sqrt(ee*nn)))*Quality_Degree : 90.0;
+
+        double volMin = min(d_dualVolume[iPoint], d_dualVolume[jPoint]), volMax = max(d_dualVolume[iPoint], d_dualVolume[jPoint]);
+        val_volumeRatio = (volMin > 0.0) ? min(volMax / volMin, Quality_MaxRatio) : Quality_MaxRatio;
+    }
+
+    unsigned long GeomMeshQuality::Update(const double* val_coord)
+    {
+        unsigned long iPoint, iElem, iEdge, iNode, nMoved = 0;
+        long iDirty;
+        unsigned short iDim, iType;
+
+        /*--- Points that moved since the previous update ---*/
+        bool allMoved = d_coord.empty();
+        vector<char> moved(d_numPoint, allMoved ? 1 : 0);
+        if (!allMoved)
+        {
+            for (iPoint = 0; iPoint < d_numPoint; iPoint++)
+                for (iDim = 0; iDim < d_numDim; iDim++)
+                    if (val_coord[iPoint*d_numDim + iDim] != d_coord[iPoint*d_numDim + iDim]) { moved[iPoint] = 1; break; }
+        }
+        for (iPoint = 0; iPoint < d_numPoint; iPoint++) nMoved += moved[iPoint];
+        d_coord.assign(val_coord, val_coord + d_numPoint*d_numDim);
+
+        /*--- Elements that touch a moved point ---*/
+        vector<unsigned long> dirtyElem;
+        if (!d_elemValid)
+        {
+            dirtyElem.resize(d_vtkType.size());
+            for (iElem = 0; iElem < d_vtkType.size(); iElem++) dirtyElem[iElem] = iElem;
+        }
+        else
+        {
+            vector<char> isDirty(d_vtkType.size(), 0);
+            for (iPoint = 0; iPoint < d_numPoint; iPoint++)
+                if (moved[iPoint])
+                    for (iNode = d_pointElemPtr[iPoint]; iNode < d_pointElemPtr[iPoint + 1]; iNode++) isDirty[d_pointElem[iNode]] = 1;
+            for (iElem = 0; iElem < d_vtkType.size(); iElem++)
+                if (isDirty[iElem]) dirtyElem.push_back(iElem);
+        }
+
+        vector<double> skewness(dirtyElem.size()), aspectRatio(dirtyElem.size()), volume(dirtyElem.size());
+        vector<char> inverted(dirtyElem.size(), 0);
+
+#pragma omp parallel for schedule(dynamic, 256)
+        for (iDirty = 0; iDirty < (long)dirtyElem.size(); iDirty++)
+        {
+            bool isInverted;
+            ComputeElement(dirtyElem[iDirty], val_coord, skewness[iDirty], aspectRatio[iDirty], volume[iDirty], isInverted);
+            inverted[iDirty] = isInverted ? 1 : 0;
+        }
+
+        vector<char> touched(d_numPoint, 0);
+        for (iDirty = 0; iDirty < (long)dirtyElem.size(); iDirty++)
+        {
+            iElem = dirtyElem[iDirty];
+            if (d_elemOwned[iElem])
+            {
+                SetValue(Quality_Skewness, d_skewness[iElem], skewness[iDirty], !d_elemValid);
+                SetValue(Quality_AspectRatio, d_aspectRatio[iElem], aspectRatio[iDirty], !d_elemValid);
+                if (d_elemValid && d_elemInvalid[iElem]) d_localInvalid -= 1.0;
+                if (inverted[iDirty]) d_localInvalid += 1.0;
+            }
+            d_skewness[iElem] = skewness[iDirty];
+            d_aspectRatio[iElem] = aspectRatio[iDirty];
+            d_elemVolume[iElem] = volume[iDirty];
+            d_elemInvalid[iElem] = (inverted[iDirty] != 0);
+            for (iNode = d_elemPtr[iElem]; iNode < d_elemPtr[iElem + 1]; iNode++) touched[d_elemNode[iNode]] = 1;
+        }
+
+        /*--- Element volume ratio around the points of the recomputed elements ---*/
+        vector<unsigned long> dirtyPoint;
+        for (iPoint = 0; iPoint < d_numPoint; iPoint++)
+            if (touched[iPoint] || !d_elemValid) dirtyPoint.push_back(iPoint);
+
+        vector<double> volumeRatio(dirtyPoint.size());
+
+#pragma omp parallel for schedule(static)
+        for (iDirty = 0; iDirty < (long)dirtyPoint.size(); iDirty++)
+        {
+            unsigned long jPoint = dirtyPoint[iDirty], jElem;
+            double volMin = numeric_limits<double>::max(), volMax = 0.0;
+            for (jElem = d_pointElemPtr[jPoint]; jElem < d_pointElemPtr[jPoint + 1]; jElem++)
+            {
+                volMin = min(volMin, d_elemVolume[d_pointElem[jElem]]);
+                volMax = max(volMax, d_elemVolume[d_pointElem[jElem]]);
+            }
+            if (volMax == 0.0 && volMin > 0.0) volumeRatio[iDirty] = 1.0;
+            else volumeRatio[iDirty] = (volMin > 0.0) ? min(volMax / volMin, Quality_MaxRatio) : Quality_MaxRatio;
+        }
+
+        for (iDirty = 0; iDirty < (long)dirtyPoint.size(); iDirty++)
+        {
+            iPoint = dirtyPoint[iDirty];
+            if (d_pointOwned[iPoint]) SetValue(Quality_VolumeRatio, d_volumeRatio[iPoint], volumeRatio[iDirty], !d_elemValid);
+            d_volumeRatio[iPoint] = volumeRatio[iDirty];
+        }
+        d_elemValid = true;
+
+        /*--- Dual grid metrics: a moved node changes the dual faces and control volumes of every point of its
+              elements, so the edges and control volumes around the points of the recomputed elements are refreshed ---*/
+        if (!d_orthogonality.empty())
+        {
+            vector<unsigned long> dirtyEdge;
+            if (!d_edgeValid)
+            {
+                dirtyEdge.resize(d_orthogonality.size());
+                for (iEdge = 0; iEdge < d_orthogonality.size(); iEdge++) dirtyEdge[iEdge] = iEdge;
+            }
+            else
+            {
+                vector<char> isDirty(d_orthogonality.size(), 0);
+                for (iPoint = 0; iPoint < d_numPoint; iPoint++)
+                    if (touched[iPoint])
+                        for (iNode = d_pointEdgePtr[iPoint]; iNode < d_pointEdgePtr[iPoint + 1]; iNode++) isDirty[d_pointEdge[iNode]] = 1;
+                for (iEdge = 0; iEdge < d_orthogonality.size(); iEdge++)
+                    if (isDirty[iEdge]) dirtyEdge.push_back(iEdge);
+            }
+
+            vector<double> orthogonality(dirtyEdge.size()), dualVolumeRatio(dirtyEdge.size());
+
+#pragma omp parallel for schedule(static)
+            for (iDirty = 0; iDirty < (long)dirtyEdge.size(); iDirty++)
+                ComputeEdge(dirtyEdge[iDirty], val_coord, orthogonality[iDirty], dualVolumeRatio[iDirty]);
+
+            for (iDirty = 0; iDirty < (long)dirtyEdge.size(); iDirty++)
+            {
+                iEdge = dirtyEdge[iDirty];
+                if (d_edgeOwned[iEdge])
+                {
+                    SetValue(Quality_Orthogonality, d_orthogonality[iEdge], orthogonality[iDirty], !d_edgeValid);
+                    SetValue(Quality_DualVolumeRatio, d_dualVolumeRatio[iEdge], dualVolumeRatio[iDirty], !d_edgeValid);
+                }
+                d_orthogonality[iEdge] = orthogonality[iDirty];
+                d_dualVolumeRatio[iEdge] = dualVolumeRatio[iDirty];
+            }
+
+            for (iPoint = 0; iPoint < d_numPoint; iPoint++)
+            {
+                if (!touched[iPoint] && d_edgeValid) continue;
+                bool invalid = (d_dualVolume[iPoint] <= 0.0);
+                if (d_pointOwned[iPoint] && invalid != d_pointInvalid[iPoint]) d_localInvalid += invalid ? 1.0 : -1.0;
+                d_pointInvalid[iPoint] = invalid;
+            }
+            d_edgeValid = true;
+        }
+
+        SetMinMax();
+
+        /*--- Reduction over all ranks ---*/
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        unsigned long nHistogram = d_localHistogram.size();
+        vector<double> localSum(nHistogram + 2*Quality_Num + 1), globalSum(localSum.size());
+        copy(d_localHistogram.begin(), d_localHistogram.end(), localSum.begin());
+        copy(d_localSum.begin(), d_localSum.end(), localSum.begin() + nHistogram);
+        copy(d_localCount.begin(), d_localCount.end(), localSum.begin() + nHistogram + Quality_Num);
+        localSum[nHistogram + 2*Quality_Num] = d_localInvalid;
+
+        vector<double> localMax(2*Quality_Num), globalMax(2*Quality_Num);
+        for (iType = 0; iType < Quality_Num; iType++)
+        {
+            localMax[iType] = -d_localMin[iType];
+            localMax[Quality_Num + iType] = d_localMax[iType];
+        }
+
+        if (mpi.GetSize() > 1)
+        {
+            mpi.Allreduce(&localSum[0], &globalSum[0], (int)localSum.size(), MPI_DOUBLE, MPI_SUM);
+            mpi.Allreduce(&localMax[0], &globalMax[0], (int)localMax.size(), MPI_DOUBLE, MPI_MAX);
+        }
+        else
+        {
+            globalSum = localSum;
+            globalMax = localMax;
+        }
+
+        copy(globalSum.begin(), globalSum.begin() + nHistogram, d_globalHistogram.begin());
+        copy(globalSum.begin() + nHistogram, globalSum.begin() + nHistogram + Quality_Num, d_sum.begin());
+        copy(globalSum.begin() + nHistogram + Quality_Num, globalSum.begin() + nHistogram + 2*Quality_Num, d_count.begin());
+        d_numInvalid = globalSum[nHistogram + 2*Quality_Num];
+        for (iType = 0; iType < Quality_Num; iType++)
+        {
+            d_min[iType] = (d_count[iType] > 0.0) ? -globalMax[iType] : 0.0;
+            d_max[iType] = (d_count[iType] > 0.0) ? globalMax[Quality_Num + iType] : 0.0;
+        }
+
+        return nMoved;
+    }
+
+    void GeomMeshQuality::Print(ostream& val_out) const
+    {
+        static const char* name[Quality_Num] = { "Skewness", "Aspect ratio", "Volume ratio", "Orthogonality (deg)", "Dual volume ratio" };
+        unsigned short iType, iBin;
+
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        if (mpi.GetSize() > 1 && mpi.GetRank() != MASTER_NODE) return;
+
+        for (iType = 0; iType < Quality_Num; iType++)
+        {
+            if (d_count[iType] == 0.0) continue;
+
+            QualityType type = (QualityType)iType;
+            val_out << name[iType] << ": min " << d_min[iType] << ", mean " << GetMean(type) << ", max " << d_max[iType] << endl;
+            for (iBin = 0; iBin < d_numBin; iBin++)
+            {
+                val_out << "   " << setw(12) << GetBinBound(type, iBin);
+                if (iBin + 1 < d_numBin) val_out << " - " << setw(12) << GetBinBound(type, iBin + 1);
+                else val_out << " -             ";
+                val_out << " : " << setw(12) << (unsigned long)GetHistogram(type, iBin) << endl;
+            }
+        }
+        if (d_numInvalid > 0.0)
+            val_out << "Degenerate elements and non-positive control volumes: " << (unsigned long)d_numInvalid << endl;
+    }
+}
@@ -0,0 +1,176 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Mesh quality metrics with histograms, updated incrementally
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMMESHQUALITY_HPP
+#define ARIES_GEOMMESHQUALITY_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Quality of the primal and dual grids, reduced over all ranks into histograms.
+     *
+     * Element metrics (equiangle skewness, edge aspect ratio and the volume
+     * ratio between the elements around a point) and dual grid metrics (angle
+     * between an edge and its dual face normal, volume ratio between the two
+     * control volumes of an edge, non-positive control volumes) are computed
+     * in parallel loops and kept per entity. Update compares the coordinates
+     * with the ones of the previous call and only recomputes the elements that
+     * touch a point that moved, and the points and edges of those elements
+     * (whose control volumes and dual faces the move changes), adjusting the
+     * local histograms on the way, so monitoring a deforming mesh every step
+     * costs little more than the reduction of the histograms. An element is
+     * invalid when one of the signed sub-volumes from its centroid is not
+     * positive, which catches inverted and folded elements alike.
+     */
+    class GeomMeshQuality
+    {
+    public:
+        typedef enum
+        {
+            Quality_Skewness = 0,           /*!< \brief Equiangle skewness of the elements, 0 (ideal) to 1. */
+            Quality_AspectRatio = 1,        /*!< \brief Longest over shortest edge of the elements. */
+            Quality_VolumeRatio = 2,        /*!< \brief Largest over smallest element volume around a point. */
+            Quality_Orthogonality = 3,      /*!< \brief Angle between an edge and its dual face normal (degrees). */
+            Quality_DualVolumeRatio = 4,    /*!< \brief Largest over smallest control volume of an edge. */
+            Quality_Num = 5
+        } QualityType;
+
+        /*!
+         * \param[in] val_numDim - Number of dimensions of the problem.
+         * \param[in] val_numBin - Number of bins of the histograms.
+         */
+        GeomMeshQuality(unsigned short val_numDim, unsigned short val_numBin = 10);
+        ~GeomMeshQuality();
+
+        /*!
+         * \brief Set the elements (copied); the cached metrics are discarded.
+         * \param[in] val_numPoint - Number of local points.
+         * \param[in] val_pointOwned - Whether a point is counted by this rank (NULL for all).
+         * \param[in] val_numElem - Number of local elements.
+         * \param[in] val_vtkType - VTK type of every element.
+         * \param[in] val_elemPtr - CSR offsets of the element nodes (size val_numElem+1).
+         * \param[in] val_elemNode - Nodes of the elements.
+         * \param[in] val_elemOwned - Whether an element is counted by this rank (NULL for all).
+         */
+        void SetElements(unsigned long val_numPoint, const bool* val_pointOwned, unsigned long val_numElem, const unsigned short* val_vtkType,
+                         const unsigned long* val_elemPtr, const unsigned long* val_elemNode, const bool* val_elemOwned = NULL);
+
+        /*!
+         * \brief Set the edges of the dual grid (copied); the cached dual metrics are discarded.
+         * \param[in] val_numEdge - Number of local edges.
+         * \param[in] val_edgeNode - Nodes of the edges, <i>[iEdge*2+iNode]</i>.
+         * \param[in] val_isOwned - Whether an edge is counted by this rank (NULL for all).
+         */
+        void SetEdges(unsigned long val_numEdge, const unsigned long* val_edgeNode, const bool* val_isOwned = NULL);
+
+        /*!
+         * \brief Refresh the dual grid data, to be called before Update once the control volumes are recomputed.
+         * \param[in] val_edgeNormal - Dual face normal of every edge, <i>[iEdge*nDim+iDim]</i>.
+         * \param[in] val_volume - Control volume of every point.
+         */
+        void SetDualGrid(const double* val_edgeNormal, const double* val_volume);
+
+        /*!
+         * \brief Recompute the metrics that depend on points that moved and reduce the histograms (collective).
+         * \param[in] val_coord - Coordinates of the local points, <i>[iPoint*nDim+iDim]</i>.
+         * \return Number of local points that moved since the previous call.
+         */
+        unsigned long Update(const double* val_coord);
+
+        unsigned long GetNumEdge() const { return d_edgeNode.size() / 2; };
+        unsigned short GetNumBin() const { return d_numBin; };
+        double GetMin(QualityType val_type) const { return d_min[val_type]; };
+        double GetMax(QualityType val_type) const { return d_max[val_type]; };
+        double GetMean(QualityType val_type) const { return (d_count[val_type] > 0.0) ? d_sum[val_type] / d_count[val_type] : 0.0; };
+
+        /*!
+         * \brief Global number of entities in a bin of a histogram.
+         */
+        double GetHistogram(QualityType val_type, unsigned short val_iBin) const { return d_globalHistogram[val_type*d_numBin + val_iBin]; };
+
+        /*!
+         * \brief Lower bound of a bin of a histogram (the last bin is open).
+         */
+        double GetBinBound(QualityType val_type, unsigned short val_iBin) const;
+
+        /*!
+         * \brief Global number of inverted elements and non-positive control volumes.
+         */
+        double GetNumInvalid() const { return d_numInvalid; };
+
+        /*!
+         * \brief Write the histograms (master rank only).
+         */
+        void Print(ostream& val_out) const;
+
+    private:
+        void ComputeElement(unsigned long val_iElem, const double* val_coord, double& val_skewness, double& val_aspectRatio, double& val_volume, bool& val_isInverted) const;
+        void ComputeEdge(unsigned long val_iEdge, const double* val_coord, double& val_orthogonality, double& val_volumeRatio) const;
+        unsigned short GetBin(QualityType val_type, double val_value) const;
+        void SetValue(QualityType val_type, double val_old, double val_new, bool val_isNew);
+        void SetMinMax();
+
+        unsigned short d_numDim;                    /*!< \brief Number of dimensions of the problem. */
+        unsigned short d_numBin;                    /*!< \brief Number of bins of the histograms. */
+        unsigned long d_numPoint;                   /*!< \brief Number of local points. */
+
+        vector<unsigned short> d_vtkType;           /*!< \brief VTK type of the elements. */
+        vector<unsigned long> d_elemPtr;            /*!< \brief CSR offsets of the element nodes. */
+        vector<unsigned long> d_elemNode;           /*!< \brief Nodes of the elements. */
+        vector<bool> d_pointOwned;                  /*!< \brief Points counted by this rank. */
+        vector<bool> d_elemOwned;                   /*!< \brief Elements counted by this rank. */
+        vector<unsigned long> d_pointElemPtr;       /*!< \brief CSR offsets of the elements around the points. */
+        vector<unsigned long> d_pointElem;          /*!< \brief Elements around the points. */
+        vector<unsigned long> d_pointEdgePtr;       /*!< \brief CSR offsets of the edges around the points. */
+        vector<unsigned long> d_pointEdge;          /*!< \brief Edges around the points. */
+
+        vector<unsigned long> d_edgeNode;           /*!< \brief Nodes of the edges. */
+        vector<bool> d_edgeOwned;                   /*!< \brief Edges counted by this rank. */
+        vector<double> d_edgeNormal;                /*!< \brief Dual face normals. */
+        vector<double> d_dualVolume;                /*!< \brief Control volumes. */
+
+        vector<double> d_coord;                     /*!< \brief Coordinates of the previous update. */
+        vector<double> d_skewness;                  /*!< \brief Cached skewness of the elements. */
+        vector<double> d_aspectRatio;               /*!< \brief Cached aspect ratio of the elements. */
+        vector<double> d_elemVolume;                /*!< \brief Cached signed volume of the elements. */
+        vector<bool> d_elemInvalid;                 /*!< \brief Cached inverted elements (a non-positive sub-volume). */
+        vector<double> d_volumeRatio;               /*!< \brief Cached element volume ratio around the points. */
+        vector<double> d_orthogonality;             /*!< \brief Cached orthogonality of the edges. */
+        vector<double> d_dualVolumeRatio;           /*!< \brief Cached control volume ratio of the edges. */
+        vector<bool> d_pointInvalid;                /*!< \brief Cached non-positive control volumes. */
+        bool d_elemValid;                           /*!< \brief Whether the element metrics are cached. */
+        bool d_edgeValid;                           /*!< \brief Whether the dual metrics are cached. */
+
+        vector<double> d_localHistogram;            /*!< \brief Histograms of the local entities. */
+        vector<double> d_localSum;                  /*!< \brief Sum of the local values of every metric. */
+        vector<double> d_localCount;                /*!< \brief Number of local values of every metric. */
+        vector<double> d_localMin, d_localMax;      /*!< \brief Local extrema of every metric. */
+        double d_localInvalid;                      /*!< \brief Local non-positive volumes. */
+
+        vector<double> d_globalHistogram;           /*!< \brief Histograms over all ranks. */
+        vector<double> d_min, d_max, d_sum, d_count;   /*!< \brief Global extrema, sum and count of every metric. */
+        double d_numInvalid;                        /*!< \brief Global non-positive volumes. */
+    };
+}
+
+#endif
@@ -0,0 +1,324 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Built-in geometric partitioner (weighted recursive coordinate bisection)
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomPartitioner.hpp"
+
+#include "AriesMPI.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ARIES
+{
+    GeomPartitioner::GeomPartitioner(unsigned short val_numDim, unsigned long val_numPart, bool val_isDistributed, unsigned short val_numConstraint)
+    {
+        d_numDim = val_numDim;
+        d_numPart = (val_numPart > 0) ? val_numPart : 1;
+        d_numConstraint = (val_numConstraint > 0) ? val_numConstraint : 1;
+        d_isDistributed = val_isDistributed;
+
+        d_maxBisectIter = 60;
+        d_cutTolerance = 1.0E-3;
+
+        d_edgeCut = 0;
+        d_imbalance.assign(d_numConstraint, 1.0);
+        d_partWeight.assign(d_numPart*d_numConstraint, 0.0);
+    }
+
+    GeomPartitioner::~GeomPartitioner()
+    {
+    }
+
+    bool GeomPartitioner::IsParallel()
+    {
+        return d_isDistributed && AriesMPI::GetAriesWorld().GetSize() > 1;
+    }
+
+    void GeomPartitioner::SumAll(vector<double>& val_buffer)
+    {
+        if (!IsParallel() || val_buffer.empty()) return;
+
+        vector<double> send(val_buffer);
+        AriesMPI::GetAriesWorld().Allreduce(&send[0], &val_buffer[0], (int)send.size(), MPI_DOUBLE, MPI_SUM);
+    }
+
+    void GeomPartitioner::MinAll(vector<double>& val_buffer)
+    {
+        if (!IsParallel() || val_buffer.empty()) return;
+
+        vector<double> send(val_buffer);
+        AriesMPI::GetAriesWorld().Allreduce(&send[0], &val_buffer[0], (int)send.size(), MPI_DOUBLE, MPI_MIN);
+    }
+
+    void GeomPartitioner::MaxAll(vector<double>& val_buffer)
+    {
+        if (!IsParallel() || val_buffer.empty()) return;
+
+        vector<double> send(val_buffer);
+        AriesMPI::GetAriesWorld().Allreduce(&send[0], &val_buffer[0], (int)send.size(), MPI_DOUBLE, MPI_MAX);
+    }
+
+    void GeomPartitioner::Partition(unsigned long val_numLocal, const double* val_coord, const double* val_weight, vector<unsigned long>& val_part)
+    {
+        unsigned long iPoint, iRange, nRange, nLeft;
+        unsigned short iDim, iIter, iCon;
+        const double big = numeric_limits<double>::max();
+
+        /*
+         *  Bisect on a single weight per point: each constraint is normalized by
+         *  its global total so that compute and memory weigh alike.
+         */
+        vector<double> weight(val_numLocal, 1.0);
+        if (val_weight != NULL)
+        {
+            vector<double> conTotal(d_numConstraint, 0.0);
+            for (iPoint = 0; iPoint < val_numLocal; iPoint++)
+                for (iCon = 0; iCon < d_numConstraint; iCon++)
+                    conTotal[iCon] += val_weight[iPoint*d_numConstraint + iCon];
+            SumAll(conTotal);
+
+            for (iPoint = 0; iPoint < val_numLocal; iPoint++)
+            {
+                weight[iPoint] = 0.0;
+                for (iCon = 0; iCon < d_numConstraint; iCon++)
+                    if (conTotal[iCon] > 0.0) weight[iPoint] += val_weight[iPoint*d_numConstraint + iCon] / conTotal[iCon];
+            }
+        }
+
+        /*
+         *  Every range [lo, hi) of part indices is one sub-domain still to be bisected.
+         *  The list of ranges evolves identically on all ranks, so the only data that
+         *  travel are the per-range reductions below.
+         */
+        vector<unsigned long> rangeLo(1, 0), rangeHi(1, d_numPart);
+        vector<unsigned long> pointRange(val_numLocal, 0);
+
+        while (true)
+        {
+            nRange = rangeLo.size();
+
+            bool isSplit = false;
+            for (iRange = 0; iRange < nRange; iRange++)
+                if (rangeHi[iRange] - rangeLo[iRange] > 1) isSplit = true;
+            if (!isSplit) break;
+
+            /*--- Bounding box and total weight of every range ---*/
+            vector<double> boxMin(nRange*d_numDim, big), boxMax(nRange*d_numDim, -big), total(nRange, 0.0);
+            for (iPoint = 0; iPoint < val_numLocal; iPoint++)
+            {
+                iRange = pointRange[iPoint];
+                for (iDim = 0; iDim < d_numDim; iDim++)
+                {
+                    double coord = val_coord[iPoint*d_numDim + iDim];
+                    boxMin[iRange*d_numDim + iDim] = min(boxMin[iRange*d_numDim + iDim], coord);
+                    boxMax[iRange*d_numDim + iDim] = max(boxMax[iRange*d_numDim + iDim], coord);
+                }
+                total[iRange] += weight[iPoint];
+            }
+            MinAll(boxMin);
+            MaxAll(boxMax);
+            SumAll(total);
+
+            /*--- Cut along the longest extent, aiming at the weight of the left child ---*/
+            vector<unsigned short> axis(nRange, 0);
+            vector<double> cutLo(nRange, 0.0), cutHi(nRange, 0.0), cut(nRange, 0.0), target(nRange, 0.0);
+            vector<bool> isDone(nRange, true);
+            for (iRange = 0; iRange < nRange; iRange++)
+            {
+                if (rangeHi[iRange] - rangeLo[iRange] < 2 || total[iRange] <= 0.0) continue;
+
+                double extent = -1.0;
+                for (iDim = 0; iDim < d_numDim; iDim++)
+                {
+                    double delta = boxMax[iRange*d_numDim + iDim] - boxMin[iRange*d_numDim + iDim];
+                    if (delta > extent) { extent = delta; axis[iRange] = iDim; }
+                }
+                cutLo[iRange] = boxMin[iRange*d_numDim + axis[iRange]];
+                cutHi[iRange] = boxMax[iRange*d_numDim + axis[iRange]];
+                cut[iRange] = 0.5*(cutLo[iRange] + cutHi[iRange]);
+
+                nLeft = (rangeHi[iRange] - rangeLo[iRange]) / 2;
+                target[iRange] = total[iRange] * double(nLeft) / double(rangeHi[iRange] - rangeLo[iRange]);
+                isDone[iRange] = false;
+            }
+
+            /*--- Locate all the cuts of this level together by bisection ---*/
+            for (iIter = 0; iIter < d_maxBisectIter; iIter++)
+            {
+                vector<double> left(nRange, 0.0);
+                for (iPoint = 0; iPoint < val_numLocal; iPoint++)
+                {
+                    iRange = pointRange[iPoint];
+                    if (isDone[iRange]) continue;
+                    if (val_coord[iPoint*d_numDim + axis[iRange]] < cut[iRange])
+                        left[iRange] += weight[iPoint];
+                }
+                SumAll(left);
+
+                bool isConverged = true;
+                for (iRange = 0; iRange < nRange; iRange++)
+                {
+                    if (isDone[iRange]) continue;
+                    if (fabs(left[iRange] - target[iRange]) <= d_cutTolerance*total[iRange])
+                    {
+                        isDone[iRange] = true;
+                        continue;
+                    }
+                    if (left[iRange] < target[iRange]) cutLo[iRange] = cut[iRange];
+                    else cutHi[iRange] = cut[iRange];
+                    cut[iRange] = 0.5*(cutLo[iRange] + cutHi[iRange]);
+                    isConverged = false;
+                }
+                if (isConverged) break;
+            }
+
+            /*--- Split the ranges and move the points to their child ---*/
+            vector<unsigned long> newLo, newHi, childLeft(nRange), childRight(nRange);
+            for (iRange = 0; iRange < nRange; iRange++)
+            {
+                if (rangeHi[iRange] - rangeLo[iRange] > 1)
+                {
+                    nLeft = (rangeHi[iRange] - rangeLo[iRange]) / 2;
+                    childLeft[iRange] = newLo.size();
+                    newLo.push_back(rangeLo[iRange]); newHi.push_back(rangeLo[iRange] + nLeft);
+                    childRight[iRange] = newLo.size();
+                    newLo.push_back(rangeLo[iRange] + nLeft); newHi.push_back(rangeHi[iRange]);
+                }
+                else
+                {
+                    childLeft[iRange] = childRight[iRange] = newLo.size();
+                    newLo.push_back(rangeLo[iRange]); newHi.push_back(rangeHi[iRange]);
+                }
+            }
+
+            for (iPoint = 0; iPoint < val_numLocal; iPoint++)
+            {
+                iRange = pointRange[iPoint];
+                if (val_coord[iPoint*d_numDim + axis[iRange]] < cut[iRange]) pointRange[iPoint] = childLeft[iRange];
+                else pointRange[iPoint] = childRight[iRange];
+            }
+
+            rangeLo.swap(newLo);
+            rangeHi.swap(newHi);
+        }
+
+        val_part.resize(val_numLocal);
+        for (iPoint = 0; iPoint < val_numLocal; iPoint++)
+            val_part[iPoint] = rangeLo[pointRange[iPoint]];
+    }
+
+    void GeomPartitioner::ComputeQuality(unsigned long val_numLocal, const unsigned long* val_vtxdist,
+                                         const unsigned long* val_xadj, const unsigned long* val_adjacency,
+                                         const double* val_weight, const vector<unsigned long>& val_part)
+    {
+        unsigned long iPoint, iPart, iNeigh;
+        unsigned short iCon;
+        int iRank;
+
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        int rank = IsParallel() ? mpi.GetRank() : 0;
+        int size = IsParallel() ? mpi.GetSize() : 1;
+
+        /*--- Load imbalance of every constraint ---*/
+        d_partWeight.assign(d_numPart*d_numConstraint, 0.0);
+        for (iPoint = 0; iPoint < val_numLocal; iPoint++)
+            for (iCon = 0; iCon < d_numConstraint; iCon++)
+                d_partWeight[val_part[iPoint]*d_numConstraint + iCon] += (val_weight != NULL) ? val_weight[iPoint*d_numConstraint + iCon] : 1.0;
+        SumAll(d_partWeight);
+
+        for (iCon = 0; iCon < d_numConstraint; iCon++)
+        {
+            double sum = 0.0, heaviest = 0.0;
+            for (iPart = 0; iPart < d_numPart; iPart++)
+            {
+                sum += d_partWeight[iPart*d_numConstraint + iCon];
+                heaviest = max(heaviest, d_partWeight[iPart*d_numConstraint + iCon]);
+            }
+            d_imbalance[iCon] = (sum > 0.0) ? heaviest / (sum / double(d_numPart)) : 1.0;
+        }
+
+        /*--- Ask the owners for the part of every off-rank neighbor ---*/
+        unsigned long firstNode = val_vtxdist[rank], lastNode = val_vtxdist[rank + 1];
+        vector<vector<unsigned long> > request(size);
+        for (iPoint = 0; iPoint < val_numLocal; iPoint++)
+        {
+            for (iNeigh = val_xadj[iPoint]; iNeigh < val_xadj[iPoint + 1]; iNeigh++)
+            {
+                unsigned long jPoint = val_adjacency[iNeigh];
+                if (jPoint >= firstNode && jPoint < lastNode) continue;
+                iRank = int(upper_bound(val_vtxdist, val_vtxdist + size + 1, jPoint) - val_vtxdist) - 1;
+                request[iRank].push_back(jPoint);
+            }
+        }
+
+        vector<int> sendCount(size, 0), recvCount(size, 0), sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+        for (iRank = 0; iRank < size; iRank++)
+        {
+            sort(request[iRank].begin(), request[iRank].end());
+            request[iRank].erase(unique(request[iRank].begin(), request[iRank].end()), request[iRank].end());
+            sendCount[iRank] = (int)request[iRank].size();
+        }
+
+        vector<unsigned long> remotePart;
+        if (size > 1)
+        {
+            mpi.Alltoall(&sendCount[0], 1, MPI_INT, &recvCount[0], 1, MPI_INT);
+            for (iRank = 0; iRank < size; iRank++)
+            {
+                sendDispl[iRank + 1] = sendDispl[iRank] + sendCount[iRank];
+                recvDispl[iRank + 1] = recvDispl[iRank] + recvCount[iRank];
+            }
+
+            vector<unsigned long> sendBuf(sendDispl[size] + 1), recvBuf(recvDispl[size] + 1);
+            for (iRank = 0; iRank < size; iRank++)
+                copy(request[iRank].begin(), request[iRank].end(), sendBuf.begin() + sendDispl[iRank]);
+
+            mpi.Alltoallv(&sendBuf[0], &sendCount[0], &sendDispl[0], MPI_UNSIGNED_LONG,
+                          &recvBuf[0], &recvCount[0], &recvDispl[0], MPI_UNSIGNED_LONG);
+
+            for (int iRecv = 0; iRecv < recvDispl[size]; iRecv++)
+                recvBuf[iRecv] = val_part[recvBuf[iRecv] - firstNode];
+
+            remotePart.resize(sendDispl[size] + 1);
+            mpi.Alltoallv(&recvBuf[0], &recvCount[0], &recvDispl[0], MPI_UNSIGNED_LONG,
+                          &remotePart[0], &sendCount[0], &sendDispl[0], MPI_UNSIGNED_LONG);
+        }
+
+        /*--- Count the cut edges (each one is seen from both of its end points) ---*/
+        vector<double> cutCount(1, 0.0);
+        for (iPoint = 0; iPoint < val_numLocal; iPoint++)
+        {
+            for (iNeigh = val_xadj[iPoint]; iNeigh < val_xadj[iPoint + 1]; iNeigh++)
+            {
+                unsigned long jPoint = val_adjacency[iNeigh], jPart;
+                if (jPoint >= firstNode && jPoint < lastNode)
+                {
+                    jPart = val_part[jPoint - firstNode];
+                }
+                else
+                {
+                    iRank = int(upper_bound(val_vtxdist, val_vtxdist + size + 1, jPoint) - val_vtxdist) - 1;
+                    vector<unsigned long>::iterator it = lower_bound(request[iRank].begin(), request[iRank].end(), jPoint);
+                    jPart = remotePart[sendDispl[iRank] + (it - request[iRank].begin())];
+                }
+                if (jPart != val_part[iPoint]) cutCount[0] += 1.0;
+            }
+        }
+        SumAll(cutCount);
+        d_edgeCut = (unsigned long)(0.5*cutCount[0] + 0.5);
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Built-in geometric partitioner (weighted recursive coordinate bisection)
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMPARTITIONER_HPP
+#define ARIES_GEOMPARTITIONER_HPP
+
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Weighted recursive coordinate bisection of a point cloud.
+     *
+     * Works directly on the linear partition produced by the mesh readers:
+     * every rank passes the coordinates of the points it read, and all the
+     * bisection cuts are found together with a handful of reductions per
+     * level, so no rank ever holds more than its own share of the mesh.
+     * It is used as the fallback when METIS/ParMETIS is not compiled in.
+     *
+     * Several weights per point (e.g. compute and memory) may be given; the
+     * cuts then balance the sum of the weights normalized by their totals and
+     * the imbalance is reported for every constraint.
+     */
+    class GeomPartitioner
+    {
+    public:
+        /*!
+         * \param[in] val_numDim - Number of dimensions of the problem.
+         * \param[in] val_numPart - Number of parts (usually the number of ranks).
+         * \param[in] val_isDistributed - <code>TRUE</code> if the points are spread over all ranks,
+         *            <code>FALSE</code> if the calling rank holds the whole mesh.
+         * \param[in] val_numConstraint - Number of weights per point.
+         */
+        GeomPartitioner(unsigned short val_numDim, unsigned long val_numPart, bool val_isDistributed = true, unsigned short val_numConstraint = 1);
+        ~GeomPartitioner();
+
+        /*!
+         * \brief Compute the part of every local point.
+         * \param[in] val_numLocal - Number of local points.
+         * \param[in] val_coord - Coordinates, <i>val_coord[iPoint*nDim+iDim]</i>.
+         * \param[in] val_weight - Point weights, <i>val_weight[iPoint*nConstraint+iCon]</i> (NULL for unit weights).
+         * \param[out] val_part - Part of each local point.
+         */
+        void Partition(unsigned long val_numLocal, const double* val_coord, const double* val_weight, vector<unsigned long>& val_part);
+
+        /*!
+         * \brief Compute the edge cut and the load imbalance of a partition.
+         * \param[in] val_numLocal - Number of local points.
+         * \param[in] val_vtxdist - Global index of the first point of each rank (size nRank+1).
+         * \param[in] val_xadj - CSR offsets of the local graph (size val_numLocal+1).
+         * \param[in] val_adjacency - Global indices of the neighbors.
+         * \param[in] val_weight - Point weights, <i>val_weight[iPoint*nConstraint+iCon]</i> (NULL for unit weights).
+         * \param[in] val_part - Part of each local point.
+         */
+        void ComputeQuality(unsigned long val_numLocal, const unsigned long* val_vtxdist,
+                            const unsigned long* val_xadj, const unsigned long* val_adjacency,
+                            const double* val_weight, const vector<unsigned long>& val_part);
+
+        unsigned long GetNumPart() { return d_numPart; };
+        unsigned short GetNumConstraint() { return d_numConstraint; };
+        unsigned long GetEdgeCut() { return d_edgeCut; };
+        double GetImbalance(unsigned short val_iCon = 0) { return d_imbalance[val_iCon]; };
+        double GetPartWeight(unsigned long val_iPart, unsigned short val_iCon = 0) { return d_partWeight[val_iPart*d_numConstraint + val_iCon]; };
+
+    private:
+        bool IsParallel();
+        void SumAll(vector<double>& val_buffer);
+        void MinAll(vector<double>& val_buffer);
+        void MaxAll(vector<double>& val_buffer);
+
+        unsigned short d_numDim;                /*!< \brief Number of dimensions of the problem. */
+        unsigned long d_numPart;                /*!< \brief Number of parts requested. */
+        unsigned short d_numConstraint;         /*!< \brief Number of weights per point. */
+        bool d_isDistributed;                   /*!< \brief Whether the points are spread over all ranks. */
+        unsigned short d_maxBisectIter;         /*!< \brief Maximum number of iterations to locate a cut. */
+        double d_cutTolerance;                  /*!< \brief Relative weight tolerance of a cut. */
+
+        unsigned long d_edgeCut;                /*!< \brief Number of graph edges between different parts. */
+        vector<double> d_imbalance;             /*!< \brief Heaviest part weight over average part weight, per constraint. */
+        vector<double> d_partWeight;            /*!< \brief Total weight of every part, per constraint. */
+    };
+}
+
+#endif
@@ -0,0 +1,132 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Matching of periodic boundary points through a k-d tree
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomPeriodicMatcher.hpp"
+#include "GeomKDTree.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ARIES
+{
+    GeomPeriodicMatcher::GeomPeriodicMatcher(unsigned short val_numDim)
+    {
+        unsigned short iDim, jDim;
+
+        d_numDim = val_numDim;
+        for (iDim = 0; iDim < 3; iDim++)
+        {
+            d_center[iDim] = 0.0;
+            d_translation[iDim] = 0.0;
+            for (jDim = 0; jDim < 3; jDim++) d_rotation[iDim][jDim] = (iDim == jDim) ? 1.0 : 0.0;
+        }
+
+        d_tolerance = 0.0;
+        d_numBad = 0;
+        d_numShared = 0;
+        d_maxDistance = 0.0;
+        d_meanDistance = 0.0;
+    }
+
+    GeomPeriodicMatcher::~GeomPeriodicMatcher()
+    {
+    }
+
+    void GeomPeriodicMatcher::SetTransformation(const double* val_center, const double* val_angles, const double* val_translation)
+    {
+        double cosTheta = cos(val_angles[0]), cosPhi = cos(val_angles[1]), cosPsi = cos(val_angles[2]);
+        double sinTheta = sin(val_angles[0]), sinPhi = sin(val_angles[1]), sinPsi = sin(val_angles[2]);
+
+        for (unsigned short iDim = 0; iDim < 3; iDim++)
+        {
+            d_center[iDim] = val_center[iDim];
+            d_translation[iDim] = val_center[iDim] + val_translation[iDim];
+        }
+
+        d_rotation[0][0] = cosPhi*cosPsi;
+        d_rotation[1][0] = cosPhi*sinPsi;
+        d_rotation[2][0] = -sinPhi;
+
+        d_rotation[0][1] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;
+        d_rotation[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;
+        d_rotation[2][1] = sinTheta*cosPhi;
+
+        d_rotation[0][2] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
+        d_rotation[1][2] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
+        d_rotation[2][2] = cosTheta*cosPhi;
+    }
+
+    void GeomPeriodicMatcher::Transform(const double* val_coord, double* val_transformed) const
+    {
+        unsigned short iDim, jDim;
+        double delta[3] = { 0.0, 0.0, 0.0 };
+
+        for (iDim = 0; iDim < d_numDim; iDim++) delta[iDim] = val_coord[iDim] - d_center[iDim];
+        for (iDim = 0; iDim < d_numDim; iDim++)
+        {
+            val_transformed[iDim] = d_translation[iDim];
+            for (jDim = 0; jDim < 3; jDim++) val_transformed[iDim] += d_rotation[iDim][jDim]*delta[jDim];
+        }
+    }
+
+    void GeomPeriodicMatcher::Match(unsigned long val_numDonor, const double* val_donorCoord,
+                                    unsigned long val_numPoint, const double* val_coord, double val_tolerance)
+    {
+        long iPoint;
+        unsigned long numBad = 0;
+        double maxDistance = 0.0, sumDistance = 0.0;
+
+        d_tolerance = val_tolerance;
+        d_donor.assign(val_numPoint, GeomKDTree::GetNoPoint());
+        d_distance.assign(val_numPoint, 0.0);
+
+        GeomKDTree tree(d_numDim);
+        tree.Build(val_numDonor, val_donorCoord);
+
+#pragma omp parallel for schedule(dynamic, 1024) reduction(+:numBad, sumDistance) reduction(max:maxDistance)
+        for (iPoint = 0; iPoint < (long)val_numPoint; iPoint++)
+        {
+            double transformed[3];
+            Transform(&val_coord[iPoint*d_numDim], transformed);
+
+            d_donor[iPoint] = tree.FindNearest(transformed, d_distance[iPoint]);
+            if (d_donor[iPoint] == GeomKDTree::GetNoPoint()) d_distance[iPoint] = 1E10;
+
+            if (d_distance[iPoint] > val_tolerance) numBad++;
+            sumDistance += d_distance[iPoint];
+            maxDistance = max(maxDistance, d_distance[iPoint]);
+        }
+
+        d_numBad = numBad;
+        d_maxDistance = maxDistance;
+        d_meanDistance = (val_numPoint > 0) ? sumDistance / double(val_numPoint) : 0.0;
+
+        /*--- A conforming periodic pair uses every donor once ---*/
+        vector<unsigned long> donor(d_donor);
+        sort(donor.begin(), donor.end());
+        d_numShared = 0;
+        for (unsigned long jPoint = 1; jPoint < donor.size(); jPoint++)
+            if (donor[jPoint] == donor[jPoint - 1] && (jPoint == 1 || donor[jPoint - 1] != donor[jPoint - 2])) d_numShared++;
+    }
+
+    void GeomPeriodicMatcher::Print(ostream& val_out) const
+    {
+        val_out << d_donor.size() << " points matched, distance mean " << d_meanDistance << ", max " << d_maxDistance;
+        val_out << "; " << d_numBad << " above the tolerance " << d_tolerance;
+        if (d_numShared > 0) val_out << ", " << d_numShared << " donors shared";
+        val_out << "." << endl;
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Matching of periodic boundary points through a k-d tree
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMPERIODICMATCHER_HPP
+#define ARIES_GEOMPERIODICMATCHER_HPP
+
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Pairs the points of a periodic boundary with the closest points of its donor boundary.
+     *
+     * The periodic transformation (rotation about a center, then translation)
+     * is applied once to every point, and the transformed points are looked up
+     * in a k-d tree of the donor points, in parallel, so the matching costs
+     * O(n log n) instead of comparing every pair. The matching reports how
+     * many points are farther than a tolerance from their donor and how many
+     * donors are shared, which flags periodic boundaries that do not conform.
+     */
+    class GeomPeriodicMatcher
+    {
+    public:
+        /*!
+         * \param[in] val_numDim - Number of dimensions of the problem.
+         */
+        GeomPeriodicMatcher(unsigned short val_numDim);
+        ~GeomPeriodicMatcher();
+
+        /*!
+         * \brief Set the periodic transformation; the rotation is about x, then y, then z.
+         * \param[in] val_center - Center of rotation.
+         * \param[in] val_angles - Rotation angles (rad).
+         * \param[in] val_translation - Translation.
+         */
+        void SetTransformation(const double* val_center, const double* val_angles, const double* val_translation);
+
+        /*!
+         * \brief Transform a point.
+         */
+        void Transform(const double* val_coord, double* val_transformed) const;
+
+        /*!
+         * \brief Match every point with its closest donor.
+         * \param[in] val_numDonor - Number of donor points.
+         * \param[in] val_donorCoord - Coordinates of the donors, <i>[iDonor*nDim+iDim]</i>.
+         * \param[in] val_numPoint - Number of points to match.
+         * \param[in] val_coord - Coordinates of the points (before the transformation).
+         * \param[in] val_tolerance - Largest distance of a good match.
+         */
+        void Match(unsigned long val_numDonor, const double* val_donorCoord,
+                   unsigned long val_numPoint, const double* val_coord, double val_tolerance);
+
+        /*!
+         * \brief Donor of a point (index in the donor list).
+         */
+        unsigned long GetDonor(unsigned long val_iPoint) const { return d_donor[val_iPoint]; };
+
+        /*!
+         * \brief Distance between a transformed point and its donor.
+         */
+        double GetDistance(unsigned long val_iPoint) const { return d_distance[val_iPoint]; };
+
+        bool IsBadMatch(unsigned long val_iPoint) const { return d_distance[val_iPoint] > d_tolerance; };
+
+        unsigned long GetNumBadMatch() const { return d_numBad; };
+        unsigned long GetNumSharedDonor() const { return d_numShared; };
+        double GetMaxDistance() const { return d_maxDistance; };
+        double GetMeanDistance() const { return d_meanDistance; };
+
+        /*!
+         * \brief Print the tolerance report of the last matching.
+         */
+        void Print(ostream& val_out) const;
+
+    private:
+        unsigned short d_numDim;                /*!< \brief Number of dimensions of the problem. */
+        double d_center[3];                     /*!< \brief Center of rotation. */
+        double d_translation[3];                /*!< \brief Center plus translation. */
+        double d_rotation[3][3];                /*!< \brief Rotation matrix. */
+
+        vector<unsigned long> d_donor;          /*!< \brief Donor of every point. */
+        vector<double> d_distance;              /*!< \brief Distance of every point to its donor. */
+        double d_tolerance;                     /*!< \brief Largest distance of a good match. */
+        unsigned long d_numBad;                 /*!< \brief Points farther than the tolerance from their donor. */
+        unsigned long d_numShared;              /*!< \brief Donors matched by more than one point. */
+        double d_maxDistance;                   /*!< \brief Largest matching distance. */
+        double d_meanDistance;                  /*!< \brief Mean matching distance. */
+    };
+}
+
+#endif
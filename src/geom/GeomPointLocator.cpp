@@ -0,0 +1,162 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Parallel closest donor search for matching boundary points
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomPointLocator.hpp"
+
+#include "AriesMPI.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace ARIES
+{
+    GeomPointLocator::GeomPointLocator(unsigned short val_numDim, double val_tolerance)
+        : d_tree(val_numDim)
+    {
+        d_numDim = val_numDim;
+        d_tolerance = val_tolerance;
+        d_rank = 0;
+    }
+
+    GeomPointLocator::~GeomPointLocator()
+    {
+    }
+
+    void GeomPointLocator::Build(unsigned long val_numDonor, const double* val_donorCoord, const unsigned long* val_donorPoint,
+                                 unsigned long val_numTarget, const double* val_targetCoord)
+    {
+        unsigned long iDonor, iTarget, iCandidate;
+        unsigned short iDim;
+        int iRank;
+
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        int size = mpi.GetSize();
+        d_rank = (size > 1) ? mpi.GetRank() : 0;
+
+        vector<double> candidateCoord;
+        d_candidatePoint.clear();
+        d_candidateRank.clear();
+        d_ownCandidate.clear();
+
+        if (size <= 1)
+        {
+            candidateCoord.assign(val_donorCoord, val_donorCoord + val_numDonor*d_numDim);
+            d_candidatePoint.assign(val_donorPoint, val_donorPoint + val_numDonor);
+            d_candidateRank.assign(val_numDonor, 0);
+        }
+        else
+        {
+            /*--- Bounding box of the local targets, inflated by the tolerance (empty if no target) ---*/
+            const int nBox = 2*d_numDim;
+            vector<double> localBox(nBox), globalBox(nBox*size);
+            for (iDim = 0; iDim < d_numDim; iDim++)
+            {
+                localBox[iDim] = numeric_limits<double>::max();
+                localBox[d_numDim + iDim] = -numeric_limits<double>::max();
+            }
+            for (iTarget = 0; iTarget < val_numTarget; iTarget++)
+            {
+                for (iDim = 0; iDim < d_numDim; iDim++)
+                {
+                    localBox[iDim] = min(localBox[iDim], val_targetCoord[iTarget*d_numDim + iDim] - d_tolerance);
+                    localBox[d_numDim + iDim] = max(localBox[d_numDim + iDim], val_targetCoord[iTarget*d_numDim + iDim] + d_tolerance);
+                }
+            }
+            mpi.Allgather(&localBox[0], nBox, MPI_DOUBLE, &globalBox[0], nBox, MPI_DOUBLE);
+
+            /*--- Send every donor to the ranks whose box holds it ---*/
+            vector<vector<unsigned long> > sendDonor(size);
+            for (iDonor = 0; iDonor < val_numDonor; iDonor++)
+            {
+                const double* coord = &val_donorCoord[iDonor*d_numDim];
+                for (iRank = 0; iRank < size; iRank++)
+                {
+                    const double* box = &globalBox[iRank*nBox];
+                    bool inside = true;
+                    for (iDim = 0; iDim < d_numDim && inside; iDim++)
+                        inside = (coord[iDim] >= box[iDim]) && (coord[iDim] <= box[d_numDim + iDim]);
+                    if (inside) sendDonor[iRank].push_back(iDonor);
+                }
+            }
+
+            vector<int> sendCount(size), recvCount(size), sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+            for (iRank = 0; iRank < size; iRank++) sendCount[iRank] = (int)sendDonor[iRank].size();
+            mpi.Alltoall(&sendCount[0], 1, MPI_INT, &recvCount[0], 1, MPI_INT);
+            for (iRank = 0; iRank < size; iRank++)
+            {
+                sendDispl[iRank + 1] = sendDispl[iRank] + sendCount[iRank];
+                recvDispl[iRank + 1] = recvDispl[iRank] + recvCount[iRank];
+            }
+
+            vector<unsigned long> sendPoint(sendDispl[size] + 1);
+            vector<double> sendCoord(sendDispl[size]*d_numDim + 1);
+            for (iRank = 0; iRank < size; iRank++)
+            {
+                for (unsigned long iSend = 0; iSend < sendDonor[iRank].size(); iSend++)
+                {
+                    iDonor = sendDonor[iRank][iSend];
+                    sendPoint[sendDispl[iRank] + iSend] = val_donorPoint[iDonor];
+                    for (iDim = 0; iDim < d_numDim; iDim++)
+                        sendCoord[(sendDispl[iRank] + iSend)*d_numDim + iDim] = val_donorCoord[iDonor*d_numDim + iDim];
+                }
+            }
+
+            d_candidatePoint.resize(recvDispl[size] + 1);
+            mpi.Alltoallv(&sendPoint[0], &sendCount[0], &sendDispl[0], MPI_UNSIGNED_LONG,
+                          &d_candidatePoint[0], &recvCount[0], &recvDispl[0], MPI_UNSIGNED_LONG);
+            d_candidatePoint.resize(recvDispl[size]);
+
+            d_candidateRank.resize(d_candidatePoint.size());
+            for (iRank = 0; iRank < size; iRank++)
+                for (iCandidate = recvDispl[iRank]; iCandidate < (unsigned long)recvDispl[iRank + 1]; iCandidate++)
+                    d_candidateRank[iCandidate] = iRank;
+
+            for (iRank = 0; iRank <= size; iRank++)
+            {
+                sendDispl[iRank] *= d_numDim;
+                recvDispl[iRank] *= d_numDim;
+                if (iRank < size) { sendCount[iRank] *= d_numDim; recvCount[iRank] *= d_numDim; }
+            }
+            candidateCoord.resize(recvDispl[size] + 1);
+            mpi.Alltoallv(&sendCoord[0], &sendCount[0], &sendDispl[0], MPI_DOUBLE,
+                          &candidateCoord[0], &recvCount[0], &recvDispl[0], MPI_DOUBLE);
+            candidateCoord.resize(recvDispl[size]);
+        }
+
+        for (iCandidate = 0; iCandidate < d_candidatePoint.size(); iCandidate++)
+            if (d_candidateRank[iCandidate] == d_rank) d_ownCandidate[d_candidatePoint[iCandidate]] = iCandidate;
+
+        d_tree.Build(d_candidatePoint.size(), candidateCoord.empty() ? NULL : &candidateCoord[0]);
+    }
+
+    bool GeomPointLocator::FindNearest(const double* val_coord, unsigned long& val_point, int& val_rank, double& val_dist,
+                                       unsigned long val_skipPoint) const
+    {
+        unsigned long skip = GeomKDTree::GetNoPoint();
+        if (val_skipPoint != GeomKDTree::GetNoPoint())
+        {
+            map<unsigned long, unsigned long>::const_iterator it = d_ownCandidate.find(val_skipPoint);
+            if (it != d_ownCandidate.end()) skip = it->second;
+        }
+
+        unsigned long iCandidate = d_tree.FindNearest(val_coord, val_dist, skip);
+        if (iCandidate == GeomKDTree::GetNoPoint()) return false;
+
+        val_point = d_candidatePoint[iCandidate];
+        val_rank = d_candidateRank[iCandidate];
+        return true;
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Parallel closest donor search for matching boundary points
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMPOINTLOCATOR_HPP
+#define ARIES_GEOMPOINTLOCATOR_HPP
+
+#include "GeomKDTree.hpp"
+
+#include <map>
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Finds, for every local target point, the closest donor point of any rank.
+     *
+     * Every rank publishes the bounding box of its targets inflated by the
+     * search tolerance and sends each of its donors only to the ranks whose
+     * box contains it, so a rank receives the candidates around its own
+     * targets instead of the whole donor set. The candidates are then
+     * searched with a k-d tree. Any donor closer than the tolerance to a
+     * target is guaranteed to be among the candidates of that target's rank;
+     * farther donors may be missed, in which case the match is bad anyway.
+     */
+    class GeomPointLocator
+    {
+    public:
+        /*!
+         * \param[in] val_numDim - Number of dimensions of the problem.
+         * \param[in] val_tolerance - Largest distance of an acceptable match.
+         */
+        GeomPointLocator(unsigned short val_numDim, double val_tolerance);
+        ~GeomPointLocator();
+
+        /*!
+         * \brief Exchange the donors and build the search tree (collective).
+         * \param[in] val_numDonor - Number of local donors.
+         * \param[in] val_donorCoord - Coordinates of the donors, <i>[iDonor*nDim+iDim]</i>.
+         * \param[in] val_donorPoint - Local index of the donors on their rank.
+         * \param[in] val_numTarget - Number of local targets.
+         * \param[in] val_targetCoord - Coordinates of the targets, <i>[iTarget*nDim+iDim]</i>.
+         */
+        void Build(unsigned long val_numDonor, const double* val_donorCoord, const unsigned long* val_donorPoint,
+                   unsigned long val_numTarget, const double* val_targetCoord);
+
+        /*!
+         * \brief Closest donor to a location.
+         * \param[in] val_coord - Location.
+         * \param[out] val_point - Index of the donor on its rank.
+         * \param[out] val_rank - Rank that owns the donor.
+         * \param[out] val_dist - Distance to the donor.
+         * \param[in] val_skipPoint - Local donor that must not be returned (e.g. the target itself).
+         * \return <code>FALSE</code> if no candidate was received.
+         */
+        bool FindNearest(const double* val_coord, unsigned long& val_point, int& val_rank, double& val_dist,
+                         unsigned long val_skipPoint = GeomKDTree::GetNoPoint()) const;
+
+        /*!
+         * \brief Number of donors received from all ranks (own ones included).
+         */
+        unsigned long GetNumCandidate() const { return d_candidatePoint.size(); };
+
+    private:
+        unsigned short d_numDim;                    /*!< \brief Number of dimensions of the problem. */
+        double d_tolerance;                         /*!< \brief Inflation of the target bounding boxes. */
+        int d_rank;                                 /*!< \brief Rank of this process. */
+        GeomKDTree d_tree;                          /*!< \brief Search tree over the candidates. */
+        vector<unsigned long> d_candidatePoint;     /*!< \brief Local index of every candidate on its rank. */
+        vector<int> d_candidateRank;                /*!< \brief Owner of every candidate. */
+        map<unsigned long, unsigned long> d_ownCandidate;   /*!< \brief Candidate of every donor of this rank. */
+    };
+}
+
+#endif
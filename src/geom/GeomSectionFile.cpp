@@ -0,0 +1,108 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Writer of the binary files made of a header, a section table and aligned sections
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomSectionFile.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+namespace ARIES
+{
+    const unsigned long long GeomSectionFile::d_align;
+
+    GeomSectionFile::GeomSectionFile(unsigned short val_numType)
+    {
+        d_data.assign(val_numType, (const void*)NULL);
+        d_count.assign(val_numType, 0);
+        d_size.assign(val_numType, 0);
+    }
+
+    GeomSectionFile::~GeomSectionFile()
+    {
+    }
+
+    void GeomSectionFile::SetSection(unsigned short val_type, const void* val_data, unsigned long val_count, unsigned short val_size)
+    {
+        d_data[val_type] = val_data;
+        d_count[val_type] = val_count;
+        d_size[val_type] = val_size;
+    }
+
+    unsigned int GeomSectionFile::GetNumSection() const
+    {
+        unsigned int numSection = 0;
+        for (unsigned short iType = 0; iType < d_size.size(); iType++)
+            if (d_size[iType] > 0) numSection++;
+        return numSection;
+    }
+
+    unsigned long long GeomSectionFile::GetFileSize(size_t val_headerSize) const
+    {
+        vector<GeomSectionEntry> table;
+        return SetTable(val_headerSize, table);
+    }
+
+    unsigned long long GeomSectionFile::SetTable(size_t val_headerSize, vector<GeomSectionEntry>& val_table) const
+    {
+        /*--- Lay out the sections after the header and the table ---*/
+        val_table.clear();
+        unsigned long long offset = val_headerSize + GetNumSection()*sizeof(GeomSectionEntry);
+        for (unsigned short iType = 0; iType < d_size.size(); iType++)
+        {
+            if (d_size[iType] == 0) continue;
+            GeomSectionEntry section;
+            offset = (offset + d_align - 1) / d_align*d_align;
+            section.type = iType;
+            section.size = d_size[iType];
+            section.count = d_count[iType];
+            section.offset = offset;
+            val_table.push_back(section);
+            offset += section.count*section.size;
+        }
+        return offset;
+    }
+
+    bool GeomSectionFile::Write(const string& val_fileName, const void* val_header, size_t val_headerSize) const
+    {
+        vector<GeomSectionEntry> table;
+        SetTable(val_headerSize, table);
+
+        /*--- Write to a temporary file and rename it once complete ---*/
+        string tempName = val_fileName + ".tmp";
+        ofstream file(tempName.c_str(), ios::out | ios::binary | ios::trunc);
+        if (file.fail()) return false;
+
+        file.write((const char*)val_header, val_headerSize);
+        if (!table.empty()) file.write((const char*)&table[0], table.size()*sizeof(GeomSectionEntry));
+
+        char padding[d_align] = { 0 };
+        unsigned long long position = val_headerSize + table.size()*sizeof(GeomSectionEntry);
+        for (unsigned long iEntry = 0; iEntry < table.size(); iEntry++)
+        {
+            file.write(padding, table[iEntry].offset - position);
+            if (table[iEntry].count > 0) file.write((const char*)d_data[table[iEntry].type], table[iEntry].count*table[iEntry].size);
+            position = table[iEntry].offset + table[iEntry].count*table[iEntry].size;
+        }
+
+        file.close();
+        if (file.fail())
+        {
+            remove(tempName.c_str());
+            return false;
+        }
+        return rename(tempName.c_str(), val_fileName.c_str()) == 0;
+    }
+}
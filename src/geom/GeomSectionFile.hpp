@@ -0,0 +1,101 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Writer of the binary files made of a header, a section table and aligned sections
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMSECTIONFILE_HPP
+#define ARIES_GEOMSECTIONFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Entry of the section table, as stored on disk.
+     */
+    struct GeomSectionEntry
+    {
+        unsigned int type;
+        unsigned int size;
+        unsigned long long count;
+        unsigned long long offset;
+    };
+
+    /*!
+     * \brief Layout and writing of the binary files of the geometry (GeomGeometryCache, GeomMeshFileNative).
+     *
+     * Such a file is a header owned by the caller, a table with one
+     * GeomSectionEntry per registered section, in the order of the types, and
+     * the sections themselves, each one aligned on d_align bytes so they can
+     * be mapped or read by byte ranges straight into typed arrays. The header
+     * usually records the number of sections and the size of the file, which
+     * the caller gets from GetNumSection and GetFileSize before writing.
+     * Writing goes to a temporary file renamed at the end, so an interrupted
+     * run never leaves a truncated file behind.
+     */
+    class GeomSectionFile
+    {
+    public:
+        /*!
+         * \param[in] val_numType - Number of section types of the format.
+         */
+        GeomSectionFile(unsigned short val_numType);
+        ~GeomSectionFile();
+
+        /*!
+         * \brief Register a section to write; the array is only read by Write.
+         * \param[in] val_type - Section.
+         * \param[in] val_data - Values.
+         * \param[in] val_count - Number of values.
+         * \param[in] val_size - Size of a value in bytes.
+         */
+        void SetSection(unsigned short val_type, const void* val_data, unsigned long val_count, unsigned short val_size);
+
+        /*!
+         * \brief Number of registered sections.
+         */
+        unsigned int GetNumSection() const;
+
+        /*!
+         * \brief Size of the file once written after a header of <i>val_headerSize</i> bytes.
+         */
+        unsigned long long GetFileSize(size_t val_headerSize) const;
+
+        /*!
+         * \brief Write the header, the table and the registered sections.
+         * \return <i>true</i> if the file was written completely.
+         */
+        bool Write(const string& val_fileName, const void* val_header, size_t val_headerSize) const;
+
+        static const unsigned long long d_align = 64;   /*!< \brief Alignment of the sections in bytes. */
+
+    private:
+        /*!
+         * \brief Table of the registered sections after a header of <i>val_headerSize</i> bytes.
+         * \return Offset of the end of the last section.
+         */
+        unsigned long long SetTable(size_t val_headerSize, vector<GeomSectionEntry>& val_table) const;
+
+        vector<const void*> d_data;             /*!< \brief Arrays to write. */
+        vector<unsigned long> d_count;          /*!< \brief Number of values of the sections. */
+        vector<unsigned short> d_size;          /*!< \brief Size of the values of the sections, 0 if not registered. */
+    };
+}
+
+#endif
@@ -0,0 +1,185 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Threaded Laplacian smoothing of the grid coordinates with constraints
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomSmoother.hpp"
+#include "GeomHaloExchange.hpp"
+
+#include "AriesMPI.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ARIES
+{
+    GeomSmoother::GeomSmoother(unsigned short val_numDim)
+    {
+        d_numDim = val_numDim;
+        d_numPoint = 0;
+        d_halo = NULL;
+        d_frequency = 1;
+        d_residual = 0.0;
+    }
+
+    GeomSmoother::~GeomSmoother()
+    {
+    }
+
+    void GeomSmoother::SetGraph(unsigned long val_numPoint, const unsigned long* val_neighborPtr, const unsigned long* val_neighbor)
+    {
+        d_numPoint = val_numPoint;
+        d_neighborPtr.assign(val_neighborPtr, val_neighborPtr + val_numPoint + 1);
+        d_neighbor.assign(val_neighbor, val_neighbor + val_neighborPtr[val_numPoint]);
+        d_constraint.assign(val_numPoint, Smooth_Free);
+        d_direction.assign(3*val_numPoint, 0.0);
+    }
+
+    void GeomSmoother::SetConstraint(unsigned long val_iPoint, ConstraintType val_type, const double* val_direction)
+    {
+        unsigned short iDim;
+        d_constraint[val_iPoint] = (unsigned char)val_type;
+
+        if ((val_type == Smooth_Line) || (val_type == Smooth_Plane))
+        {
+            double norm = 0.0;
+            for (iDim = 0; iDim < d_numDim; iDim++) norm += val_direction[iDim]*val_direction[iDim];
+            norm = sqrt(norm);
+
+            /*--- A degenerate direction cannot be followed ---*/
+            if (norm == 0.0)
+            {
+                d_constraint[val_iPoint] = (val_type == Smooth_Line) ? Smooth_Fixed : Smooth_Free;
+                return;
+            }
+            for (iDim = 0; iDim < d_numDim; iDim++) d_direction[3*val_iPoint + iDim] = val_direction[iDim] / norm;
+        }
+    }
+
+    void GeomSmoother::SetHalo(GeomHaloExchange* val_halo, unsigned short val_frequency)
+    {
+        d_halo = val_halo;
+        d_frequency = max(val_frequency, (unsigned short)1);
+    }
+
+    double GeomSmoother::Sweep(double val_coefficient)
+    {
+        long iPoint;
+        double residual = 0.0;
+        const unsigned short nDim = d_numDim;
+        const unsigned long nPoint = d_numPoint;
+
+#pragma omp parallel for schedule(static) reduction(max:residual)
+        for (iPoint = 0; iPoint < (long)nPoint; iPoint++)
+        {
+            unsigned short iDim;
+            unsigned long jNeighbor;
+            double sum[3] = { 0.0, 0.0, 0.0 }, move[3] = { 0.0, 0.0, 0.0 };
+
+            if (d_constraint[iPoint] == Smooth_Fixed)
+            {
+                for (iDim = 0; iDim < nDim; iDim++) d_coordNew[iDim*nPoint + iPoint] = d_coord0[iDim*nPoint + iPoint];
+                continue;
+            }
+
+            for (iDim = 0; iDim < nDim; iDim++)
+            {
+                const double* coord = &d_coord[iDim*nPoint];
+                for (jNeighbor = d_neighborPtr[iPoint]; jNeighbor < d_neighborPtr[iPoint + 1]; jNeighbor++)
+                    sum[iDim] += coord[d_neighbor[jNeighbor]];
+            }
+
+            double numNeighbor = double(d_neighborPtr[iPoint + 1] - d_neighborPtr[iPoint]);
+            for (iDim = 0; iDim < nDim; iDim++)
+                move[iDim] = (d_coord0[iDim*nPoint + iPoint] + val_coefficient*sum[iDim]) / (1.0 + val_coefficient*numNeighbor) - d_coord0[iDim*nPoint + iPoint];
+
+            /*--- Keep the displacement along the feature line or in the surface plane ---*/
+            if (d_constraint[iPoint] != Smooth_Free)
+            {
+                const double* direction = &d_direction[3*iPoint];
+                double projection = 0.0;
+                for (iDim = 0; iDim < nDim; iDim++) projection += move[iDim]*direction[iDim];
+                for (iDim = 0; iDim < nDim; iDim++)
+                    move[iDim] = (d_constraint[iPoint] == Smooth_Line) ? projection*direction[iDim] : move[iDim] - projection*direction[iDim];
+            }
+
+            for (iDim = 0; iDim < nDim; iDim++)
+            {
+                double coordNew = d_coord0[iDim*nPoint + iPoint] + move[iDim];
+                residual = max(residual, fabs(coordNew - d_coord[iDim*nPoint + iPoint]));
+                d_coordNew[iDim*nPoint + iPoint] = coordNew;
+            }
+        }
+
+        d_coord.swap(d_coordNew);
+        return residual;
+    }
+
+    void GeomSmoother::ExchangeHalo()
+    {
+        unsigned long iSend, iRecv;
+        unsigned short iDim;
+
+        /*--- All the components in a single message per neighbor ---*/
+        double* send = d_halo->GetSendBuffer(d_numDim);
+        for (iSend = 0; iSend < d_halo->GetNumSend(); iSend++)
+            for (iDim = 0; iDim < d_numDim; iDim++)
+                send[iSend*d_numDim + iDim] = d_coord[iDim*d_numPoint + d_halo->GetSendPoint(iSend)];
+
+        d_halo->Start(d_numDim);
+        const double* recv = d_halo->Finish(d_numDim, true);
+
+        for (iRecv = 0; iRecv < d_halo->GetNumRecv(); iRecv++)
+            for (iDim = 0; iDim < d_numDim; iDim++)
+                d_coord[iDim*d_numPoint + d_halo->GetRecvPoint(iRecv)] = recv[iRecv*d_numDim + iDim];
+    }
+
+    unsigned long GeomSmoother::Smooth(double* val_coord, unsigned long val_numSweep, double val_coefficient, double val_tolerance)
+    {
+        unsigned long iPoint, iSweep;
+        unsigned short iDim;
+
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        bool isParallel = (d_halo != NULL) && (mpi.GetSize() > 1);
+
+        d_coord0.resize(d_numDim*d_numPoint);
+        for (iPoint = 0; iPoint < d_numPoint; iPoint++)
+            for (iDim = 0; iDim < d_numDim; iDim++)
+                d_coord0[iDim*d_numPoint + iPoint] = val_coord[iPoint*d_numDim + iDim];
+        d_coord = d_coord0;
+        d_coordNew.resize(d_coord.size());
+
+        d_residual = 0.0;
+        for (iSweep = 0; iSweep < val_numSweep; )
+        {
+            double residual = Sweep(val_coefficient);
+            iSweep++;
+
+            /*--- Halo refresh and convergence test only every few sweeps ---*/
+            if ((iSweep % d_frequency != 0) && (iSweep < val_numSweep)) continue;
+
+            if (d_halo != NULL) ExchangeHalo();
+            if (isParallel) mpi.Allreduce(&residual, &d_residual, 1, MPI_DOUBLE, MPI_MAX);
+            else d_residual = residual;
+
+            if (d_residual <= val_tolerance) break;
+        }
+
+        for (iPoint = 0; iPoint < d_numPoint; iPoint++)
+            for (iDim = 0; iDim < d_numDim; iDim++)
+                val_coord[iPoint*d_numDim + iDim] = d_coord[iDim*d_numPoint + iPoint];
+
+        return iSweep;
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Threaded Laplacian smoothing of the grid coordinates with constraints
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMSMOOTHER_HPP
+#define ARIES_GEOMSMOOTHER_HPP
+
+#include <cstddef>
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    class GeomHaloExchange;
+
+    /*!
+     * \brief Implicit Laplacian smoothing of the point coordinates, Jacobi sweeps on the point graph.
+     *
+     * Every sweep sets x_i = (x0_i + c*sum_j x_j) / (1 + c*n_i), with x0 the
+     * coordinates before smoothing and j the n_i neighbors of i, then projects
+     * the displacement x_i - x0_i on the constraint of the point: none, fixed,
+     * along a line (feature edges) or in a plane (boundary surfaces). The
+     * coordinates are kept one array per dimension and the sweep gathers over
+     * the CSR neighbor lists, so the loop over the points runs in parallel
+     * without atomics. Halo points are refreshed, and the largest move is
+     * reduced over the ranks, only every few sweeps in one exchange carrying
+     * all the components.
+     */
+    class GeomSmoother
+    {
+    public:
+        typedef enum
+        {
+            Smooth_Free = 0,    /*!< \brief The point moves freely. */
+            Smooth_Fixed = 1,   /*!< \brief The point does not move. */
+            Smooth_Line = 2,    /*!< \brief The point slides along a direction. */
+            Smooth_Plane = 3    /*!< \brief The point slides in the plane normal to a direction. */
+        } ConstraintType;
+
+        /*!
+         * \param[in] val_numDim - Number of dimensions of the problem.
+         */
+        GeomSmoother(unsigned short val_numDim);
+        ~GeomSmoother();
+
+        /*!
+         * \brief Set the point graph (copied); every point becomes free.
+         * \param[in] val_numPoint - Number of local points.
+         * \param[in] val_neighborPtr - CSR offsets of the neighbors (size val_numPoint+1).
+         * \param[in] val_neighbor - Neighbors of the points.
+         */
+        void SetGraph(unsigned long val_numPoint, const unsigned long* val_neighborPtr, const unsigned long* val_neighbor);
+
+        /*!
+         * \brief Constrain a point.
+         * \param[in] val_iPoint - Local point.
+         * \param[in] val_type - Kind of constraint.
+         * \param[in] val_direction - Line direction or plane normal (not needed for the other kinds).
+         */
+        void SetConstraint(unsigned long val_iPoint, ConstraintType val_type, const double* val_direction = NULL);
+
+        ConstraintType GetConstraint(unsigned long val_iPoint) const { return (ConstraintType)d_constraint[val_iPoint]; };
+
+        /*!
+         * \brief Exchange the halo points (and test the convergence) every val_frequency sweeps.
+         * \param[in] val_halo - Halo exchange of the points, NULL in serial.
+         * \param[in] val_frequency - Number of sweeps between two exchanges.
+         */
+        void SetHalo(GeomHaloExchange* val_halo, unsigned short val_frequency = 1);
+
+        /*!
+         * \brief Smooth the coordinates (collective when a halo exchange is set).
+         * \param[in,out] val_coord - Coordinates, <i>[iPoint*nDim+iDim]</i>.
+         * \param[in] val_numSweep - Largest number of sweeps.
+         * \param[in] val_coefficient - Relaxation factor c.
+         * \param[in] val_tolerance - Stop once no point moves more than this in a sweep (0 to do all the sweeps).
+         * \return Number of sweeps done.
+         */
+        unsigned long Smooth(double* val_coord, unsigned long val_numSweep, double val_coefficient, double val_tolerance = 0.0);
+
+        /*!
+         * \brief Largest move of a point in the last tested sweep, over all ranks.
+         */
+        double GetResidual() const { return d_residual; };
+
+    private:
+        double Sweep(double val_coefficient);
+        void ExchangeHalo();
+
+        unsigned short d_numDim;                    /*!< \brief Number of dimensions of the problem. */
+        unsigned long d_numPoint;                   /*!< \brief Number of local points. */
+        vector<unsigned long> d_neighborPtr;        /*!< \brief CSR offsets of the neighbors. */
+        vector<unsigned long> d_neighbor;           /*!< \brief Neighbors of the points. */
+        vector<unsigned char> d_constraint;         /*!< \brief Constraint of every point. */
+        vector<double> d_direction;                 /*!< \brief Unit direction of the constraint, <i>[iPoint*3+iDim]</i>. */
+
+        vector<double> d_coord0;                    /*!< \brief Coordinates before smoothing, <i>[iDim*nPoint+iPoint]</i>. */
+        vector<double> d_coord;                     /*!< \brief Current coordinates, <i>[iDim*nPoint+iPoint]</i>. */
+        vector<double> d_coordNew;                  /*!< \brief Coordinates after the sweep, <i>[iDim*nPoint+iPoint]</i>. */
+
+        GeomHaloExchange* d_halo;                   /*!< \brief Halo exchange (not owned). */
+        unsigned short d_frequency;                 /*!< \brief Sweeps between two exchanges. */
+        double d_residual;                          /*!< \brief Largest move in the last tested sweep. */
+    };
+}
+
+#endif
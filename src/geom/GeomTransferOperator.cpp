@@ -0,0 +1,243 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Restriction and prolongation between two agglomerated multigrid levels
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomTransferOperator.hpp"
+#include "const_def.h"
+#include "AriesMPI.hpp"
+
+#include <cmath>
+
+namespace ARIES
+{
+    /*!
+     * \brief Group signed (row, column) pairs by row, in the order of the pairs.
+     */
+    static void GeomTransferSetMap(unsigned long val_numRow, unsigned long val_numEntry, const unsigned long* val_row, const unsigned long* val_column,
+                                   const short* val_sign, vector<unsigned long>& val_ptr, vector<unsigned long>& val_entry, vector<double>& val_entrySign)
+    {
+        unsigned long iEntry, iRow;
+
+        val_ptr.assign(val_numRow + 1, 0);
+        for (iEntry = 0; iEntry < val_numEntry; iEntry++) val_ptr[val_row[iEntry] + 1]++;
+        for (iRow = 0; iRow < val_numRow; iRow++) val_ptr[iRow + 1] += val_ptr[iRow];
+
+        vector<unsigned long> position(val_ptr.begin(), val_ptr.end() - 1);
+        val_entry.resize(val_numEntry);
+        val_entrySign.resize(val_numEntry);
+        for (iEntry = 0; iEntry < val_numEntry; iEntry++)
+        {
+            unsigned long iPos = position[val_row[iEntry]]++;
+            val_entry[iPos] = val_column[iEntry];
+            val_entrySign[iPos] = (val_sign == NULL) ? 1.0 : double(val_sign[iEntry]);
+        }
+    }
+
+    /*!
+     * \brief Signed sums of the fine normals, with the null-area fix of the geometry.
+     */
+    static void GeomTransferSumNormal(unsigned short val_numDim, const vector<unsigned long>& val_ptr, const vector<unsigned long>& val_entry,
+                                      const vector<double>& val_entrySign, const double* val_fineNormal, double* val_coarseNormal)
+    {
+        long iRow, numRow = val_ptr.size() - 1;
+        const unsigned short nDim = val_numDim;
+
+#pragma omp parallel for schedule(static)
+        for (iRow = 0; iRow < numRow; iRow++)
+        {
+            double* normal = &val_coarseNormal[iRow*nDim];
+            double area = 0.0;
+            unsigned short iDim;
+            for (iDim = 0; iDim < nDim; iDim++) normal[iDim] = 0.0;
+            for (unsigned long iPos = val_ptr[iRow]; iPos < val_ptr[iRow + 1]; iPos++)
+            {
+                const double* fine = &val_fineNormal[val_entry[iPos]*nDim];
+                const double sign = val_entrySign[iPos];
+                for (iDim = 0; iDim < nDim; iDim++) normal[iDim] += sign*fine[iDim];
+            }
+            for (iDim = 0; iDim < nDim; iDim++) area += normal[iDim]*normal[iDim];
+            if (area == 0.0) for (iDim = 0; iDim < nDim; iDim++) normal[iDim] = EPS*EPS;
+        }
+    }
+
+    GeomTransferOperator::GeomTransferOperator()
+    {
+        d_childPtr.assign(1, 0);
+        d_edgePtr.assign(1, 0);
+        d_vertexPtr.assign(1, 0);
+    }
+
+    GeomTransferOperator::~GeomTransferOperator()
+    {
+    }
+
+    void GeomTransferOperator::SetTopology(unsigned long val_numFine, unsigned long val_numCoarse, const unsigned long* val_parent)
+    {
+        unsigned long iFine, iCoarse;
+
+        d_parent.assign(val_parent, val_parent + val_numFine);
+
+        /*--- Children of the coarse control volumes (count, then fill in the order of the fine points) ---*/
+        d_childPtr.assign(val_numCoarse + 1, 0);
+        for (iFine = 0; iFine < val_numFine; iFine++) d_childPtr[d_parent[iFine] + 1]++;
+        for (iCoarse = 0; iCoarse < val_numCoarse; iCoarse++) d_childPtr[iCoarse + 1] += d_childPtr[iCoarse];
+
+        vector<unsigned long> position(d_childPtr.begin(), d_childPtr.end() - 1);
+        d_child.resize(val_numFine);
+        for (iFine = 0; iFine < val_numFine; iFine++) d_child[position[d_parent[iFine]]++] = iFine;
+
+        /*--- Plain average until the volumes are known ---*/
+        d_weight.resize(val_numFine);
+        d_coarseVolume.assign(val_numCoarse, 0.0);
+        for (iCoarse = 0; iCoarse < val_numCoarse; iCoarse++)
+            for (unsigned long iPos = d_childPtr[iCoarse]; iPos < d_childPtr[iCoarse + 1]; iPos++)
+                d_weight[iPos] = 1.0 / (d_childPtr[iCoarse + 1] - d_childPtr[iCoarse]);
+    }
+
+    void GeomTransferOperator::SetVolume(const double* val_fineVolume)
+    {
+        long iCoarse, numCoarse = GetNumCoarse();
+
+#pragma omp parallel for schedule(static)
+        for (iCoarse = 0; iCoarse < numCoarse; iCoarse++)
+        {
+            unsigned long iPos, begin = d_childPtr[iCoarse], end = d_childPtr[iCoarse + 1];
+            double volume = 0.0;
+            for (iPos = begin; iPos < end; iPos++) volume += val_fineVolume[d_child[iPos]];
+            d_coarseVolume[iCoarse] = volume;
+            for (iPos = begin; iPos < end; iPos++)
+                d_weight[iPos] = (volume > 0.0) ? val_fineVolume[d_child[iPos]] / volume : 1.0 / (end - begin);
+        }
+    }
+
+    void GeomTransferOperator::Restrict(unsigned short val_numVar, const double* val_fine, double* val_coarse) const
+    {
+        long iCoarse, numCoarse = GetNumCoarse();
+        const unsigned short numVar = val_numVar;
+
+#pragma omp parallel for schedule(static)
+        for (iCoarse = 0; iCoarse < numCoarse; iCoarse++)
+        {
+            double* coarse = &val_coarse[iCoarse*numVar];
+            unsigned short iVar;
+            for (iVar = 0; iVar < numVar; iVar++) coarse[iVar] = 0.0;
+            for (unsigned long iPos = d_childPtr[iCoarse]; iPos < d_childPtr[iCoarse + 1]; iPos++)
+            {
+                const double* fine = &val_fine[d_child[iPos]*numVar];
+                const double weight = d_weight[iPos];
+                for (iVar = 0; iVar < numVar; iVar++) coarse[iVar] += weight*fine[iVar];
+            }
+        }
+    }
+
+    void GeomTransferOperator::RestrictSum(unsigned short val_numVar, const double* val_fine, double* val_coarse) const
+    {
+        long iCoarse, numCoarse = GetNumCoarse();
+        const unsigned short numVar = val_numVar;
+
+#pragma omp parallel for schedule(static)
+        for (iCoarse = 0; iCoarse < numCoarse; iCoarse++)
+        {
+            double* coarse = &val_coarse[iCoarse*numVar];
+            unsigned short iVar;
+            for (iVar = 0; iVar < numVar; iVar++) coarse[iVar] = 0.0;
+            for (unsigned long iPos = d_childPtr[iCoarse]; iPos < d_childPtr[iCoarse + 1]; iPos++)
+            {
+                const double* fine = &val_fine[d_child[iPos]*numVar];
+                for (iVar = 0; iVar < numVar; iVar++) coarse[iVar] += fine[iVar];
+            }
+        }
+    }
+
+    void GeomTransferOperator::Prolong(unsigned short val_numVar, const double* val_coarse, double* val_fine) const
+    {
+        long iFine, numFine = GetNumFine();
+        const unsigned short numVar = val_numVar;
+
+#pragma omp parallel for schedule(static)
+        for (iFine = 0; iFine < numFine; iFine++)
+        {
+            const double* coarse = &val_coarse[d_parent[iFine]*numVar];
+            double* fine = &val_fine[iFine*numVar];
+            for (unsigned short iVar = 0; iVar < numVar; iVar++) fine[iVar] = coarse[iVar];
+        }
+    }
+
+    void GeomTransferOperator::ProlongAdd(unsigned short val_numVar, const double* val_coarse, double* val_fine) const
+    {
+        long iFine, numFine = GetNumFine();
+        const unsigned short numVar = val_numVar;
+
+#pragma omp parallel for schedule(static)
+        for (iFine = 0; iFine < numFine; iFine++)
+        {
+            const double* coarse = &val_coarse[d_parent[iFine]*numVar];
+            double* fine = &val_fine[iFine*numVar];
+            for (unsigned short iVar = 0; iVar < numVar; iVar++) fine[iVar] += coarse[iVar];
+        }
+    }
+
+    void GeomTransferOperator::SetEdgeMap(unsigned long val_numCoarseEdge, unsigned long val_numEntry, const unsigned long* val_coarseEdge,
+                                          const unsigned long* val_fineEdge, const short* val_sign)
+    {
+        GeomTransferSetMap(val_numCoarseEdge, val_numEntry, val_coarseEdge, val_fineEdge, val_sign, d_edgePtr, d_edgeFine, d_edgeSign);
+    }
+
+    void GeomTransferOperator::SetVertexMap(unsigned long val_numCoarseVertex, unsigned long val_numEntry, const unsigned long* val_coarseVertex,
+                                            const unsigned long* val_fineVertex)
+    {
+        GeomTransferSetMap(val_numCoarseVertex, val_numEntry, val_coarseVertex, val_fineVertex, NULL, d_vertexPtr, d_vertexFine, d_vertexSign);
+    }
+
+    void GeomTransferOperator::RestrictEdgeNormal(unsigned short val_numDim, const double* val_fineNormal, double* val_coarseNormal) const
+    {
+        GeomTransferSumNormal(val_numDim, d_edgePtr, d_edgeFine, d_edgeSign, val_fineNormal, val_coarseNormal);
+    }
+
+    void GeomTransferOperator::RestrictVertexNormal(unsigned short val_numDim, const double* val_fineNormal, double* val_coarseNormal) const
+    {
+        GeomTransferSumNormal(val_numDim, d_vertexPtr, d_vertexFine, d_vertexSign, val_fineNormal, val_coarseNormal);
+    }
+
+    double GeomTransferOperator::Benchmark(unsigned short val_numVar, unsigned short val_numRepeat) const
+    {
+        unsigned long iValue, numFine = GetNumFine(), numCoarse = GetNumCoarse();
+        if ((numFine == 0) || (numCoarse == 0)) return 0.0;
+
+        vector<double> solution(numFine*val_numVar), residual(numFine*val_numVar);
+        vector<double> coarseSolution(numCoarse*val_numVar), coarseResidual(numCoarse*val_numVar);
+        for (iValue = 0; iValue < solution.size(); iValue++)
+        {
+            solution[iValue] = 1.0 + double(iValue % 97) / 97.0;
+            residual[iValue] = double(iValue % 89) / 89.0 - 0.5;
+        }
+
+        /*--- One V-cycle to warm up the caches ---*/
+        Restrict(val_numVar, &solution[0], &coarseSolution[0]);
+        RestrictSum(val_numVar, &residual[0], &coarseResidual[0]);
+        ProlongAdd(val_numVar, &coarseResidual[0], &solution[0]);
+
+        double start = AriesMPI::Wtime();
+        for (unsigned short iRepeat = 0; iRepeat < val_numRepeat; iRepeat++)
+        {
+            Restrict(val_numVar, &solution[0], &coarseSolution[0]);
+            RestrictSum(val_numVar, &residual[0], &coarseResidual[0]);
+            ProlongAdd(val_numVar, &coarseResidual[0], &solution[0]);
+        }
+        double elapsed = AriesMPI::Wtime() - start;
+
+        return (elapsed > 0.0) ? 3.0*double(numFine)*val_numVar*val_numRepeat / elapsed : 0.0;
+    }
+}
@@ -0,0 +1,146 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Restriction and prolongation between two agglomerated multigrid levels
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMTRANSFEROPERATOR_HPP
+#define ARIES_GEOMTRANSFEROPERATOR_HPP
+
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Transfer operators between a fine level and the coarse level agglomerated from it.
+     *
+     * The restriction is stored in CSR form, one row per coarse control volume
+     * with its children and their weights (volume of the child over volume of
+     * the parent), and the prolongation as the parent of every fine point, so
+     * neither operator goes through the point objects. Two more maps give the
+     * dual faces of a coarse level as signed sums of fine faces, one for the
+     * edges and one for the boundary vertices, so a moving mesh can update
+     * the coarse volumes, normals and velocities without redoing the
+     * agglomeration. Fields hold numVar values per point,
+     * <i>[iPoint*numVar+iVar]</i>; the kernels are threaded over the rows of
+     * the output and their inner loop over the variables is contiguous on
+     * both sides.
+     */
+    class GeomTransferOperator
+    {
+    public:
+        GeomTransferOperator();
+        ~GeomTransferOperator();
+
+        /*!
+         * \brief Set the agglomeration.
+         * \param[in] val_numFine - Number of fine points.
+         * \param[in] val_numCoarse - Number of coarse control volumes.
+         * \param[in] val_parent - Coarse control volume of every fine point.
+         */
+        void SetTopology(unsigned long val_numFine, unsigned long val_numCoarse, const unsigned long* val_parent);
+
+        /*!
+         * \brief Set the volumes of the fine points; computes the coarse volumes and the weights of the restriction.
+         */
+        void SetVolume(const double* val_fineVolume);
+
+        /*!
+         * \brief Volume-weighted average of a fine field on the coarse level (solution).
+         */
+        void Restrict(unsigned short val_numVar, const double* val_fine, double* val_coarse) const;
+
+        /*!
+         * \brief Sum of a fine field over the children (residuals, fluxes).
+         */
+        void RestrictSum(unsigned short val_numVar, const double* val_fine, double* val_coarse) const;
+
+        /*!
+         * \brief Copy of the coarse field to the children.
+         */
+        void Prolong(unsigned short val_numVar, const double* val_coarse, double* val_fine) const;
+
+        /*!
+         * \brief Addition of the coarse field to the children (coarse-grid correction).
+         */
+        void ProlongAdd(unsigned short val_numVar, const double* val_coarse, double* val_fine) const;
+
+        /*!
+         * \brief Set the fine edges whose dual faces make every coarse edge.
+         * \param[in] val_numCoarseEdge - Number of coarse edges.
+         * \param[in] val_numEntry - Number of (coarse edge, fine edge) pairs.
+         * \param[in] val_coarseEdge - Coarse edge of every pair.
+         * \param[in] val_fineEdge - Fine edge of every pair.
+         * \param[in] val_sign - Orientation of the fine face in the coarse face (+1 or -1).
+         */
+        void SetEdgeMap(unsigned long val_numCoarseEdge, unsigned long val_numEntry, const unsigned long* val_coarseEdge,
+                        const unsigned long* val_fineEdge, const short* val_sign);
+
+        /*!
+         * \brief Set the fine boundary vertices whose faces make every coarse boundary vertex (vertices numbered over all the markers).
+         */
+        void SetVertexMap(unsigned long val_numCoarseVertex, unsigned long val_numEntry, const unsigned long* val_coarseVertex,
+                          const unsigned long* val_fineVertex);
+
+        /*!
+         * \brief Coarse edge normals from the fine ones, <i>[iEdge*nDim+iDim]</i>; a null normal gets a tiny value, as in SetControlVolume.
+         */
+        void RestrictEdgeNormal(unsigned short val_numDim, const double* val_fineNormal, double* val_coarseNormal) const;
+
+        /*!
+         * \brief Coarse boundary normals from the fine ones, <i>[iVertex*nDim+iDim]</i>; a null normal gets a tiny value.
+         */
+        void RestrictVertexNormal(unsigned short val_numDim, const double* val_fineNormal, double* val_coarseNormal) const;
+
+        /*!
+         * \brief Time the transfers of one V-cycle between the two levels: restriction of the
+         *        solution and of the residual, then prolongation of the correction.
+         * \param[in] val_numVar - Number of variables per point.
+         * \param[in] val_numRepeat - Number of V-cycles timed.
+         * \return Fine point values (one variable at one point) moved per second by the three transfers.
+         *
+         * The fields are filled with a fixed pattern, so two runs on the same
+         * agglomeration do the same work on the same data.
+         */
+        double Benchmark(unsigned short val_numVar, unsigned short val_numRepeat) const;
+
+        unsigned long GetNumFine() const { return d_parent.size(); };
+        unsigned long GetNumCoarse() const { return d_childPtr.size() - 1; };
+        unsigned long GetParent(unsigned long val_iFine) const { return d_parent[val_iFine]; };
+        unsigned long GetNumChildren(unsigned long val_iCoarse) const { return d_childPtr[val_iCoarse + 1] - d_childPtr[val_iCoarse]; };
+        const unsigned long* GetChildren(unsigned long val_iCoarse) const { return &d_child[d_childPtr[val_iCoarse]]; };
+        const double* GetWeights(unsigned long val_iCoarse) const { return &d_weight[d_childPtr[val_iCoarse]]; };
+        double GetCoarseVolume(unsigned long val_iCoarse) const { return d_coarseVolume[val_iCoarse]; };
+        unsigned long GetNumCoarseEdge() const { return d_edgePtr.size() - 1; };
+        unsigned long GetNumCoarseVertex() const { return d_vertexPtr.size() - 1; };
+
+    private:
+        vector<unsigned long> d_parent;         /*!< \brief Coarse control volume of the fine points. */
+        vector<unsigned long> d_childPtr;       /*!< \brief CSR offsets of the children of the coarse control volumes. */
+        vector<unsigned long> d_child;          /*!< \brief Children of the coarse control volumes. */
+        vector<double> d_weight;                /*!< \brief Weights of the children in the restriction. */
+        vector<double> d_coarseVolume;          /*!< \brief Volumes of the coarse control volumes. */
+
+        vector<unsigned long> d_edgePtr;        /*!< \brief CSR offsets of the fine edges of the coarse edges. */
+        vector<unsigned long> d_edgeFine;       /*!< \brief Fine edges of the coarse edges. */
+        vector<double> d_edgeSign;              /*!< \brief Orientations of the fine edges. */
+        vector<unsigned long> d_vertexPtr;      /*!< \brief CSR offsets of the fine vertices of the coarse vertices. */
+        vector<unsigned long> d_vertexFine;     /*!< \brief Fine vertices of the coarse vertices. */
+        vector<double> d_vertexSign;            /*!< \brief Orientations of the fine vertices (all +1). */
+    };
+}
+
+#endif
@@ -16,6 +16,8 @@
 
 #include "GeomUtilities.hpp"
 
+#include "GeomKDTree.hpp"
+
 #include "const_def.h"
 #include "armath.h"
 
@@ -1121,267 +1123,208 @@ namespace ARIES
     
     void GEOM_Geometry::ComputeSurf_Curvature(TBOX::TBOX_Config *config)
     {
-        unsigned short iMarker, iNeigh_Point, iDim, iNode, iNeighbor_Nodes, Neighbor_Node;
-        unsigned long Neighbor_Point, iVertex, iPoint, jPoint, iElem_Bound, iEdge, nLocalVertex, MaxLocalVertex, *Buffer_Send_nVertex, *Buffer_Receive_nVertex, TotalnPointDomain;
+        unsigned short iMarker, iDim, iNode;
+        unsigned long iVertex, iPoint, iElem_Bound, iTria, nTria, nSurfPoint, nLocalVertex, TotalnPointDomain, iCritical, nCritical;
+        long iSurf;
         int iProcessor, nProcessor;
-        std::vector<unsigned long> Point_NeighborList, Elem_NeighborList, Point_Triangle, Point_Edge, Point_Critical;
-        std::vector<unsigned long>::iterator it;
-        double U[3] = { 0.0, 0.0, 0.0 }, V[3] = { 0.0, 0.0, 0.0 }, W[3] = { 0.0, 0.0, 0.0 }, Length_U, Length_V, Length_W, CosValue, Angle_Value, *K, *Angle_Defect, *Area_Vertex, *Angle_Alpha, *Angle_Beta, **NormalMeanK, MeanK, GaussK, MaxPrinK, cot_alpha, cot_beta, delta, X1, X2, X3, Y1, Y2, Y3, radius, *Buffer_Send_Coord, *Buffer_Receive_Coord, *Coord, Dist, MinDist, MaxK, MinK, SigmaK;
-        bool *Check_Edge;
+        std::vector<unsigned long> SurfPoint, Tria, Point_Critical;
+        std::vector<long> SurfIndex;
+        double *K, MeanK, MaxK, MinK, SigmaK;
         int rank;
 
 #ifndef HAVE_MPI
         rank = TBOX::MASTER_NODE;
+        nProcessor = 1;
 #else
         MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
 #endif
 
         /*--- Allocate surface curvature ---*/
         K = new double[nPoint];
+        for (iPoint = 0; iPoint < nPoint; iPoint++) K[iPoint] = 0.0;
 
-        if (nDim == 2)
+        /*--- Flat list of the points of the physical surfaces (each one once),
+          and the surface triangles ---*/
+        SurfIndex.assign(nPoint, -1);
+        for (iMarker = 0; iMarker < nMarker; iMarker++)
         {
-            /*--- Loop over all the markers ---*/
-            for (iMarker = 0; iMarker < nMarker; iMarker++)
+            if (config->GetMarker_All_KindBC(iMarker) != TBOX::SEND_RECEIVE)
             {
-                if (config->GetMarker_All_KindBC(iMarker) != TBOX::SEND_RECEIVE)
+                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
                 {
-                    /*--- Loop through all marker vertices again, this time also
-                      finding the neighbors of each node.---*/
-                    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+                    iPoint = vertex[iMarker][iVertex]->GetNode();
+                    if (SurfIndex[iPoint] == -1)
                     {
-                        iPoint = vertex[iMarker][iVertex]->GetNode();
-
-                        if (node[iPoint]->GetDomain())
-                        {
-                            /*--- Loop through neighbors. In 2-D, there should be 2 nodes on either
-                              side of this vertex that lie on the same surface. ---*/
-                            Point_Edge.clear();
+                        SurfIndex[iPoint] = SurfPoint.size();
+                        SurfPoint.push_back(iPoint);
+                    }
+                }
 
-                            for (iNeigh_Point = 0; iNeigh_Point < node[iPoint]->GetnPoint(); iNeigh_Point++)
-                            {
-                                Neighbor_Point = node[iPoint]->GetPoint(iNeigh_Point);
+                if (nDim == 3)
+                    for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++)
+                        if (bound[iMarker][iElem_Bound]->GetVTK_Type() == TBOX::TRIANGLE)
+                            for (iNode = 0; iNode < 3; iNode++)
+                                Tria.push_back(bound[iMarker][iElem_Bound]->GetNode(iNode));
+            }
+        }
+        nSurfPoint = SurfPoint.size();
+        nTria = Tria.size() / 3;
 
-                                /*--- Check if this neighbor lies on the surface. If so,
-                                  add to the list of neighbors. ---*/
-                                if (node[Neighbor_Point]->GetPhysicalBoundary())
-                                {
-                                    Point_Edge.push_back(Neighbor_Point);
-                                }
+        if (nDim == 2)
+        {
+            /*--- In 2-D, there should be 2 nodes on either side of a vertex
+              that lie on the same surface; compute the curvature from the three points. ---*/
+#pragma omp parallel for schedule(static)
+            for (iSurf = 0; iSurf < (long)nSurfPoint; iSurf++)
+            {
+                unsigned long Point = SurfPoint[iSurf], Point_Edge[2] = { 0, 0 }, Neighbor_Point;
+                unsigned short iNeigh_Point, nEdge_Point = 0;
+                double X1, X2, X3, Y1, Y2, Y3, radius;
 
-                            }
+                if (!node[Point]->GetDomain()) continue;
 
-                            if (Point_Edge.size() == 2)
-                            {
-                                /*--- Compute the curvature using three points ---*/
-                                X1 = node[iPoint]->GetCoord(0);
-                                X2 = node[Point_Edge[0]]->GetCoord(0);
-                                X3 = node[Point_Edge[1]]->GetCoord(0);
-                                Y1 = node[iPoint]->GetCoord(1);
-                                Y2 = node[Point_Edge[0]]->GetCoord(1);
-                                Y3 = node[Point_Edge[1]]->GetCoord(1);
-
-                                radius = sqrt(((X2 - X1)*(X2 - X1) + (Y2 - Y1)*(Y2 - Y1))*
-                                              ((X2 - X3)*(X2 - X3) + (Y2 - Y3)*(Y2 - Y3))*
-                                              ((X3 - X1)*(X3 - X1) + (Y3 - Y1)*(Y3 - Y1))) /
-                                        (2.0*fabs(X1*Y2 + X2*Y3 + X3*Y1 - X1*Y3 - X2*Y1 - X3*Y2));
-
-                                K[iPoint] = 1.0 / radius;
-                                node[iPoint]->SetCurvature(K[iPoint]);
-                            }
-                        }
+                for (iNeigh_Point = 0; iNeigh_Point < node[Point]->GetnPoint(); iNeigh_Point++)
+                {
+                    Neighbor_Point = node[Point]->GetPoint(iNeigh_Point);
+                    if (node[Neighbor_Point]->GetPhysicalBoundary())
+                    {
+                        if (nEdge_Point < 2) Point_Edge[nEdge_Point] = Neighbor_Point;
+                        nEdge_Point++;
                     }
                 }
+
+                if (nEdge_Point == 2)
+                {
+                    X1 = node[Point]->GetCoord(0);
+                    X2 = node[Point_Edge[0]]->GetCoord(0);
+                    X3 = node[Point_Edge[1]]->GetCoord(0);
+                    Y1 = node[Point]->GetCoord(1);
+                    Y2 = node[Point_Edge[0]]->GetCoord(1);
+                    Y3 = node[Point_Edge[1]]->GetCoord(1);
+
+                    radius = sqrt(((X2 - X1)*(X2 - X1) + (Y2 - Y1)*(Y2 - Y1))*
+                                  ((X2 - X3)*(X2 - X3) + (Y2 - Y3)*(Y2 - Y3))*
+                                  ((X3 - X1)*(X3 - X1) + (Y3 - Y1)*(Y3 - Y1))) /
+                            (2.0*fabs(X1*Y2 + X2*Y3 + X3*Y1 - X1*Y3 - X2*Y1 - X3*Y2));
+
+                    K[Point] = 1.0 / radius;
+                    node[Point]->SetCurvature(K[Point]);
+                }
             }
         }
         else
         {
-            Angle_Defect = new double[nPoint];
-            Area_Vertex = new double[nPoint];
-            for (iPoint = 0; iPoint < nPoint; iPoint++)
+            /*--- Surface triangles around every surface point, in CSR form, so the
+              angle defect and the mean curvature are gathered point by point
+              without any write conflict ---*/
+            std::vector<unsigned long> TriaPtr(nSurfPoint + 1, 0), TriaList(3*nTria);
+            for (iTria = 0; iTria < 3*nTria; iTria++) TriaPtr[SurfIndex[Tria[iTria]] + 1]++;
+            for (iSurf = 0; iSurf < (long)nSurfPoint; iSurf++) TriaPtr[iSurf + 1] += TriaPtr[iSurf];
+            std::vector<unsigned long> Fill(TriaPtr.begin(), TriaPtr.end() - 1);
+            for (iTria = 0; iTria < 3*nTria; iTria++) TriaList[Fill[SurfIndex[Tria[iTria]]]++] = iTria / 3;
+
+#pragma omp parallel for schedule(dynamic, 256)
+            for (iSurf = 0; iSurf < (long)nSurfPoint; iSurf++)
             {
-                Angle_Defect[iPoint] = 2 * TBOX::PI_NUMBER;
-                Area_Vertex[iPoint] = 0.0;
-            }
+                unsigned long Point = SurfPoint[iSurf], jTria, kTria, Corner[3], Neighbor[2];
+                unsigned short iCorner, jCorner, iNeighbor, nNeighbor, jNeighbor, kDim;
+                double Coord[3][3], U[3], V[3], W[3], Length_U, Length_V, Length_W, CosValue, Angle[3], CotAngle[3];
+                double Angle_Defect = 2 * TBOX::PI_NUMBER, Area_Vertex = 0.0, NormalMeanK[3] = { 0.0, 0.0, 0.0 };
+                double MeanK_Point, GaussK, delta;
 
-            Angle_Alpha = new double[nEdge];
-            Angle_Beta = new double[nEdge];
-            Check_Edge = new bool[nEdge];
-            for (iEdge = 0; iEdge < nEdge; iEdge++)
-            {
-                Angle_Alpha[iEdge] = 0.0;
-                Angle_Beta[iEdge] = 0.0;
-                Check_Edge[iEdge] = true;
-            }
+                /*--- Surface neighbors of the point with the cotangents of the angles facing the edges ---*/
+                std::vector<unsigned long> Neighbor_Point;
+                std::vector<double> Cot_Sum;
 
-            NormalMeanK = new double *[nPoint];
-            for (iPoint = 0; iPoint < nPoint; iPoint++)
-            {
-                NormalMeanK[iPoint] = new double[nDim];
-                for (iDim = 0; iDim < nDim; iDim++)
+                for (jTria = TriaPtr[iSurf]; jTria < TriaPtr[iSurf + 1]; jTria++)
                 {
-                    NormalMeanK[iPoint][iDim] = 0.0;
-                }
-            }
-
-            /*--- Loop over all the markers ---*/
-            for (iMarker = 0; iMarker < nMarker; iMarker++)
-            {
-                if (config->GetMarker_All_KindBC(iMarker) != TBOX::SEND_RECEIVE)
-                {
-                    /*--- Loop over all the boundary elements ---*/
-                    for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++)
+                    kTria = TriaList[jTria];
+                    for (iCorner = 0; iCorner < 3; iCorner++)
                     {
-                        /*--- Only triangles ---*/
-                        if (bound[iMarker][iElem_Bound]->GetVTK_Type() == TBOX::TRIANGLE)
-                        {
-                            /*--- Loop over all the nodes of the boundary element ---*/
-                            for (iNode = 0; iNode < bound[iMarker][iElem_Bound]->GetnNodes(); iNode++)
-                            {
-                                iPoint = bound[iMarker][iElem_Bound]->GetNode(iNode);
-
-                                Point_Triangle.clear();
-
-                                for (iNeighbor_Nodes = 0; iNeighbor_Nodes < bound[iMarker][iElem_Bound]->GetnNeighbor_Nodes(iNode); iNeighbor_Nodes++)
-                                {
-                                    Neighbor_Node = bound[iMarker][iElem_Bound]->GetNeighbor_Nodes(iNode, iNeighbor_Nodes);
-                                    Neighbor_Point = bound[iMarker][iElem_Bound]->GetNode(Neighbor_Node);
-                                    Point_Triangle.push_back(Neighbor_Point);
-                                }
-
-                                iEdge = FindEdge(Point_Triangle[0], Point_Triangle[1]);
-
-                                for (iDim = 0; iDim < nDim; iDim++) {
-                                    U[iDim] = node[Point_Triangle[0]]->GetCoord(iDim) - node[iPoint]->GetCoord(iDim);
-                                    V[iDim] = node[Point_Triangle[1]]->GetCoord(iDim) - node[iPoint]->GetCoord(iDim);
-                                }
-
-                                W[0] = 0.5*(U[1] * V[2] - U[2] * V[1]); W[1] = -0.5*(U[0] * V[2] - U[2] * V[0]); W[2] = 0.5*(U[0] * V[1] - U[1] * V[0]);
-
-                                Length_U = 0.0, Length_V = 0.0, Length_W = 0.0, CosValue = 0.0;
-                                for (iDim = 0; iDim < nDim; iDim++) { Length_U += U[iDim] * U[iDim]; Length_V += V[iDim] * V[iDim]; Length_W += W[iDim] * W[iDim]; }
-                                Length_U = sqrt(Length_U); Length_V = sqrt(Length_V); Length_W = sqrt(Length_W);
-                                for (iDim = 0; iDim < nDim; iDim++) { U[iDim] /= Length_U; V[iDim] /= Length_V; CosValue += U[iDim] * V[iDim]; }
-                                if (CosValue >= 1.0) CosValue = 1.0;
-                                if (CosValue <= -1.0) CosValue = -1.0;
-
-                                Angle_Value = acos(CosValue);
-                                Area_Vertex[iPoint] += Length_W;
-                                Angle_Defect[iPoint] -= Angle_Value;
-                                if (Angle_Alpha[iEdge] == 0.0) Angle_Alpha[iEdge] = Angle_Value;
-                                else Angle_Beta[iEdge] = Angle_Value;
-                            }
-                        }
+                        Corner[iCorner] = Tria[3*kTria + iCorner];
+                        for (kDim = 0; kDim < 3; kDim++) Coord[iCorner][kDim] = node[Corner[iCorner]]->GetCoord(kDim);
                     }
-                }
-            }
 
-            /*--- Compute mean curvature ---*/
-            for (iMarker = 0; iMarker < nMarker; iMarker++)
-            {
-                if (config->GetMarker_All_KindBC(iMarker) != TBOX::SEND_RECEIVE)
-                {
-                    for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++)
+                    /*--- Angles of the three corners and area of the triangle ---*/
+                    for (iCorner = 0; iCorner < 3; iCorner++)
                     {
-                        if (bound[iMarker][iElem_Bound]->GetVTK_Type() == TBOX::TRIANGLE)
+                        const double *Coord_0 = Coord[iCorner], *Coord_1 = Coord[(iCorner + 1) % 3], *Coord_2 = Coord[(iCorner + 2) % 3];
+                        for (kDim = 0; kDim < 3; kDim++)
                         {
-                            for (iNode = 0; iNode < bound[iMarker][iElem_Bound]->GetnNodes(); iNode++)
-                            {
-                                iPoint = bound[iMarker][iElem_Bound]->GetNode(iNode);
-
-                                for (iNeighbor_Nodes = 0; iNeighbor_Nodes < bound[iMarker][iElem_Bound]->GetnNeighbor_Nodes(iNode); iNeighbor_Nodes++)
-                                {
-                                    Neighbor_Node = bound[iMarker][iElem_Bound]->GetNeighbor_Nodes(iNode, iNeighbor_Nodes);
-                                    jPoint = bound[iMarker][iElem_Bound]->GetNode(Neighbor_Node);
-
-                                    iEdge = FindEdge(iPoint, jPoint);
-
-                                    if (Check_Edge[iEdge])
-                                    {
+                            U[kDim] = Coord_1[kDim] - Coord_0[kDim];
+                            V[kDim] = Coord_2[kDim] - Coord_0[kDim];
+                        }
 
-                                        Check_Edge[iEdge] = false;
+                        W[0] = 0.5*(U[1] * V[2] - U[2] * V[1]); W[1] = -0.5*(U[0] * V[2] - U[2] * V[0]); W[2] = 0.5*(U[0] * V[1] - U[1] * V[0]);
 
-                                        if (tan(Angle_Alpha[iEdge]) != 0.0) cot_alpha = 1.0 / tan(Angle_Alpha[iEdge]); else cot_alpha = 0.0;
-                                        if (tan(Angle_Beta[iEdge]) != 0.0) cot_beta = 1.0 / tan(Angle_Beta[iEdge]); else cot_beta = 0.0;
+                        Length_U = 0.0, Length_V = 0.0, Length_W = 0.0, CosValue = 0.0;
+                        for (kDim = 0; kDim < 3; kDim++) { Length_U += U[kDim] * U[kDim]; Length_V += V[kDim] * V[kDim]; Length_W += W[kDim] * W[kDim]; }
+                        Length_U = sqrt(Length_U); Length_V = sqrt(Length_V); Length_W = sqrt(Length_W);
+                        for (kDim = 0; kDim < 3; kDim++) CosValue += U[kDim] * V[kDim] / (Length_U*Length_V);
+                        if (CosValue >= 1.0) CosValue = 1.0;
+                        if (CosValue <= -1.0) CosValue = -1.0;
 
-                                        /*--- iPoint, and jPoint ---*/
-                                        for (iDim = 0; iDim < nDim; iDim++)
-                                        {
-                                            if (Area_Vertex[iPoint] != 0.0) NormalMeanK[iPoint][iDim] += 3.0 * (cot_alpha + cot_beta) * (node[iPoint]->GetCoord(iDim) - node[jPoint]->GetCoord(iDim)) / Area_Vertex[iPoint];
-                                            if (Area_Vertex[jPoint] != 0.0) NormalMeanK[jPoint][iDim] += 3.0 * (cot_alpha + cot_beta) * (node[jPoint]->GetCoord(iDim) - node[iPoint]->GetCoord(iDim)) / Area_Vertex[jPoint];
-                                        }
-                                    }
-                                }
-                            }
-                        }
+                        Angle[iCorner] = acos(CosValue);
+                        CotAngle[iCorner] = (tan(Angle[iCorner]) != 0.0) ? 1.0 / tan(Angle[iCorner]) : 0.0;
+                        if (Corner[iCorner] == Point) Area_Vertex += Length_W;
                     }
-                }
-            }
 
-            /*--- Compute Gauss, mean, max and min principal curvature,
-              and set the list of critical points ---*/
+                    for (iCorner = 0; iCorner < 3; iCorner++)
+                        if (Corner[iCorner] == Point) break;
+                    Angle_Defect -= Angle[iCorner];
 
-            for (iMarker = 0; iMarker < nMarker; iMarker++)
-            {
-                if (config->GetMarker_All_KindBC(iMarker) != TBOX::SEND_RECEIVE)
-                {
-                    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+                    /*--- The edge to the next corner faces the previous one, and conversely ---*/
+                    Neighbor[0] = Corner[(iCorner + 1) % 3];
+                    Neighbor[1] = Corner[(iCorner + 2) % 3];
+                    for (iNeighbor = 0; iNeighbor < 2; iNeighbor++)
                     {
-                        iPoint = vertex[iMarker][iVertex]->GetNode();
-
-                        if (node[iPoint]->GetDomain())
+                        jCorner = (iCorner + 2 - iNeighbor) % 3;
+                        nNeighbor = Neighbor_Point.size();
+                        for (jNeighbor = 0; jNeighbor < nNeighbor; jNeighbor++)
+                            if (Neighbor_Point[jNeighbor] == Neighbor[iNeighbor]) break;
+                        if (jNeighbor == nNeighbor)
                         {
+                            Neighbor_Point.push_back(Neighbor[iNeighbor]);
+                            Cot_Sum.push_back(0.0);
+                        }
+                        Cot_Sum[jNeighbor] += CotAngle[jCorner];
+                    }
+                }
 
-                            if (Area_Vertex[iPoint] != 0.0) GaussK = 3.0*Angle_Defect[iPoint] / Area_Vertex[iPoint];
-                            else GaussK = 0.0;
+                /*--- Mean curvature normal ---*/
+                if (Area_Vertex != 0.0)
+                    for (jNeighbor = 0; jNeighbor < Neighbor_Point.size(); jNeighbor++)
+                        for (kDim = 0; kDim < 3; kDim++)
+                            NormalMeanK[kDim] += 3.0 * Cot_Sum[jNeighbor] * (node[Point]->GetCoord(kDim) - node[Neighbor_Point[jNeighbor]]->GetCoord(kDim)) / Area_Vertex;
 
-                            MeanK = 0.0;
-                            for (iDim = 0; iDim < nDim; iDim++)
-                                MeanK += NormalMeanK[iPoint][iDim] * NormalMeanK[iPoint][iDim];
-                            MeanK = sqrt(MeanK);
+                /*--- Gauss, mean and max principal curvature ---*/
+                if (!node[Point]->GetDomain()) continue;
 
-                            delta = std::max((MeanK*MeanK - GaussK), 0.0);
+                if (Area_Vertex != 0.0) GaussK = 3.0*Angle_Defect / Area_Vertex;
+                else GaussK = 0.0;
 
-                            MaxPrinK = MeanK + sqrt(delta);
+                MeanK_Point = sqrt(NormalMeanK[0] * NormalMeanK[0] + NormalMeanK[1] * NormalMeanK[1] + NormalMeanK[2] * NormalMeanK[2]);
+                delta = std::max((MeanK_Point*MeanK_Point - GaussK), 0.0);
 
-                            /*--- Store the curvature value ---*/
-                            K[iPoint] = MaxPrinK;
-                            node[iPoint]->SetCurvature(K[iPoint]);
-                        }
-                    }
-                }
+                K[Point] = MeanK_Point + sqrt(delta);
+                node[Point]->SetCurvature(K[Point]);
             }
-
-            delete[] Angle_Defect;
-            delete[] Area_Vertex;
-            delete[] Angle_Alpha;
-            delete[] Angle_Beta;
-            delete[] Check_Edge;
-
-            for (iPoint = 0; iPoint < nPoint; iPoint++)
-                delete NormalMeanK[iPoint];
-            delete[] NormalMeanK;
         }
 
         /*--- Sharp edge detection is based in the statistical
           distribution of the curvature ---*/
 
-        MaxK = K[0]; MinK = K[0]; MeanK = 0.0; TotalnPointDomain = 0;
-        for (iMarker = 0; iMarker < nMarker; iMarker++)
+        MaxK = 0.0; MinK = 1E20; MeanK = 0.0; TotalnPointDomain = 0;
+        for (iSurf = 0; iSurf < (long)nSurfPoint; iSurf++)
         {
-            if (config->GetMarker_All_KindBC(iMarker) != TBOX::SEND_RECEIVE)
+            iPoint = SurfPoint[iSurf];
+            if (node[iPoint]->GetDomain())
             {
-                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
-                {
-                    iPoint = vertex[iMarker][iVertex]->GetNode();
-                    if (node[iPoint]->GetDomain())
-                    {
-                        MaxK = std::max(MaxK, fabs(K[iPoint]));
-                        MinK = std::min(MinK, fabs(K[iPoint]));
-                        MeanK += fabs(K[iPoint]);
-                        TotalnPointDomain++;
-                    }
-                }
+                MaxK = std::max(MaxK, fabs(K[iPoint]));
+                MinK = std::min(MinK, fabs(K[iPoint]));
+                MeanK += fabs(K[iPoint]);
+                TotalnPointDomain++;
             }
         }
 
@@ -1399,19 +1342,11 @@ namespace ARIES
 
         /*--- Compute the standard deviation ---*/
         SigmaK = 0.0;
-        for (iMarker = 0; iMarker < nMarker; iMarker++)
+        for (iSurf = 0; iSurf < (long)nSurfPoint; iSurf++)
         {
-            if (config->GetMarker_All_KindBC(iMarker) != TBOX::SEND_RECEIVE)
-            {
-                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
-                {
-                    iPoint = vertex[iMarker][iVertex]->GetNode();
-                    if (node[iPoint]->GetDomain())
-                    {
-                        SigmaK += (fabs(K[iPoint]) - MeanK) * (fabs(K[iPoint]) - MeanK);
-                    }
-                }
-            }
+            iPoint = SurfPoint[iSurf];
+            if (node[iPoint]->GetDomain())
+                SigmaK += (fabs(K[iPoint]) - MeanK) * (fabs(K[iPoint]) - MeanK);
         }
 
 #ifdef HAVE_MPI
@@ -1424,123 +1359,56 @@ namespace ARIES
         if (rank == TBOX::MASTER_NODE)
             std::cout << "Max K: " << MaxK << ". Mean K: " << MeanK << ". Standard deviation K: " << SigmaK << "." << std::endl;
 
-        Point_Critical.clear();
-
-        for (iMarker = 0; iMarker < nMarker; iMarker++)
+        /*--- Coordinates of the critical points of this partition ---*/
+        std::vector<double> Buffer_Send_Coord;
+        for (iSurf = 0; iSurf < (long)nSurfPoint; iSurf++)
         {
-            if (config->GetMarker_All_KindBC(iMarker) != TBOX::SEND_RECEIVE)
+            iPoint = SurfPoint[iSurf];
+            if (node[iPoint]->GetDomain() && (fabs(K[iPoint]) > MeanK + config->GetRefSharpEdges()*SigmaK))
             {
-                for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
-                {
-                    iPoint = vertex[iMarker][iVertex]->GetNode();
-                    if (node[iPoint]->GetDomain())
-                    {
-                        if (fabs(K[iPoint]) > MeanK + config->GetRefSharpEdges()*SigmaK)
-                        {
-                            Point_Critical.push_back(iPoint);
-                        }
-                    }
-                }
+                Point_Critical.push_back(iPoint);
+                for (iDim = 0; iDim < nDim; iDim++)
+                    Buffer_Send_Coord.push_back(node[iPoint]->GetCoord(iDim));
             }
         }
-
-        /*--- Variables and buffers needed for MPI ---*/
-#ifdef HAVE_MPI
-        MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
-#else
-        nProcessor = 1;
-#endif
-        Buffer_Send_nVertex = new unsigned long[1];
-        Buffer_Receive_nVertex = new unsigned long[nProcessor];
-
-        /*--- Count the total number of critical edge nodes. ---*/
         nLocalVertex = Point_Critical.size();
-        Buffer_Send_nVertex[0] = nLocalVertex;
 
-        /*--- Communicate to all processors the total number of critical edge nodes. ---*/
+        /*--- Gather the critical points of all the partitions, with their exact counts ---*/
+        std::vector<int> Buffer_Receive_nCoord(nProcessor, 0), Displ_Coord(nProcessor + 1, 0);
+        Buffer_Receive_nCoord[0] = int(nLocalVertex*nDim);
 #ifdef HAVE_MPI
-        MaxLocalVertex = 0;
-        MPI_Allreduce(&nLocalVertex, &MaxLocalVertex, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-        MPI_Allgather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-#else
-        MaxLocalVertex = nLocalVertex;
-        Buffer_Receive_nVertex[0] = nLocalVertex;
-#endif
-
-
-        /*--- Create and initialize to zero some buffers to hold the coordinates
-          of the boundary nodes that are communicated from each partition (all-to-all). ---*/
-
-        Buffer_Send_Coord = new double[MaxLocalVertex*nDim];
-        Buffer_Receive_Coord = new double[nProcessor*MaxLocalVertex*nDim];
-
-#ifdef HAVE_MPI
-        unsigned long nBuffer = MaxLocalVertex*nDim;
+        int nLocalCoord = int(nLocalVertex*nDim);
+        MPI_Allgather(&nLocalCoord, 1, MPI_INT, &Buffer_Receive_nCoord[0], 1, MPI_INT, MPI_COMM_WORLD);
 #endif
+        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+            Displ_Coord[iProcessor + 1] = Displ_Coord[iProcessor] + Buffer_Receive_nCoord[iProcessor];
+        nCritical = Displ_Coord[nProcessor] / nDim;
 
-        for (iVertex = 0; iVertex < MaxLocalVertex; iVertex++)
-        {
-            for (iDim = 0; iDim < nDim; iDim++)
-            {
-                Buffer_Send_Coord[iVertex*nDim + iDim] = 0.0;
-            }
-        }
-
-        /*--- Retrieve and store the coordinates of the sharp edges boundary nodes on
-          the local partition and broadcast them to all partitions. ---*/
-
-        for (iVertex = 0; iVertex < Point_Critical.size(); iVertex++)
-        {
-            iPoint = Point_Critical[iVertex];
-            for (iDim = 0; iDim < nDim; iDim++)
-                Buffer_Send_Coord[iVertex*nDim + iDim] = node[iPoint]->GetCoord(iDim);
-        }
-
+        std::vector<double> Buffer_Receive_Coord(Displ_Coord[nProcessor] + 1);
+        Buffer_Send_Coord.push_back(0.0);
 #ifdef HAVE_MPI
-        MPI_Allgather(Buffer_Send_Coord, nBuffer, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer, MPI_DOUBLE, MPI_COMM_WORLD);
+        MPI_Allgatherv(&Buffer_Send_Coord[0], nLocalCoord, MPI_DOUBLE, &Buffer_Receive_Coord[0],
+                       &Buffer_Receive_nCoord[0], &Displ_Coord[0], MPI_DOUBLE, MPI_COMM_WORLD);
 #else
-        for (iVertex = 0; iVertex < Point_Critical.size(); iVertex++)
-        {
-            for (iDim = 0; iDim < nDim; iDim++)
-            {
-                Buffer_Receive_Coord[iVertex*nDim + iDim] = Buffer_Send_Coord[iVertex*nDim + iDim];
-            }
-        }
+        for (iCritical = 0; iCritical < nCritical*nDim; iCritical++)
+            Buffer_Receive_Coord[iCritical] = Buffer_Send_Coord[iCritical];
 #endif
 
-        /*--- Loop over all interior mesh nodes on the local partition and compute
-          the distances to each of the no-slip boundary nodes in the entire mesh.
-          Store the minimum distance to the wall for each interior mesh node. ---*/
+        /*--- Distance of every point of the partition to the closest critical point,
+          found in a k-d tree of the critical points ---*/
+        GeomKDTree Critical_Tree(nDim);
+        Critical_Tree.Build(nCritical, &Buffer_Receive_Coord[0]);
 
-        for (iPoint = 0; iPoint < GetnPoint(); iPoint++)
+        long jPoint;
+#pragma omp parallel for schedule(dynamic, 1024)
+        for (jPoint = 0; jPoint < (long)GetnPoint(); jPoint++)
         {
-            Coord = node[iPoint]->GetCoord();
-
-            MinDist = 1E20;
-            for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
-            {
-                for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++)
-                {
-                    Dist = 0.0;
-                    for (iDim = 0; iDim < nDim; iDim++)
-                    {
-                        Dist += (Coord[iDim] - Buffer_Receive_Coord[(iProcessor*MaxLocalVertex + iVertex)*nDim + iDim])*
-                                (Coord[iDim] - Buffer_Receive_Coord[(iProcessor*MaxLocalVertex + iVertex)*nDim + iDim]);
-                    }
-                    Dist = sqrt(Dist);
-                    if (Dist < MinDist) MinDist = Dist;
-                }
-            }
-            node[iPoint]->SetSharpEdge_Distance(MinDist);
+            double MinDist = 1E20;
+            if (nCritical > 0) Critical_Tree.FindNearest(node[jPoint]->GetCoord(), MinDist);
+            node[jPoint]->SetSharpEdge_Distance(MinDist);
         }
 
         /*--- Deallocate Max curvature ---*/
         delete[] K;
-
-        /*--- Deallocate the buffers needed for the MPI communication. ---*/
-        delete[] Buffer_Send_Coord;
-        delete[] Buffer_Receive_Coord;
-        delete[] Buffer_Send_nVertex;
-        delete[] Buffer_Receive_nVertex;
     }
 }
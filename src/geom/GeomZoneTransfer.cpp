@@ -0,0 +1,710 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Sparse interpolation operator between the surfaces of two zones
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+#include "GeomZoneTransfer.hpp"
+#include "GeomKDTree.hpp"
+
+#include "AriesMPI.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+
+namespace ARIES
+{
+    GeomZoneTransfer::GeomZoneTransfer(unsigned short val_numDim, double val_tolerance)
+    {
+        d_numDim = val_numDim;
+        d_tolerance = val_tolerance;
+        d_kind = Transfer_Nearest;
+        d_donor.numPoint = 0;
+        d_target.numPoint = 0;
+        d_maxDist = 0.0;
+        d_numUnmatched = 0;
+    }
+
+    GeomZoneTransfer::~GeomZoneTransfer()
+    {
+    }
+
+    void GeomZoneTransfer::SetDonorSurface(unsigned long val_numPoint, const double* val_coord, unsigned long val_numElem,
+                                           const unsigned long* val_elemPtr, const unsigned long* val_elemNode, const unsigned long* val_tag)
+    {
+        d_donor.numPoint = val_numPoint;
+        d_donor.coord.assign(val_coord, val_coord + val_numPoint*d_numDim);
+        d_donor.tag.resize(val_numPoint);
+        for (unsigned long iPoint = 0; iPoint < val_numPoint; iPoint++)
+            d_donor.tag[iPoint] = (val_tag != NULL) ? val_tag[iPoint] : iPoint;
+        d_donor.elemPtr.assign(1, 0);
+        d_donor.elemNode.clear();
+        if (val_elemPtr != NULL)
+        {
+            d_donor.elemPtr.assign(val_elemPtr, val_elemPtr + val_numElem + 1);
+            d_donor.elemNode.assign(val_elemNode, val_elemNode + val_elemPtr[val_numElem]);
+        }
+    }
+
+    void GeomZoneTransfer::SetTargetSurface(unsigned long val_numPoint, const double* val_coord, unsigned long val_numElem,
+                                            const unsigned long* val_elemPtr, const unsigned long* val_elemNode)
+    {
+        d_target.numPoint = val_numPoint;
+        d_target.coord.assign(val_coord, val_coord + val_numPoint*d_numDim);
+        d_target.tag.resize(val_numPoint);
+        for (unsigned long iPoint = 0; iPoint < val_numPoint; iPoint++) d_target.tag[iPoint] = iPoint;
+        d_target.elemPtr.assign(1, 0);
+        d_target.elemNode.clear();
+        if (val_elemPtr != NULL)
+        {
+            d_target.elemPtr.assign(val_elemPtr, val_elemPtr + val_numElem + 1);
+            d_target.elemNode.assign(val_elemNode, val_elemNode + val_elemPtr[val_numElem]);
+        }
+    }
+
+    void GeomZoneTransfer::Exchange(const vector<double>& val_send, const vector<int>& val_sendCount,
+                                    vector<double>& val_recv, const vector<int>& val_recvCount) const
+    {
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        int iRank, size = (int)val_sendCount.size();
+
+        if (size <= 1)
+        {
+            val_recv = val_send;
+            return;
+        }
+
+        vector<int> sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+        for (iRank = 0; iRank < size; iRank++)
+        {
+            sendDispl[iRank + 1] = sendDispl[iRank] + val_sendCount[iRank];
+            recvDispl[iRank + 1] = recvDispl[iRank] + val_recvCount[iRank];
+        }
+
+        vector<double> send(val_send);
+        send.push_back(0.0);
+        val_recv.resize(recvDispl[size] + 1);
+        mpi.Alltoallv(&send[0], const_cast<int*>(&val_sendCount[0]), &sendDispl[0], MPI_DOUBLE,
+                      &val_recv[0], const_cast<int*>(&val_recvCount[0]), &recvDispl[0], MPI_DOUBLE);
+        val_recv.resize(recvDispl[size]);
+    }
+
+    void GeomZoneTransfer::Exchange(const vector<unsigned long>& val_send, const vector<int>& val_sendCount,
+                                    vector<unsigned long>& val_recv, const vector<int>& val_recvCount) const
+    {
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        int iRank, size = (int)val_sendCount.size();
+
+        if (size <= 1)
+        {
+            val_recv = val_send;
+            return;
+        }
+
+        vector<int> sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+        for (iRank = 0; iRank < size; iRank++)
+        {
+            sendDispl[iRank + 1] = sendDispl[iRank] + val_sendCount[iRank];
+            recvDispl[iRank + 1] = recvDispl[iRank] + val_recvCount[iRank];
+        }
+
+        vector<unsigned long> send(val_send);
+        send.push_back(0);
+        val_recv.resize(recvDispl[size] + 1);
+        mpi.Alltoallv(&send[0], const_cast<int*>(&val_sendCount[0]), &sendDispl[0], MPI_UNSIGNED_LONG,
+                      &val_recv[0], const_cast<int*>(&val_recvCount[0]), &recvDispl[0], MPI_UNSIGNED_LONG);
+        val_recv.resize(recvDispl[size]);
+    }
+
+    void GeomZoneTransfer::Build(TransferKind val_kind)
+    {
+        unsigned long iRow, iEntry;
+
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        int size = mpi.GetSize();
+
+        d_kind = val_kind;
+
+        vector<unsigned long> rowPtr, point;
+        vector<int> rank;
+        vector<double> weight;
+
+        if (d_kind != Transfer_Conservative)
+        {
+            Interpolate(d_donor, d_target, d_kind == Transfer_Isoparametric, rowPtr, rank, point, weight);
+            SetCommPattern(rowPtr, rank, point, weight);
+            return;
+        }
+
+        /*--- Conservative: interpolate the target surface on the donor points, and use the
+        transpose, so that every donor value is spread over the targets with weights summing to one ---*/
+        Interpolate(d_target, d_donor, true, rowPtr, rank, point, weight);
+        d_nearestPoint.clear();
+        d_nearestRank.clear();
+        d_nearestDist.clear();
+
+        int myRank = (size > 1) ? mpi.GetRank() : 0;
+        int iRank;
+        vector<int> sendCount(size, 0), recvCount(size, 0);
+        for (iEntry = 0; iEntry < rank.size(); iEntry++) sendCount[rank[iEntry]]++;
+
+        vector<int> sendDispl(size + 1, 0);
+        for (iRank = 0; iRank < size; iRank++) sendDispl[iRank + 1] = sendDispl[iRank] + sendCount[iRank];
+
+        /*--- Every entry goes to the owner of its target point: (target, donor, weight) ---*/
+        vector<unsigned long> sendTarget(rank.size()), sendDonor(rank.size());
+        vector<double> sendWeight(rank.size());
+        vector<int> fill(sendDispl.begin(), sendDispl.end() - 1);
+        for (iRow = 0; iRow + 1 < rowPtr.size(); iRow++)
+        {
+            for (iEntry = rowPtr[iRow]; iEntry < rowPtr[iRow + 1]; iEntry++)
+            {
+                int pos = fill[rank[iEntry]]++;
+                sendTarget[pos] = point[iEntry];
+                sendDonor[pos] = iRow;
+                sendWeight[pos] = weight[iEntry];
+            }
+        }
+
+        if (size > 1) mpi.Alltoall(&sendCount[0], 1, MPI_INT, &recvCount[0], 1, MPI_INT);
+        else recvCount = sendCount;
+
+        vector<unsigned long> recvTarget, recvDonor;
+        vector<double> recvWeight;
+        Exchange(sendTarget, sendCount, recvTarget, recvCount);
+        Exchange(sendDonor, sendCount, recvDonor, recvCount);
+        Exchange(sendWeight, sendCount, recvWeight, recvCount);
+
+        /*--- Rows of the transposed matrix, one per local target ---*/
+        vector<unsigned long> rowPtrT(d_target.numPoint + 1, 0);
+        for (iEntry = 0; iEntry < recvTarget.size(); iEntry++) rowPtrT[recvTarget[iEntry] + 1]++;
+        for (iRow = 0; iRow < d_target.numPoint; iRow++) rowPtrT[iRow + 1] += rowPtrT[iRow];
+
+        vector<unsigned long> pointT(recvTarget.size());
+        vector<int> rankT(recvTarget.size());
+        vector<double> weightT(recvTarget.size());
+        vector<unsigned long> fillT(rowPtrT.begin(), rowPtrT.end() - 1);
+        unsigned long iRecv = 0;
+        for (iRank = 0; iRank < size; iRank++)
+        {
+            for (int iCount = 0; iCount < recvCount[iRank]; iCount++, iRecv++)
+            {
+                unsigned long pos = fillT[recvTarget[iRecv]]++;
+                pointT[pos] = recvDonor[iRecv];
+                rankT[pos] = (size > 1) ? iRank : myRank;
+                weightT[pos] = recvWeight[iRecv];
+            }
+        }
+
+        SetCommPattern(rowPtrT, rankT, pointT, weightT);
+    }
+
+    void GeomZoneTransfer::Interpolate(const Surface& val_source, const Surface& val_query, bool val_useElement,
+                                       vector<unsigned long>& val_rowPtr, vector<int>& val_rank,
+                                       vector<unsigned long>& val_point, vector<double>& val_weight)
+    {
+        unsigned long iPoint, iElem, iNode, iQuery;
+        unsigned short iDim;
+        int iRank;
+
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        int size = mpi.GetSize();
+        int myRank = (size > 1) ? mpi.GetRank() : 0;
+
+        /*--- Pieces that are sent around: the elements, or every point alone for the nearest transfer ---*/
+        unsigned long nPiece = val_useElement ? val_source.elemPtr.size() - 1 : val_source.numPoint;
+        vector<unsigned long> piecePtr, pieceNode;
+        if (val_useElement)
+        {
+            piecePtr = val_source.elemPtr;
+            pieceNode = val_source.elemNode;
+
+            /*--- Points that belong to no element still take part as single point pieces ---*/
+            vector<bool> inElem(val_source.numPoint, false);
+            for (iNode = 0; iNode < pieceNode.size(); iNode++) inElem[pieceNode[iNode]] = true;
+            for (iPoint = 0; iPoint < val_source.numPoint; iPoint++)
+            {
+                if (inElem[iPoint]) continue;
+                pieceNode.push_back(iPoint);
+                piecePtr.push_back(pieceNode.size());
+                nPiece++;
+            }
+        }
+        else
+        {
+            piecePtr.resize(nPiece + 1);
+            pieceNode.resize(nPiece);
+            for (iPoint = 0; iPoint <= nPiece; iPoint++) piecePtr[iPoint] = iPoint;
+            for (iPoint = 0; iPoint < nPiece; iPoint++) pieceNode[iPoint] = iPoint;
+        }
+
+        /*--- Bounding box of the local queries, inflated by the tolerance ---*/
+        const int nBox = 2*d_numDim;
+        vector<double> globalBox(nBox*size);
+        for (iDim = 0; iDim < d_numDim; iDim++)
+        {
+            globalBox[myRank*nBox + iDim] = numeric_limits<double>::max();
+            globalBox[myRank*nBox + d_numDim + iDim] = -numeric_limits<double>::max();
+        }
+        for (iQuery = 0; iQuery < val_query.numPoint; iQuery++)
+        {
+            for (iDim = 0; iDim < d_numDim; iDim++)
+            {
+                double coord = val_query.coord[iQuery*d_numDim + iDim];
+                globalBox[myRank*nBox + iDim] = min(globalBox[myRank*nBox + iDim], coord - d_tolerance);
+                globalBox[myRank*nBox + d_numDim + iDim] = max(globalBox[myRank*nBox + d_numDim + iDim], coord + d_tolerance);
+            }
+        }
+        if (size > 1)
+        {
+            vector<double> localBox(globalBox.begin() + myRank*nBox, globalBox.begin() + (myRank + 1)*nBox);
+            mpi.Allgather(&localBox[0], nBox, MPI_DOUBLE, &globalBox[0], nBox, MPI_DOUBLE);
+        }
+
+        /*--- Send every piece to the ranks whose box it overlaps ---*/
+        vector<vector<unsigned long> > sendPiece(size);
+        for (unsigned long iPiece = 0; iPiece < nPiece; iPiece++)
+        {
+            double minCoord[3], maxCoord[3];
+            for (iDim = 0; iDim < d_numDim; iDim++)
+            {
+                minCoord[iDim] = numeric_limits<double>::max();
+                maxCoord[iDim] = -numeric_limits<double>::max();
+            }
+            for (iNode = piecePtr[iPiece]; iNode < piecePtr[iPiece + 1]; iNode++)
+            {
+                for (iDim = 0; iDim < d_numDim; iDim++)
+                {
+                    minCoord[iDim] = min(minCoord[iDim], val_source.coord[pieceNode[iNode]*d_numDim + iDim]);
+                    maxCoord[iDim] = max(maxCoord[iDim], val_source.coord[pieceNode[iNode]*d_numDim + iDim]);
+                }
+            }
+            for (iRank = 0; iRank < size; iRank++)
+            {
+                const double* box = &globalBox[iRank*nBox];
+                bool overlap = true;
+                for (iDim = 0; iDim < d_numDim && overlap; iDim++)
+                    overlap = (maxCoord[iDim] >= box[iDim]) && (minCoord[iDim] <= box[d_numDim + iDim]);
+                if (overlap) sendPiece[iRank].push_back(iPiece);
+            }
+        }
+
+        vector<int> sendSize(size, 0), sendNode(size, 0), sendCoord(size, 0);
+        vector<unsigned long> sendSizeBuf, sendNodeBuf, sendTagBuf;
+        vector<double> sendCoordBuf;
+        for (iRank = 0; iRank < size; iRank++)
+        {
+            for (unsigned long iSend = 0; iSend < sendPiece[iRank].size(); iSend++)
+            {
+                unsigned long iPiece = sendPiece[iRank][iSend];
+                sendSizeBuf.push_back(piecePtr[iPiece + 1] - piecePtr[iPiece]);
+                for (iNode = piecePtr[iPiece]; iNode < piecePtr[iPiece + 1]; iNode++)
+                {
+                    sendNodeBuf.push_back(pieceNode[iNode]);
+                    sendTagBuf.push_back(val_source.tag[pieceNode[iNode]]);
+                    for (iDim = 0; iDim < d_numDim; iDim++)
+                        sendCoordBuf.push_back(val_source.coord[pieceNode[iNode]*d_numDim + iDim]);
+                }
+                sendNode[iRank] += piecePtr[iPiece + 1] - piecePtr[iPiece];
+            }
+            sendSize[iRank] = (int)sendPiece[iRank].size();
+            sendCoord[iRank] = sendNode[iRank]*d_numDim;
+        }
+
+        vector<int> recvSize(size), recvNode(size), recvCoord(size);
+        if (size > 1)
+        {
+            vector<int> sendCount(2*size), recvCount(2*size);
+            for (iRank = 0; iRank < size; iRank++)
+            {
+                sendCount[2*iRank] = sendSize[iRank];
+                sendCount[2*iRank + 1] = sendNode[iRank];
+            }
+            mpi.Alltoall(&sendCount[0], 2, MPI_INT, &recvCount[0], 2, MPI_INT);
+            for (iRank = 0; iRank < size; iRank++)
+            {
+                recvSize[iRank] = recvCount[2*iRank];
+                recvNode[iRank] = recvCount[2*iRank + 1];
+                recvCoord[iRank] = recvNode[iRank]*d_numDim;
+            }
+        }
+        else
+        {
+            recvSize = sendSize;
+            recvNode = sendNode;
+            recvCoord = sendCoord;
+        }
+
+        vector<unsigned long> recvSizeBuf, recvNodeBuf, recvTagBuf;
+        vector<double> recvCoordBuf;
+        Exchange(sendSizeBuf, sendSize, recvSizeBuf, recvSize);
+        Exchange(sendNodeBuf, sendNode, recvNodeBuf, recvNode);
+        Exchange(sendTagBuf, sendNode, recvTagBuf, recvNode);
+        Exchange(sendCoordBuf, sendCoord, recvCoordBuf, recvCoord);
+
+        /*--- Candidate points (a point may come with several pieces) and candidate elements ---*/
+        map<pair<int, unsigned long>, unsigned long> candidateIndex;
+        vector<int> candRank;
+        vector<unsigned long> candPoint, candTag;
+        vector<double> candCoord;
+        vector<unsigned long> candElemPtr(1, 0), candElemNode;
+
+        unsigned long iRecvNode = 0, iRecvPiece = 0;
+        for (iRank = 0; iRank < size; iRank++)
+        {
+            for (int iCount = 0; iCount < recvSize[iRank]; iCount++, iRecvPiece++)
+            {
+                unsigned long nNode = recvSizeBuf[iRecvPiece];
+                for (iNode = 0; iNode < nNode; iNode++, iRecvNode++)
+                {
+                    pair<int, unsigned long> key((size > 1) ? iRank : myRank, recvNodeBuf[iRecvNode]);
+                    map<pair<int, unsigned long>, unsigned long>::iterator it = candidateIndex.find(key);
+                    unsigned long iCand;
+                    if (it == candidateIndex.end())
+                    {
+                        iCand = candPoint.size();
+                        candidateIndex[key] = iCand;
+                        candRank.push_back(key.first);
+                        candPoint.push_back(key.second);
+                        candTag.push_back(recvTagBuf[iRecvNode]);
+                        for (iDim = 0; iDim < d_numDim; iDim++) candCoord.push_back(recvCoordBuf[iRecvNode*d_numDim + iDim]);
+                    }
+                    else iCand = it->second;
+                    if (nNode > 1) candElemNode.push_back(iCand);
+                }
+                if (nNode > 1) candElemPtr.push_back(candElemNode.size());
+            }
+        }
+        unsigned long nCand = candPoint.size(), nCandElem = candElemPtr.size() - 1;
+
+        /*--- Elements around every candidate point (count, then fill) ---*/
+        vector<unsigned long> pointElemPtr(nCand + 1, 0), pointElem(candElemNode.size());
+        for (iNode = 0; iNode < candElemNode.size(); iNode++) pointElemPtr[candElemNode[iNode] + 1]++;
+        for (iPoint = 0; iPoint < nCand; iPoint++) pointElemPtr[iPoint + 1] += pointElemPtr[iPoint];
+        vector<unsigned long> fill(pointElemPtr.begin(), pointElemPtr.end() - 1);
+        for (iElem = 0; iElem < nCandElem; iElem++)
+            for (iNode = candElemPtr[iElem]; iNode < candElemPtr[iElem + 1]; iNode++)
+                pointElem[fill[candElemNode[iNode]]++] = iElem;
+
+        GeomKDTree tree(d_numDim);
+        tree.Build(nCand, candCoord.empty() ? NULL : &candCoord[0]);
+
+        /*--- Project every query on the elements around its closest candidate ---*/
+        val_rowPtr.assign(1, 0);
+        val_rank.clear();
+        val_point.clear();
+        val_weight.clear();
+        d_nearestPoint.assign(val_query.numPoint, 0);
+        d_nearestRank.assign(val_query.numPoint, -1);
+        d_nearestDist.assign(val_query.numPoint, numeric_limits<double>::max());
+
+        double maxDist = 0.0;
+        d_numUnmatched = 0;
+        for (iQuery = 0; iQuery < val_query.numPoint; iQuery++)
+        {
+            const double* coord = &val_query.coord[iQuery*d_numDim];
+            double nearDist, bestDist;
+            unsigned long iNear = tree.FindNearest(coord, nearDist);
+
+            if (iNear == GeomKDTree::GetNoPoint())
+            {
+                d_numUnmatched++;
+                val_rowPtr.push_back(val_point.size());
+                continue;
+            }
+
+            d_nearestPoint[iQuery] = candTag[iNear];
+            d_nearestRank[iQuery] = candRank[iNear];
+            d_nearestDist[iQuery] = nearDist;
+
+            double bestWeight[4] = { 1.0, 0.0, 0.0, 0.0 };
+            unsigned long bestElem = nCandElem;
+            bestDist = nearDist;
+
+            if (val_useElement)
+            {
+                double elemCoord[12], elemWeight[4];
+                bestDist = numeric_limits<double>::max();
+                for (unsigned long iAround = pointElemPtr[iNear]; iAround < pointElemPtr[iNear + 1]; iAround++)
+                {
+                    iElem = pointElem[iAround];
+                    unsigned short nNode = (unsigned short)(candElemPtr[iElem + 1] - candElemPtr[iElem]);
+                    if (nNode > 4) continue;
+                    for (iNode = 0; iNode < nNode; iNode++)
+                        for (iDim = 0; iDim < d_numDim; iDim++)
+                            elemCoord[iNode*d_numDim + iDim] = candCoord[candElemNode[candElemPtr[iElem] + iNode]*d_numDim + iDim];
+
+                    double dist = ProjectElement(coord, elemCoord, nNode, elemWeight);
+                    if (dist < bestDist)
+                    {
+                        bestDist = dist;
+                        bestElem = iElem;
+                        for (iNode = 0; iNode < nNode; iNode++) bestWeight[iNode] = elemWeight[iNode];
+                    }
+                }
+                if (bestElem == nCandElem) bestDist = nearDist;
+            }
+
+            if (bestElem == nCandElem)
+            {
+                val_rank.push_back(candRank[iNear]);
+                val_point.push_back(candPoint[iNear]);
+                val_weight.push_back(1.0);
+            }
+            else
+            {
+                for (iNode = candElemPtr[bestElem]; iNode < candElemPtr[bestElem + 1]; iNode++)
+                {
+                    double w = bestWeight[iNode - candElemPtr[bestElem]];
+                    if (w == 0.0) continue;
+                    val_rank.push_back(candRank[candElemNode[iNode]]);
+                    val_point.push_back(candPoint[candElemNode[iNode]]);
+                    val_weight.push_back(w);
+                }
+            }
+            val_rowPtr.push_back(val_point.size());
+
+            if (bestDist > d_tolerance) d_numUnmatched++;
+            maxDist = max(maxDist, bestDist);
+        }
+
+        d_maxDist = maxDist;
+        if (size > 1) mpi.Allreduce(&maxDist, &d_maxDist, 1, MPI_DOUBLE, MPI_MAX);
+    }
+
+    void GeomZoneTransfer::SetCommPattern(const vector<unsigned long>& val_rowPtr, const vector<int>& val_rank,
+                                          const vector<unsigned long>& val_point, const vector<double>& val_weight)
+    {
+        unsigned long iEntry;
+        int iRank;
+
+        const AriesMPI& mpi(AriesMPI::GetAriesWorld());
+        int size = mpi.GetSize();
+        int myRank = (size > 1) ? mpi.GetRank() : 0;
+
+        /*--- Donor points needed from every rank, each of them received once ---*/
+        vector<vector<unsigned long> > recvPoint(size);
+        for (iEntry = 0; iEntry < val_point.size(); iEntry++)
+            recvPoint[(size > 1) ? val_rank[iEntry] : myRank].push_back(val_point[iEntry]);
+
+        vector<int> recvDispl(size + 1, 0);
+        d_recvCount.assign(size, 0);
+        for (iRank = 0; iRank < size; iRank++)
+        {
+            sort(recvPoint[iRank].begin(), recvPoint[iRank].end());
+            recvPoint[iRank].erase(unique(recvPoint[iRank].begin(), recvPoint[iRank].end()), recvPoint[iRank].end());
+            d_recvCount[iRank] = (int)recvPoint[iRank].size();
+            recvDispl[iRank + 1] = recvDispl[iRank] + d_recvCount[iRank];
+        }
+
+        /*--- Matrix entries point into the receive buffer ---*/
+        d_rowPtr = val_rowPtr;
+        d_weight = val_weight;
+        d_colIndex.resize(val_point.size());
+        for (iEntry = 0; iEntry < val_point.size(); iEntry++)
+        {
+            iRank = (size > 1) ? val_rank[iEntry] : myRank;
+            vector<unsigned long>::const_iterator it = lower_bound(recvPoint[iRank].begin(), recvPoint[iRank].end(), val_point[iEntry]);
+            d_colIndex[iEntry] = recvDispl[iRank] + (it - recvPoint[iRank].begin());
+        }
+
+        /*--- Tell the owners which of their points they will have to send ---*/
+        vector<unsigned long> request;
+        for (iRank = 0; iRank < size; iRank++) request.insert(request.end(), recvPoint[iRank].begin(), recvPoint[iRank].end());
+
+        d_sendCount.assign(size, 0);
+        if (size > 1) mpi.Alltoall(&d_recvCount[0], 1, MPI_INT, &d_sendCount[0], 1, MPI_INT);
+        else d_sendCount = d_recvCount;
+
+        Exchange(request, d_recvCount, d_sendPoint, d_sendCount);
+    }
+
+    void GeomZoneTransfer::Apply(unsigned short val_numVar, const double* val_donorValue, double* val_targetValue) const
+    {
+        unsigned long iSend, iRow, iEntry;
+        unsigned short iVar;
+        int iRank, size = (int)d_sendCount.size();
+
+        vector<double> sendValue(d_sendPoint.size()*val_numVar), recvValue;
+        for (iSend = 0; iSend < d_sendPoint.size(); iSend++)
+            for (iVar = 0; iVar < val_numVar; iVar++)
+                sendValue[iSend*val_numVar + iVar] = val_donorValue[d_sendPoint[iSend]*val_numVar + iVar];
+
+        /*--- Single exchange of all the donor values ---*/
+        vector<int> sendCount(size), recvCount(size);
+        for (iRank = 0; iRank < size; iRank++)
+        {
+            sendCount[iRank] = d_sendCount[iRank]*val_numVar;
+            recvCount[iRank] = d_recvCount[iRank]*val_numVar;
+        }
+        Exchange(sendValue, sendCount, recvValue, recvCount);
+
+        for (iRow = 0; iRow + 1 < d_rowPtr.size(); iRow++)
+        {
+            for (iVar = 0; iVar < val_numVar; iVar++) val_targetValue[iRow*val_numVar + iVar] = 0.0;
+            for (iEntry = d_rowPtr[iRow]; iEntry < d_rowPtr[iRow + 1]; iEntry++)
+                for (iVar = 0; iVar < val_numVar; iVar++)
+                    val_targetValue[iRow*val_numVar + iVar] += d_weight[iEntry] * recvValue[d_colIndex[iEntry]*val_numVar + iVar];
+        }
+    }
+
+    bool GeomZoneTransfer::GetNearestDonor(unsigned long val_iTarget, unsigned long& val_point, int& val_rank, double& val_dist) const
+    {
+        if (val_iTarget >= d_nearestRank.size() || d_nearestRank[val_iTarget] < 0) return false;
+
+        val_point = d_nearestPoint[val_iTarget];
+        val_rank = d_nearestRank[val_iTarget];
+        val_dist = d_nearestDist[val_iTarget];
+        return (val_dist <= d_tolerance);
+    }
+
+    double GeomZoneTransfer::ProjectElement(const double* val_coord, const double* val_elemCoord, unsigned short val_numNode, double* val_weight) const
+    {
+        switch (val_numNode)
+        {
+        case 2: return ProjectSegment(val_coord, &val_elemCoord[0], &val_elemCoord[d_numDim], val_weight);
+        case 3: return ProjectTriangle(val_coord, &val_elemCoord[0], &val_elemCoord[d_numDim], &val_elemCoord[2*d_numDim], val_weight);
+        case 4: return ProjectQuadrilateral(val_coord, val_elemCoord, val_weight);
+        default: return numeric_limits<double>::max();
+        }
+    }
+
+    double GeomZoneTransfer::ProjectSegment(const double* val_coord, const double* val_a, const double* val_b, double* val_weight) const
+    {
+        unsigned short iDim;
+        double ab2 = 0.0, apab = 0.0, dist2 = 0.0;
+
+        for (iDim = 0; iDim < d_numDim; iDim++)
+        {
+            ab2 += (val_b[iDim] - val_a[iDim])*(val_b[iDim] - val_a[iDim]);
+            apab += (val_coord[iDim] - val_a[iDim])*(val_b[iDim] - val_a[iDim]);
+        }
+        double t = (ab2 > 0.0) ? min(max(apab / ab2, 0.0), 1.0) : 0.0;
+
+        val_weight[0] = 1.0 - t;
+        val_weight[1] = t;
+        for (iDim = 0; iDim < d_numDim; iDim++)
+        {
+            double delta = val_a[iDim] + t*(val_b[iDim] - val_a[iDim]) - val_coord[iDim];
+            dist2 += delta*delta;
+        }
+        return sqrt(dist2);
+    }
+
+    double GeomZoneTransfer::ProjectTriangle(const double* val_coord, const double* val_a, const double* val_b, const double* val_c, double* val_weight) const
+    {
+        unsigned short iDim;
+        double ab[3] = { 0.0, 0.0, 0.0 }, ac[3] = { 0.0, 0.0, 0.0 }, ap[3] = { 0.0, 0.0, 0.0 };
+        for (iDim = 0; iDim < d_numDim; iDim++)
+        {
+            ab[iDim] = val_b[iDim] - val_a[iDim];
+            ac[iDim] = val_c[iDim] - val_a[iDim];
+            ap[iDim] = val_coord[iDim] - val_a[iDim];
+        }
+
+        /*--- Barycentric coordinates of the closest point of the triangle (Voronoi regions) ---*/
+        double d1 = ab[0]*ap[0] + ab[1]*ap[1] + ab[2]*ap[2];
+        double d2 = ac[0]*ap[0] + ac[1]*ap[1] + ac[2]*ap[2];
+        double u, v, w;
+        if (d1 <= 0.0 && d2 <= 0.0) { u = 1.0; v = 0.0; w = 0.0; }
+        else
+        {
+            double bp[3] = { ap[0] - ab[0], ap[1] - ab[1], ap[2] - ab[2] };
+            double d3 = ab[0]*bp[0] + ab[1]*bp[1] + ab[2]*bp[2];
+            double d4 = ac[0]*bp[0] + ac[1]*bp[1] + ac[2]*bp[2];
+            double cp[3] = { ap[0] - ac[0], ap[1] - ac[1], ap[2] - ac[2] };
+            double d5 = ab[0]*cp[0] + ab[1]*cp[1] + ab[2]*cp[2];
+            double d6 = ac[0]*cp[0] + ac[1]*cp[1] + ac[2]*cp[2];
+            double vc = d1*d4 - d3*d2, vb = d5*d2 - d1*d6, va = d3*d6 - d5*d4;
+
+            if (d3 >= 0.0 && d4 <= d3) { u = 0.0; v = 1.0; w = 0.0; }
+            else if (d6 >= 0.0 && d5 <= d6) { u = 0.0; v = 0.0; w = 1.0; }
+            else if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) { v = d1 / (d1 - d3); u = 1.0 - v; w = 0.0; }
+            else if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) { w = d2 / (d2 - d6); u = 1.0 - w; v = 0.0; }
+            else if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) { w = (d4 - d3) / ((d4 - d3) + (d5 - d6)); v = 1.0 - w; u = 0.0; }
+            else
+            {
+                double denom = 1.0 / (va + vb + vc);
+                v = vb*denom; w = vc*denom; u = 1.0 - v - w;
+            }
+        }
+
+        val_weight[0] = u;
+        val_weight[1] = v;
+        val_weight[2] = w;
+
+        double dist2 = 0.0;
+        for (iDim = 0; iDim < d_numDim; iDim++)
+        {
+            double delta = u*val_a[iDim] + v*val_b[iDim] + w*val_c[iDim] - val_coord[iDim];
+            dist2 += delta*delta;
+        }
+        return sqrt(dist2);
+    }
+
+    double GeomZoneTransfer::ProjectQuadrilateral(const double* val_coord, const double* val_elemCoord, double* val_weight) const
+    {
+        unsigned short iDim, iNode, iIter;
+        const double xiNode[4] = { -1.0, 1.0, 1.0, -1.0 }, etaNode[4] = { -1.0, -1.0, 1.0, 1.0 };
+        double xi = 0.0, eta = 0.0, x[3], dxdxi[3], dxdeta[3];
+
+        /*--- Gauss-Newton on the bilinear map, the parametric coordinates kept inside the element ---*/
+        for (iIter = 0; iIter < 20; iIter++)
+        {
+            for (iDim = 0; iDim < d_numDim; iDim++) { x[iDim] = 0.0; dxdxi[iDim] = 0.0; dxdeta[iDim] = 0.0; }
+            for (iNode = 0; iNode < 4; iNode++)
+            {
+                double n = 0.25*(1.0 + xiNode[iNode]*xi)*(1.0 + etaNode[iNode]*eta);
+                double dndxi = 0.25*xiNode[iNode]*(1.0 + etaNode[iNode]*eta);
+                double dndeta = 0.25*etaNode[iNode]*(1.0 + xiNode[iNode]*xi);
+                for (iDim = 0; iDim < d_numDim; iDim++)
+                {
+                    x[iDim] += n*val_elemCoord[iNode*d_numDim + iDim];
+                    dxdxi[iDim] += dndxi*val_elemCoord[iNode*d_numDim + iDim];
+                    dxdeta[iDim] += dndeta*val_elemCoord[iNode*d_numDim + iDim];
+                }
+            }
+
+            double a11 = 0.0, a12 = 0.0, a22 = 0.0, r1 = 0.0, r2 = 0.0;
+            for (iDim = 0; iDim < d_numDim; iDim++)
+            {
+                double res = val_coord[iDim] - x[iDim];
+                a11 += dxdxi[iDim]*dxdxi[iDim];
+                a12 += dxdxi[iDim]*dxdeta[iDim];
+                a22 += dxdeta[iDim]*dxdeta[iDim];
+                r1 += dxdxi[iDim]*res;
+                r2 += dxdeta[iDim]*res;
+            }
+            double det = a11*a22 - a12*a12;
+            if (fabs(det) < 1E-30) break;
+
+            double dxi = (a22*r1 - a12*r2) / det, deta = (a11*r2 - a12*r1) / det;
+            xi = min(max(xi + dxi, -1.0), 1.0);
+            eta = min(max(eta + deta, -1.0), 1.0);
+            if (fabs(dxi) + fabs(deta) < 1E-10) break;
+        }
+
+        double dist2 = 0.0;
+        for (iNode = 0; iNode < 4; iNode++)
+            val_weight[iNode] = 0.25*(1.0 + xiNode[iNode]*xi)*(1.0 + etaNode[iNode]*eta);
+        for (iDim = 0; iDim < d_numDim; iDim++)
+        {
+            double delta = -val_coord[iDim];
+            for (iNode = 0; iNode < 4; iNode++) delta += val_weight[iNode]*val_elemCoord[iNode*d_numDim + iDim];
+            dist2 += delta*delta;
+        }
+        return sqrt(dist2);
+    }
+}
@@ -0,0 +1,186 @@
+/*
+ *================================================================================
+ *
+ *    Copyright (c) 2016 Vortex Co.,Ltd.
+ *    Unpublished - All rights reserved
+ *
+ *================================================================================
+ *    File description:
+ *    Sparse interpolation operator between the surfaces of two zones
+ *
+ *================================================================================
+ *    Date            Name                    Description of Change
+ *    18-Oct-2026     Jiamin Xu               Creation
+ *================================================================================
+ */
+
+
+#ifndef ARIES_GEOMZONETRANSFER_HPP
+#define ARIES_GEOMZONETRANSFER_HPP
+
+#include <cstddef>
+#include <vector>
+
+using namespace std;
+
+namespace ARIES
+{
+    /*!
+     * \brief Transfer matrix from the points of a donor surface to the points of a target surface.
+     *
+     * Both surfaces may be spread over all ranks. The operator is built once:
+     * the surface elements are sent only to the ranks whose target bounding box
+     * they overlap, the closest node is located with a k-d tree and the
+     * target is projected on the elements around it. The result is kept as a
+     * CSR matrix whose columns index a receive buffer, together with the list
+     * of donor points every rank has to send, so that Apply costs one
+     * all-to-all exchange followed by a sparse matrix-vector product.
+     *
+     * - Transfer_Nearest: value of the closest donor point.
+     * - Transfer_Isoparametric: shape functions of the donor element the target
+     *   projects on (consistent: constants are preserved).
+     * - Transfer_Conservative: transpose of the isoparametric interpolation of the
+     *   target surface onto the donor points (the sum of the transferred values,
+     *   e.g. nodal forces, is preserved).
+     *
+     * A surface is given by the coordinates of its points and the CSR
+     * connectivity of its elements (lines in 2D, triangles and quadrilaterals
+     * in 3D) in terms of those points. Every point must be owned by exactly one
+     * rank; elements that reach points of other ranks should be left out.
+     */
+    class GeomZoneTransfer
+    {
+    public:
+        typedef enum
+        {
+            Transfer_Nearest = 0,
+            Transfer_Isoparametric = 1,
+            Transfer_Conservative = 2
+        } TransferKind;
+
+        /*!
+         * \param[in] val_numDim - Number of dimensions of the problem.
+         * \param[in] val_tolerance - Largest distance between the two surfaces.
+         */
+        GeomZoneTransfer(unsigned short val_numDim, double val_tolerance);
+        ~GeomZoneTransfer();
+
+        /*!
+         * \brief Set the local part of the donor surface (copied).
+         * \param[in] val_numPoint - Number of local points.
+         * \param[in] val_coord - Coordinates, <i>[iPoint*nDim+iDim]</i>.
+         * \param[in] val_numElem - Number of local elements.
+         * \param[in] val_elemPtr - CSR offsets of the elements (size val_numElem+1, NULL if no element).
+         * \param[in] val_elemNode - Points of the elements.
+         * \param[in] val_tag - Index reported by GetNearestDonor for every point (NULL for the position in the list).
+         */
+        void SetDonorSurface(unsigned long val_numPoint, const double* val_coord, unsigned long val_numElem,
+                             const unsigned long* val_elemPtr, const unsigned long* val_elemNode, const unsigned long* val_tag = NULL);
+
+        /*!
+         * \brief Set the local part of the target surface (copied), see SetDonorSurface.
+         *        Its elements are only used by Transfer_Conservative.
+         */
+        void SetTargetSurface(unsigned long val_numPoint, const double* val_coord, unsigned long val_numElem,
+                              const unsigned long* val_elemPtr, const unsigned long* val_elemNode);
+
+        /*!
+         * \brief Compute the transfer matrix and the communication pattern (collective).
+         */
+        void Build(TransferKind val_kind);
+
+        /*!
+         * \brief Interpolate donor values on the target points (collective).
+         * \param[in] val_numVar - Number of variables per point.
+         * \param[in] val_donorValue - Values on the local donor points, <i>[iPoint*nVar+iVar]</i>.
+         * \param[out] val_targetValue - Values on the local target points, <i>[iPoint*nVar+iVar]</i>.
+         */
+        void Apply(unsigned short val_numVar, const double* val_donorValue, double* val_targetValue) const;
+
+        TransferKind GetKind() const { return d_kind; };
+        unsigned long GetNumTarget() const { return d_rowPtr.empty() ? 0 : d_rowPtr.size() - 1; };
+        unsigned long GetNumNonZero() const { return d_weight.size(); };
+
+        /*!
+         * \brief Closest donor point of a target (not available for Transfer_Conservative).
+         * \param[in] val_iTarget - Local target.
+         * \param[out] val_point - Tag of the donor point on its rank.
+         * \param[out] val_rank - Rank that owns the donor point.
+         * \param[out] val_dist - Distance to the donor point.
+         * \return <code>FALSE</code> if no donor was found within the tolerance.
+         */
+        bool GetNearestDonor(unsigned long val_iTarget, unsigned long& val_point, int& val_rank, double& val_dist) const;
+
+        /*!
+         * \brief Largest distance between a target and the donor surface, over all ranks.
+         */
+        double GetMaxDistance() const { return d_maxDist; };
+
+        /*!
+         * \brief Number of local targets that found no donor within the tolerance.
+         */
+        unsigned long GetNumUnmatched() const { return d_numUnmatched; };
+
+    private:
+        /*!
+         * \brief Local part of a surface.
+         */
+        struct Surface
+        {
+            unsigned long numPoint;
+            vector<double> coord;
+            vector<unsigned long> elemPtr;
+            vector<unsigned long> elemNode;
+            vector<unsigned long> tag;
+        };
+
+        /*!
+         * \brief Interpolation of the points of a query surface from the points of a source surface.
+         * \param[in] val_source - Surface that is interpolated.
+         * \param[in] val_query - Surface where the interpolation is evaluated.
+         * \param[in] val_useElement - <code>FALSE</code> to use the closest point only.
+         * \param[out] val_rowPtr - CSR offsets, one row per query point.
+         * \param[out] val_rank - Owner of the source point of every entry.
+         * \param[out] val_point - Source point of every entry.
+         * \param[out] val_weight - Weight of every entry.
+         */
+        void Interpolate(const Surface& val_source, const Surface& val_query, bool val_useElement,
+                         vector<unsigned long>& val_rowPtr, vector<int>& val_rank,
+                         vector<unsigned long>& val_point, vector<double>& val_weight);
+
+        /*!
+         * \brief Turn rows of (rank, point, weight) entries into the final matrix and send lists.
+         */
+        void SetCommPattern(const vector<unsigned long>& val_rowPtr, const vector<int>& val_rank,
+                            const vector<unsigned long>& val_point, const vector<double>& val_weight);
+
+        double ProjectElement(const double* val_coord, const double* val_elemCoord, unsigned short val_numNode, double* val_weight) const;
+        double ProjectSegment(const double* val_coord, const double* val_a, const double* val_b, double* val_weight) const;
+        double ProjectTriangle(const double* val_coord, const double* val_a, const double* val_b, const double* val_c, double* val_weight) const;
+        double ProjectQuadrilateral(const double* val_coord, const double* val_elemCoord, double* val_weight) const;
+
+        void Exchange(const vector<double>& val_send, const vector<int>& val_sendCount, vector<double>& val_recv, const vector<int>& val_recvCount) const;
+        void Exchange(const vector<unsigned long>& val_send, const vector<int>& val_sendCount, vector<unsigned long>& val_recv, const vector<int>& val_recvCount) const;
+
+        unsigned short d_numDim;                /*!< \brief Number of dimensions of the problem. */
+        double d_tolerance;                     /*!< \brief Inflation of the bounding boxes. */
+        TransferKind d_kind;                    /*!< \brief Kind of interpolation. */
+        Surface d_donor;                        /*!< \brief Local part of the donor surface. */
+        Surface d_target;                       /*!< \brief Local part of the target surface. */
+
+        vector<unsigned long> d_rowPtr;         /*!< \brief CSR offsets of the transfer matrix (one row per target). */
+        vector<unsigned long> d_colIndex;       /*!< \brief Position of every entry in the receive buffer. */
+        vector<double> d_weight;                /*!< \brief Weight of every entry. */
+        vector<int> d_sendCount;                /*!< \brief Number of donor values sent to every rank. */
+        vector<int> d_recvCount;                /*!< \brief Number of donor values received from every rank. */
+        vector<unsigned long> d_sendPoint;      /*!< \brief Local donor points to send, grouped by rank. */
+
+        vector<unsigned long> d_nearestPoint;   /*!< \brief Tag of the closest donor point of every target. */
+        vector<int> d_nearestRank;              /*!< \brief Owner of the closest donor point of every target. */
+        vector<double> d_nearestDist;           /*!< \brief Distance to the closest donor point of every target. */
+        double d_maxDist;                       /*!< \brief Largest target to donor surface distance. */
+        unsigned long d_numUnmatched;           /*!< \brief Local targets without donor. */
+    };
+}
+
+#endif
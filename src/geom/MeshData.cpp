@@ -50,5 +50,34 @@ namespace ARIES
 
 
         
+    }
+
+    void MeshData::SetFlatCount()
+    {
+        unsigned long iElem;
+
+        d_numPoint = d_pointGlobal.size();
+        d_numElem = d_elemType.size();
+        d_numElemLine = d_numElemTria = d_numElemQuad = d_numElemTetr = d_numElemHexa = d_numElemPris = d_numElemPyra = 0;
+        for (iElem = 0; iElem < d_numElem; iElem++)
+        {
+            switch (d_elemType[iElem])
+            {
+                case LINE:        d_numElemLine++; break;
+                case TRIANGLE:    d_numElemTria++; break;
+                case RECTANGLE:   d_numElemQuad++; break;
+                case TETRAHEDRON: d_numElemTetr++; break;
+                case HEXAHEDRON:  d_numElemHexa++; break;
+                case PRISM:       d_numElemPris++; break;
+                case PYRAMID:     d_numElemPyra++; break;
+            }
+        }
+
+        d_numMarker = d_boundPtr.empty() ? 0 : d_boundPtr.size() - 1;
+        d_numElemBound.resize(d_numMarker);
+        d_tagToMarker.resize(d_numMarker);
+        d_markerAllSendRecv.resize(d_numMarker, 0);
+        for (unsigned short iMarker = 0; iMarker < d_numMarker; iMarker++)
+            d_numElemBound[iMarker] = d_boundPtr[iMarker + 1] - d_boundPtr[iMarker];
     }
 }
@@ -113,6 +113,29 @@ namespace ARIES
 
         virtual vector<vector<unsigned long> > GetPlanePoints() { return d_planePoint; };
 
+        /*!
+         * \brief Flat arrays of the points, elements and boundary elements of this rank; the nodes are global indices.
+         */
+        vector<double>& GetCoord() { return d_coord; };
+        vector<unsigned long>& GetPointGlobal() { return d_pointGlobal; };
+        vector<unsigned short>& GetElemType() { return d_elemType; };
+        vector<unsigned long>& GetElemNodePtr() { return d_elemNodePtr; };
+        vector<unsigned long>& GetElemNode() { return d_elemNode; };
+        vector<unsigned long>& GetBoundPtr() { return d_boundPtr; };
+        vector<unsigned short>& GetBoundType() { return d_boundType; };
+        vector<unsigned long>& GetBoundNodePtr() { return d_boundNodePtr; };
+        vector<unsigned long>& GetBoundNode() { return d_boundNode; };
+
+        /*!
+         * \brief SEND_TO of every marker: rank+1 for a send marker, -(rank+1) for a receive marker, 0 for a physical marker.
+         */
+        vector<short>& GetMarkerAllSendRecv() { return d_markerAllSendRecv; };
+
+        /*!
+         * \brief Set the numbers of points, of elements of every type and of boundary elements from the flat arrays.
+         */
+        void SetFlatCount();
+
     private:
         unsigned short d_numDim;	                                    /*!< \brief Number of dimension of the problem. */
         unsigned short d_numZone;			                            /*!< \brief Number of zones in the problem. */
@@ -189,6 +212,19 @@ namespace ARIES
         //vector<Grid > d_newBound;            /*!< \brief Boundary std::vector for new periodic elements (primal grid information). */
         vector<unsigned long> d_numNewElemBound;			/*!< \brief Number of new periodic elements of the boundary. */
         
+        /*
+         *  Flat arrays of the mesh
+         */
+        vector<double> d_coord;                 /*!< \brief Coordinates of the points, <i>[iPoint*nDim+iDim]</i>. */
+        vector<unsigned long> d_pointGlobal;    /*!< \brief Global index of the points. */
+        vector<unsigned short> d_elemType;      /*!< \brief VTK type of the elements. */
+        vector<unsigned long> d_elemNodePtr;    /*!< \brief CSR offsets of the nodes of the elements. */
+        vector<unsigned long> d_elemNode;       /*!< \brief Nodes of the elements (global indices). */
+        vector<unsigned long> d_boundPtr;       /*!< \brief CSR offsets of the boundary elements of the markers. */
+        vector<unsigned short> d_boundType;     /*!< \brief VTK type of the boundary elements. */
+        vector<unsigned long> d_boundNodePtr;   /*!< \brief CSR offsets of the nodes of the boundary elements. */
+        vector<unsigned long> d_boundNode;      /*!< \brief Nodes of the boundary elements (global indices). */
+
         /*
          *  Parmetis variables
          */
@@ -16,6 +16,10 @@
 
 #include "MeshReaderCGNS.hpp"
 
+#if defined(ARIES_HAVE_PCGNS) && defined(ARIES_HAVE_MPI)
+#include "pcgnslib.h"
+#endif
+
 namespace ARIES
 {
     MeshReaderCGNS::MeshReaderCGNS()
@@ -59,7 +63,6 @@ namespace ARIES
         cgsize_t* cgsize; cgsize = new cgsize_t[3];
         ZoneType_t zonetype;
         DataType_t datatype;
-        double** coordArray = NULL;
         double*** gridCoords = NULL;
         ElementType_t elemType;
             cgsize_t range_min, range_max, startE, endE;
@@ -154,9 +157,20 @@ namespace ARIES
 
             /*--- Open the CGNS file for reading. The value of fn returned
             is the specific index number for this file and will be
-            repeatedly used in the function calls. ---*/
-
-            if (cg_open(val_mesh_filename.c_str(), CG_MODE_READ, &fn)) cg_error_exit();
+            repeatedly used in the function calls. With the parallel
+            CGNS library, an HDF5 file is opened on all ranks through MPI-IO
+            and the coordinates and the interior sections are read by
+            collective calls; other files (ADF), or a failed parallel open,
+            fall back to the serial library. ---*/
+
+            bool isParallel = false;
+#if defined(ARIES_HAVE_PCGNS) && defined(ARIES_HAVE_MPI)
+            if (file_type == CG_FILE_HDF5 && cgp_mpi_comm(MPI_COMM_WORLD) == CG_OK)
+                isParallel = (cgp_open(val_mesh_filename.c_str(), CG_MODE_READ, &fn) == CG_OK);
+            if (!isParallel && rank == MASTER_NODE)
+                cout << "The CGNS file is not HDF5 or cannot be opened in parallel, reading it with the serial library." << endl;
+#endif
+            if (!isParallel && cg_open(val_mesh_filename.c_str(), CG_MODE_READ, &fn)) cg_error_exit();
             if (rank == MASTER_NODE) {
                 cout << "Reading the CGNS file: ";
                 cout << val_mesh_filename.c_str() << "." << endl;
@@ -225,7 +239,6 @@ namespace ARIES
                 vertices = new int[nzones];
                 cells = new int[nzones];
                 boundVerts = new int[nzones];
-                coordArray = new double*[nzones];
                 gridCoords = new double**[nzones];
                 elemTypeVTK = new int*[nzones];
                 elemIndex = new int*[nzones];
@@ -334,17 +347,17 @@ namespace ARIES
                     }
                     nPoint_Linear[size] = vertices[j - 1];
 
-                    /*--- Set the value of range_max to the total number of nodes in
-                    the unstructured mesh. Also allocate memory for the temporary array
-                    that will hold the grid coordinates as they are extracted. Note the
-                    +1 for CGNS convention. ---*/
+                    /*--- Set the range of the nodes of this rank in the linear
+                    partition. Only this range is read from the file, so no rank
+                    ever holds the coordinates of the whole mesh. Note the +1 for
+                    CGNS convention. ---*/
 
                     range_min = (cgsize_t)starting_node[rank] + 1;
                     range_max = (cgsize_t)ending_node[rank];
-                    coordArray[j - 1] = new double[local_node];
 
                     /*--- Allocate memory for the 2-D array that will store the x, y,
-                    & z (if required) coordinates for writing into the SU2 mesh. ---*/
+                    & z (if required) coordinates of the local nodes. The values are
+                    read straight into it, without a temporary copy. ---*/
 
                     gridCoords[j - 1] = new double*[ncoords];
                     for (int ii = 0; ii < ncoords; ii++) {
@@ -369,28 +382,20 @@ namespace ARIES
                             cout << " values into linear partitions." << endl;
                         }
 
-                        /*--- Always retrieve the grid coords in double precision. ---*/
-
-                        if (datatype != RealDouble) {
-                            printf("\n\n   !!! Error !!!\n");
-                            printf(" CGNS coordinates are not double precision.\n");
-                            printf(" Now exiting...\n\n");
-#ifndef HAVE_MPI
-                            exit(EXIT_FAILURE);
-#else
-                            MPI_Abort(MPI_COMM_WORLD, 1);
-                            MPI_Finalize();
-#endif
-                        }
-                        if (cg_coord_read(fn, i, j, coordname, datatype, &range_min,
-                            &range_max, coordArray[j - 1])) cg_error_exit();
-
-                        /*--- Copy these coords into the array for storage until
-                        writing the SU2 mesh. ---*/
+                        /*--- Always retrieve the grid coords in double precision.
+                        The collective read returns the values in the type of the
+                        file, so single precision goes through the converting
+                        read of the mid-level library. ---*/
 
-                        for (int m = 0; m < local_node; m++) {
-                            gridCoords[j - 1][k - 1][m] = coordArray[j - 1][m];
+#if defined(ARIES_HAVE_PCGNS) && defined(ARIES_HAVE_MPI)
+                        if (isParallel && datatype == RealDouble) {
+                            if (cgp_coord_read_data(fn, i, j, k, &range_min, &range_max,
+                                gridCoords[j - 1][k - 1]) != CG_OK) cgp_error_exit();
+                            continue;
                         }
+#endif
+                        if (cg_coord_read(fn, i, j, coordname, RealDouble, &range_min,
+                            &range_max, gridCoords[j - 1][k - 1])) cg_error_exit();
 
                     }
 
@@ -491,6 +496,13 @@ namespace ARIES
                         we are only accessing our rank's piece of the data here in the
                         partial read function in the CGNS API. ---*/
 
+#if defined(ARIES_HAVE_PCGNS) && defined(ARIES_HAVE_MPI)
+                        if (isParallel && elemType != MIXED) {
+                            if (cgp_elements_read_data(fn, i, j, s, (cgsize_t)elemB[rank],
+                                (cgsize_t)elemE[rank], connElemCGNS) != CG_OK) cgp_error_exit();
+                        }
+                        else
+#endif
                         if (cg_elements_partial_read(fn, i, j, s, (cgsize_t)elemB[rank],
                             (cgsize_t)elemE[rank], connElemCGNS,
                             parentData) != CG_OK) cg_error_exit();
@@ -1097,6 +1109,12 @@ namespace ARIES
 
             /*--- Close the CGNS file. ---*/
 
+#if defined(ARIES_HAVE_PCGNS) && defined(ARIES_HAVE_MPI)
+            if (isParallel) {
+                if (cgp_close(fn) != CG_OK) cgp_error_exit();
+            }
+            else
+#endif
             if (cg_close(fn)) cg_error_exit();
             if (rank == MASTER_NODE)
                 cout << "Successfully closed the CGNS file." << endl;
@@ -1577,7 +1595,6 @@ namespace ARIES
             delete[] boundVerts;
 
             for (int j = 0; j < nzones; j++) {
-                delete[] coordArray[j];
                 delete[] elemTypeVTK[j];
                 delete[] elemIndex[j];
                 delete[] nElems[j];
@@ -1585,7 +1602,6 @@ namespace ARIES
                 delete[] isInternal[j];
                 delete[] sectionNames[j];
             }
-            delete[] coordArray;
             delete[] elemTypeVTK;
             delete[] elemIndex;
             delete[] nElems;
@@ -15,6 +15,9 @@
  */
 
 #include "MeshReaderSU2.hpp"
+#include "GeomMeshFileSU2.hpp"
+
+#include <algorithm>
 
 namespace ARIES
 {
@@ -25,10 +28,9 @@ namespace ARIES
         std::ifstream mesh_file;
         unsigned short nMarker_Max = config->GetnMarker_Max();
         unsigned long VTK_Type, iMarker, iChar;
-        unsigned long iCount = 0;
-        unsigned long iElem_Bound = 0, iPoint = 0, ielem_div = 0, ielem = 0;
+        unsigned long iElem_Bound = 0, iPoint = 0, iBlock = 0, ielem = 0;
         unsigned long vnodes_edge[2], vnodes_triangle[3], vnodes_quad[4];
-        unsigned long vnodes_tetra[4], vnodes_hexa[8], vnodes_prism[6], vnodes_pyramid[5], dummyLong, GlobalIndex;
+        unsigned long vnodes_tetra[4], vnodes_hexa[8], vnodes_prism[6], vnodes_pyramid[5], vnodes_elem[8], GlobalIndex;
         char cstr[200];
         double Coord_2D[2], Coord_3D[3];
         std::string::size_type position;
@@ -72,15 +74,15 @@ namespace ARIES
         ending_node = new unsigned long[size];
         npoint_procs = new unsigned long[size];
 
-        /*--- Open grid file ---*/
+        /*--- Map the grid file. The master scans it once for the offsets of the rows,
+          and every rank then reads only the rows it needs; the pages of the file that
+          no rank touches are never read from disk. ---*/
 
-        strcpy(cstr, val_mesh_filename.c_str());
-        mesh_file.open(cstr, std::ios::in);
-
-        /*--- Check the grid ---*/
-        if (mesh_file.fail())
+        GeomMeshFileSU2 mesh_map;
+        std::vector<unsigned long> mesh_index;
+        if (!mesh_map.Open(val_mesh_filename))
         {
-            std::cout << "There is no mesh file (GEOM_GeometryPhysical)!! " << cstr << std::endl;
+            std::cout << "There is no mesh file (GEOM_GeometryPhysical)!! " << val_mesh_filename << std::endl;
 #ifndef HAVE_MPI
             exit(EXIT_FAILURE);
 #else
@@ -88,167 +90,127 @@ namespace ARIES
             MPI_Finalize();
 #endif
         }
+        if (rank == TBOX::MASTER_NODE && mesh_map.BuildIndex()) mesh_map.PackIndex(mesh_index);
 
-        /*--- Read grid file with format SU2 ---*/
-        while (getline(mesh_file, text_line))
-        {
-            /*--- Read the dimension of the problem ---*/
-            position = text_line.find("NDIME=", 0);
-            if (position != std::string::npos)
-            {
-                if (domain_flag == false)
-                {
-                    text_line.erase(0, 6); nDim = atoi(text_line.c_str());
-                    if (rank == TBOX::MASTER_NODE)
-                    {
-                        if (nDim == 2) std::cout << "Two dimensional problem." << std::endl;
-                        if (nDim == 3) std::cout << "Three dimensional problem." << std::endl;
-                    }
-                    domain_flag = true;
-                }
-                else
-                {
-                    break;
-                }
-            }
-
-            /*--- Read number of points ---*/
-            position = text_line.find("NPOIN=", 0);
-            if (position != std::string::npos)
-            {
-                text_line.erase(0, 6);
-
-                /*--- Check for ghost points. ---*/
-                std::stringstream test_line(text_line);
-                while (test_line >> dummyLong)
-                    iCount++;
-
-                /*--- Now read and store the number of points and possible ghost points. ---*/
-
-                std::stringstream  stream_line(text_line);
-                if (iCount == 2)
-                {
-                    stream_line >> nPoint;
-                    stream_line >> nPointDomain;
-
-                    /*--- Set some important point information for parallel simulations. ---*/
-                    Global_nPoint = nPoint;
-                    Global_nPointDomain = nPointDomain;
-                    if (rank == TBOX::MASTER_NODE && size > TBOX::SINGLE_NODE)
-                    {
-                        std::cout << Global_nPointDomain << " points and " << Global_nPoint - Global_nPointDomain;
-                        std::cout << " ghost points before parallel partitioning." << std::endl;
-                    }
-                    else if (rank == TBOX::MASTER_NODE)
-                    {
-                        std::cout << Global_nPointDomain << " points and " << Global_nPoint - Global_nPointDomain;
-                        std::cout << " ghost points." << std::endl;
-                    }
+#ifdef HAVE_MPI
+        unsigned long index_size = mesh_index.size();
+        MPI_Bcast(&index_size, 1, MPI_UNSIGNED_LONG, TBOX::MASTER_NODE, MPI_COMM_WORLD);
+        mesh_index.resize(index_size);
+        if (index_size > 0)
+            MPI_Bcast(&mesh_index[0], index_size, MPI_UNSIGNED_LONG, TBOX::MASTER_NODE, MPI_COMM_WORLD);
+        if (rank != TBOX::MASTER_NODE && index_size > 0) mesh_map.UnpackIndex(mesh_index);
+#endif
 
-                }
-                else if (iCount == 1)
-                {
-                    stream_line >> nPoint;
-                    nPointDomain = nPoint;
-                    Global_nPointDomain = nPoint;
-                    Global_nPoint = nPoint;
-                    if (rank == TBOX::MASTER_NODE && size > TBOX::SINGLE_NODE)
-                    {
-                        std::cout << nPoint << " points before parallel partitioning." << std::endl;
-                    }
-                    else if (rank == TBOX::MASTER_NODE)
-                    {
-                        std::cout << nPoint << " points." << std::endl;
-                    }
-                }
-                else
-                {
-                    std::cout << "NPOIN improperly specified!!" << std::endl;
+        /*--- An empty index means that a section is truncated or NPOIN is improperly specified ---*/
+        if (mesh_index.empty())
+        {
+            std::cout << "NPOIN improperly specified!!" << std::endl;
 #ifndef HAVE_MPI
-                    exit(EXIT_FAILURE);
+            exit(EXIT_FAILURE);
 #else
-                    MPI_Abort(MPI_COMM_WORLD, 1);
-                    MPI_Finalize();
+            MPI_Abort(MPI_COMM_WORLD, 1);
+            MPI_Finalize();
 #endif
-                }
+        }
 
-                if ((rank == TBOX::MASTER_NODE) && (size > TBOX::SINGLE_NODE))
-                    std::cout << "Performing linear partitioning of the grid nodes." << std::endl;
+        /*--- Read the dimension of the problem ---*/
+        nDim = mesh_map.GetNumDim();
+        if (rank == TBOX::MASTER_NODE)
+        {
+            if (nDim == 2) std::cout << "Two dimensional problem." << std::endl;
+            if (nDim == 3) std::cout << "Three dimensional problem." << std::endl;
+        }
 
-                /*--- Compute the number of points that will be on each processor.
-                  This is a linear partitioning with the addition of a simple load
-                  balancing for any remainder points. ---*/
+        /*--- Read number of points and possible ghost points ---*/
+        nPoint = mesh_map.GetNumPoint();
+        nPointDomain = mesh_map.GetNumPointDomain();
 
-                total_pt_accounted = 0;
-                for (unsigned long i = 0; i < size; i++)
-                {
-                    npoint_procs[i] = nPoint / size;
-                    total_pt_accounted = total_pt_accounted + npoint_procs[i];
-                }
+        /*--- Set some important point information for parallel simulations. ---*/
+        Global_nPoint = nPoint;
+        Global_nPointDomain = nPointDomain;
+        if (rank == TBOX::MASTER_NODE && nPointDomain != nPoint)
+        {
+            std::cout << Global_nPointDomain << " points and " << Global_nPoint - Global_nPointDomain;
+            if (size > TBOX::SINGLE_NODE) std::cout << " ghost points before parallel partitioning." << std::endl;
+            else std::cout << " ghost points." << std::endl;
+        }
+        else if (rank == TBOX::MASTER_NODE)
+        {
+            if (size > TBOX::SINGLE_NODE) std::cout << nPoint << " points before parallel partitioning." << std::endl;
+            else std::cout << nPoint << " points." << std::endl;
+        }
 
-                /*--- Get the number of remainder points after the even division ---*/
-                rem_points = nPoint - total_pt_accounted;
-                for (unsigned long i = 0; i < rem_points; i++)
-                {
-                    npoint_procs[i]++;
-                }
+        if ((rank == TBOX::MASTER_NODE) && (size > TBOX::SINGLE_NODE))
+            std::cout << "Performing linear partitioning of the grid nodes." << std::endl;
 
-                /*--- Store the local number of nodes and the beginning/end index ---*/
-                local_node = npoint_procs[rank];
-                starting_node[0] = 0;
-                ending_node[0] = starting_node[0] + npoint_procs[0];
-                for (unsigned long i = 1; i < size; i++)
-                {
-                    starting_node[i] = ending_node[i - 1];
-                    ending_node[i] = starting_node[i] + npoint_procs[i];
-                }
+        /*--- Compute the number of points that will be on each processor.
+          This is a linear partitioning with the addition of a simple load
+          balancing for any remainder points. ---*/
 
-                /*--- Here we check if a point in the mesh file lies in the domain
-                  and if so then store it on the local processor. We only create enough
-                  space in the node container for the local nodes at this point. ---*/
+        total_pt_accounted = 0;
+        for (unsigned long i = 0; i < size; i++)
+        {
+            npoint_procs[i] = nPoint / size;
+            total_pt_accounted = total_pt_accounted + npoint_procs[i];
+        }
 
-                node = new GRID::GRID_DGPoint*[local_node];
-                iPoint = 0; node_count = 0;
-                while (node_count < nPoint)
-                {
-                    getline(mesh_file, text_line);
-                    std::istringstream point_line(text_line);
+        /*--- Get the number of remainder points after the even division ---*/
+        rem_points = nPoint - total_pt_accounted;
+        for (unsigned long i = 0; i < rem_points; i++)
+        {
+            npoint_procs[i]++;
+        }
 
-                    /*--- We only read information for this node if it is owned by this
-                      rank based upon our initial linear partitioning. ---*/
+        /*--- Store the local number of nodes and the beginning/end index ---*/
+        local_node = npoint_procs[rank];
+        starting_node[0] = 0;
+        ending_node[0] = starting_node[0] + npoint_procs[0];
+        for (unsigned long i = 1; i < size; i++)
+        {
+            starting_node[i] = ending_node[i - 1];
+            ending_node[i] = starting_node[i] + npoint_procs[i];
+        }
 
-                    if ((node_count >= starting_node[rank]) && (node_count < ending_node[rank]))
-                    {
-                        switch (nDim)
-                        {
-                            case 2:
-                                GlobalIndex = node_count;
-#ifndef HAVE_MPI
-                                point_line >> Coord_2D[0]; point_line >> Coord_2D[1];
-#else
-                                if (size > SINGLE_NODE) { point_line >> Coord_2D[0]; point_line >> Coord_2D[1]; point_line >> LocalIndex; point_line >> GlobalIndex; }
-                                else { point_line >> Coord_2D[0]; point_line >> Coord_2D[1]; LocalIndex = iPoint; GlobalIndex = node_count; }
+        /*--- Here we check if a point in the mesh file lies in the domain
+          and if so then store it on the local processor. We only create enough
+          space in the node container for the local nodes at this point. ---*/
+
+        node = new GRID::GRID_DGPoint*[local_node];
+        iPoint = 0;
+        const char* point_row = (local_node > 0) ? mesh_map.GetPointRow(starting_node[rank]) : NULL;
+        for (node_count = starting_node[rank]; node_count < ending_node[rank]; node_count++)
+        {
+            /*--- Coordinates, then the local and global indices written by a partitioned run ---*/
+            const char* point_cursor = point_row;
+            double* Coord = (nDim == 2) ? Coord_2D : Coord_3D;
+            for (unsigned short iDim = 0; iDim < nDim; iDim++)
+                point_cursor = GeomMeshFileSU2::ParseDouble(point_cursor, mesh_map.GetEnd(), Coord[iDim]);
+            GlobalIndex = node_count;
+#ifdef HAVE_MPI
+            if (size > SINGLE_NODE)
+            {
+                point_cursor = GeomMeshFileSU2::ParseUnsigned(point_cursor, mesh_map.GetEnd(), LocalIndex);
+                point_cursor = GeomMeshFileSU2::ParseUnsigned(point_cursor, mesh_map.GetEnd(), GlobalIndex);
+            }
+            else LocalIndex = iPoint;
 #endif
-                                node[iPoint] = new GRID::GRID_DGPoint(Coord_2D[0], Coord_2D[1], GlobalIndex, config);
-                                iPoint++; break;
-                            case 3:
-                                GlobalIndex = node_count;
+            if (point_cursor == NULL)
+            {
+                std::cout << "Point " << node_count << " improperly specified!!" << std::endl;
 #ifndef HAVE_MPI
-                                point_line >> Coord_3D[0]; point_line >> Coord_3D[1]; point_line >> Coord_3D[2];
+                exit(EXIT_FAILURE);
 #else
-                                if (size > SINGLE_NODE) { point_line >> Coord_3D[0]; point_line >> Coord_3D[1]; point_line >> Coord_3D[2]; point_line >> LocalIndex; point_line >> GlobalIndex; }
-                                else { point_line >> Coord_3D[0]; point_line >> Coord_3D[1]; point_line >> Coord_3D[2]; LocalIndex = iPoint; GlobalIndex = node_count; }
+                MPI_Abort(MPI_COMM_WORLD, 1);
+                MPI_Finalize();
 #endif
-                                node[iPoint] = new GRID::GRID_DGPoint(Coord_3D[0], Coord_3D[1], Coord_3D[2], GlobalIndex, config);
-                                iPoint++; break;
-                        }
-                    }
-                    node_count++;
-                }
             }
+
+            if (nDim == 2) node[iPoint] = new GRID::GRID_DGPoint(Coord_2D[0], Coord_2D[1], GlobalIndex, config);
+            else node[iPoint] = new GRID::GRID_DGPoint(Coord_3D[0], Coord_3D[1], Coord_3D[2], GlobalIndex, config);
+            iPoint++;
+            point_row = mesh_map.NextRow(point_cursor);
         }
 
-        mesh_file.close();
         strcpy(cstr, val_mesh_filename.c_str());
 
         /*--- Initialize some arrays for the adjacency information (ParMETIS). ---*/
@@ -265,217 +227,216 @@ namespace ARIES
             adj_counter[iPoint] = 0;
         }
 
-        mesh_file.open(cstr, std::ios::in);
-        while (getline(mesh_file, text_line))
-        {
-            /*--- Read the information about inner elements ---*/
-            position = text_line.find("NELEM=", 0);
-            if (position != std::string::npos)
-            {
-                text_line.erase(0, 6); nElem = atoi(text_line.c_str());
-
-                /*--- Store total number of elements in the original mesh ---*/
-                Global_nElem = nElem;
-                if ((rank == TBOX::MASTER_NODE) && (size > TBOX::SINGLE_NODE))
-                    std::cout << Global_nElem << " interior elements before parallel partitioning." << std::endl;
+        /*--- Read the information about inner elements ---*/
+        nElem = mesh_map.GetNumElem();
 
-                /*--- Allocate space for elements ---*/
+        /*--- Store total number of elements in the original mesh ---*/
+        Global_nElem = nElem;
+        if ((rank == TBOX::MASTER_NODE) && (size > TBOX::SINGLE_NODE))
+            std::cout << Global_nElem << " interior elements before parallel partitioning." << std::endl;
 
-                elem = new GRID::GRID_Primal*[nElem];
-                for (int iElem = 0; iElem < nElem; iElem++) elem[iElem] = NULL;
+        /*--- Allocate space for elements ---*/
 
+        elem = new GRID::GRID_Primal*[nElem];
+        for (int iElem = 0; iElem < nElem; iElem++) elem[iElem] = NULL;
 
-                /*--- Set up the global to local element mapping. ---*/
-                Global_to_local_elem = new long[nElem];
-                for (unsigned long i = 0; i < nElem; i++)
-                {
-                    Global_to_local_elem[i] = -1;
-                }
 
-                if ((rank == TBOX::MASTER_NODE) && (size > TBOX::SINGLE_NODE))
-                    std::cout << "Distributing elements across all ranks." << std::endl;
-
-                /*--- Loop over all the volumetric elements and store any element that
-                  contains at least one of an owned node for this rank (i.e., there will
-                  be element redundancy, since multiple ranks will store the same elems
-                  on the boundaries of the initial linear partitioning. ---*/
+        /*--- Set up the global to local element mapping. ---*/
+        Global_to_local_elem = new long[nElem];
+        for (unsigned long i = 0; i < nElem; i++)
+        {
+            Global_to_local_elem[i] = -1;
+        }
 
-                // TO DO: remove redundant edges (quads have extra diagonals for instance)
-                element_count = 0; elem_reqd = false; loc_element_count = 0; ielem_div = 0;
-                while (ielem_div < nElem)
-                {
-                    getline(mesh_file, text_line);
-                    std::istringstream elem_line(text_line);
+        if ((rank == TBOX::MASTER_NODE) && (size > TBOX::SINGLE_NODE))
+            std::cout << "Distributing elements across all ranks." << std::endl;
+
+        /*--- Loop over all the volumetric elements and store any element that
+          contains at least one of an owned node for this rank (i.e., there will
+          be element redundancy, since multiple ranks will store the same elems
+          on the boundaries of the initial linear partitioning. Blocks of elements
+          with no node in the partition of this rank are skipped without being read,
+          using the node range of the blocks in the index. ---*/
+
+        // TO DO: remove redundant edges (quads have extra diagonals for instance)
+        elem_reqd = false; loc_element_count = 0;
+        for (iBlock = 0; iBlock < mesh_map.GetNumBlock(); iBlock++)
+        {
+            if (mesh_map.GetBlockMaxNode(iBlock) < starting_node[rank] || mesh_map.GetBlockMinNode(iBlock) >= ending_node[rank]) continue;
 
-                    elem_line >> VTK_Type;
-                    elem_reqd = false;
+            const char* elem_row = mesh_map.GetElemRow(iBlock*mesh_map.GetBlockSize());
+            unsigned long block_end = std::min(nElem, (iBlock + 1)*mesh_map.GetBlockSize());
+            for (element_count = iBlock*mesh_map.GetBlockSize(); element_count < block_end; element_count++)
+            {
+                const char* elem_cursor = GeomMeshFileSU2::ParseUnsigned(elem_row, mesh_map.GetEnd(), VTK_Type);
+                for (unsigned short iNode = 0; iNode < GeomMeshFileSU2::GetNumElemNode(VTK_Type); iNode++)
+                    elem_cursor = GeomMeshFileSU2::ParseUnsigned(elem_cursor, mesh_map.GetEnd(), vnodes_elem[iNode]);
+                elem_row = mesh_map.NextRow(elem_cursor);
+                elem_reqd = false;
 
-                    /*--- Decide whether this rank needs each element. If so, build the
-                      adjacency arrays needed by ParMETIS and store the element connectivity.
-                      Note that every proc starts it's node indexing from zero. ---*/
+                /*--- Decide whether this rank needs each element. If so, build the
+                  adjacency arrays needed by ParMETIS and store the element connectivity.
+                  Note that every proc starts it's node indexing from zero. ---*/
 
-                    switch (VTK_Type)
-                    {
+                switch (VTK_Type)
+                {
 
-                        case TBOX::TRIANGLE:
-                            elem_line >> vnodes_triangle[0]; elem_line >> vnodes_triangle[1]; elem_line >> vnodes_triangle[2];
-                            for (unsigned long i = 0; i < TBOX::N_POINTS_TRIANGLE; i++)
+                    case TBOX::TRIANGLE:
+                        vnodes_triangle[0] = vnodes_elem[0]; vnodes_triangle[1] = vnodes_elem[1]; vnodes_triangle[2] = vnodes_elem[2];
+                        for (unsigned long i = 0; i < TBOX::N_POINTS_TRIANGLE; i++)
+                        {
+                            if ((vnodes_triangle[i] >= starting_node[rank]) && (vnodes_triangle[i] < ending_node[rank]))
                             {
-                                if ((vnodes_triangle[i] >= starting_node[rank]) && (vnodes_triangle[i] < ending_node[rank]))
+                                elem_reqd = true;
+                                for (unsigned long j = 0; j < TBOX::N_POINTS_TRIANGLE; j++)
                                 {
-                                    elem_reqd = true;
-                                    for (unsigned long j = 0; j < TBOX::N_POINTS_TRIANGLE; j++)
+                                    if (i != j)
                                     {
-                                        if (i != j)
-                                        {
-                                            adjacent_elem[vnodes_triangle[i] - starting_node[rank]][adj_counter[vnodes_triangle[i] - starting_node[rank]]] = vnodes_triangle[j];
-                                            adj_counter[vnodes_triangle[i] - starting_node[rank]]++;
-                                        }
+                                        adjacent_elem[vnodes_triangle[i] - starting_node[rank]][adj_counter[vnodes_triangle[i] - starting_node[rank]]] = vnodes_triangle[j];
+                                        adj_counter[vnodes_triangle[i] - starting_node[rank]]++;
                                     }
                                 }
                             }
-                            if (elem_reqd)
-                            {
-                                Global_to_local_elem[element_count] = loc_element_count;
-                                elem[loc_element_count] = new GRID::GRID_Triangle(vnodes_triangle[0], vnodes_triangle[1], vnodes_triangle[2], 2);
-                                nelem_triangle++; loc_element_count++;
-                            }
-                            break;
+                        }
+                        if (elem_reqd)
+                        {
+                            Global_to_local_elem[element_count] = loc_element_count;
+                            elem[loc_element_count] = new GRID::GRID_Triangle(vnodes_triangle[0], vnodes_triangle[1], vnodes_triangle[2], 2);
+                            nelem_triangle++; loc_element_count++;
+                        }
+                        break;
 
-                        case TBOX::RECTANGLE:
-                            elem_line >> vnodes_quad[0]; elem_line >> vnodes_quad[1]; elem_line >> vnodes_quad[2]; elem_line >> vnodes_quad[3];
-                            for (unsigned long i = 0; i < TBOX::N_POINTS_QUADRILATERAL; i++)
+                    case TBOX::RECTANGLE:
+                        vnodes_quad[0] = vnodes_elem[0]; vnodes_quad[1] = vnodes_elem[1]; vnodes_quad[2] = vnodes_elem[2]; vnodes_quad[3] = vnodes_elem[3];
+                        for (unsigned long i = 0; i < TBOX::N_POINTS_QUADRILATERAL; i++)
+                        {
+                            if ((vnodes_quad[i] >= starting_node[rank]) && (vnodes_quad[i] < ending_node[rank]))
                             {
-                                if ((vnodes_quad[i] >= starting_node[rank]) && (vnodes_quad[i] < ending_node[rank]))
-                                {
-                                    elem_reqd = true;
+                                elem_reqd = true;
 
-                                    for (unsigned long j = 0; j < TBOX::N_POINTS_QUADRILATERAL; j++)
+                                for (unsigned long j = 0; j < TBOX::N_POINTS_QUADRILATERAL; j++)
+                                {
+                                    if (i != j)
                                     {
-                                        if (i != j)
-                                        {
-                                            adjacent_elem[vnodes_quad[i] - starting_node[rank]][adj_counter[vnodes_quad[i] - starting_node[rank]]] = vnodes_quad[j];
-                                            adj_counter[vnodes_quad[i] - starting_node[rank]]++;
-                                        }
+                                        adjacent_elem[vnodes_quad[i] - starting_node[rank]][adj_counter[vnodes_quad[i] - starting_node[rank]]] = vnodes_quad[j];
+                                        adj_counter[vnodes_quad[i] - starting_node[rank]]++;
                                     }
                                 }
                             }
-                            if (elem_reqd)
-                            {
-                                Global_to_local_elem[element_count] = loc_element_count;
-                                elem[loc_element_count] = new GRID::GRID_Rectangle(vnodes_quad[0], vnodes_quad[1], vnodes_quad[2], vnodes_quad[3], 2);
-                                loc_element_count++; nelem_quad++;
-                            }
-                            break;
+                        }
+                        if (elem_reqd)
+                        {
+                            Global_to_local_elem[element_count] = loc_element_count;
+                            elem[loc_element_count] = new GRID::GRID_Rectangle(vnodes_quad[0], vnodes_quad[1], vnodes_quad[2], vnodes_quad[3], 2);
+                            loc_element_count++; nelem_quad++;
+                        }
+                        break;
 
-                        case TBOX::TETRAHEDRON:
-                            elem_line >> vnodes_tetra[0]; elem_line >> vnodes_tetra[1]; elem_line >> vnodes_tetra[2]; elem_line >> vnodes_tetra[3];
-                            for (unsigned long i = 0; i < TBOX::N_POINTS_TETRAHEDRON; i++)
+                    case TBOX::TETRAHEDRON:
+                        vnodes_tetra[0] = vnodes_elem[0]; vnodes_tetra[1] = vnodes_elem[1]; vnodes_tetra[2] = vnodes_elem[2]; vnodes_tetra[3] = vnodes_elem[3];
+                        for (unsigned long i = 0; i < TBOX::N_POINTS_TETRAHEDRON; i++)
+                        {
+                            if ((vnodes_tetra[i] >= starting_node[rank]) && (vnodes_tetra[i] < ending_node[rank]))
                             {
-                                if ((vnodes_tetra[i] >= starting_node[rank]) && (vnodes_tetra[i] < ending_node[rank]))
+                                elem_reqd = true;
+                                for (unsigned long j = 0; j < TBOX::N_POINTS_TETRAHEDRON; j++)
                                 {
-                                    elem_reqd = true;
-                                    for (unsigned long j = 0; j < TBOX::N_POINTS_TETRAHEDRON; j++)
+                                    if (i != j)
                                     {
-                                        if (i != j)
-                                        {
-                                            adjacent_elem[vnodes_tetra[i] - starting_node[rank]][adj_counter[vnodes_tetra[i] - starting_node[rank]]] = vnodes_tetra[j];
-                                            adj_counter[vnodes_tetra[i] - starting_node[rank]]++;
-                                        }
+                                        adjacent_elem[vnodes_tetra[i] - starting_node[rank]][adj_counter[vnodes_tetra[i] - starting_node[rank]]] = vnodes_tetra[j];
+                                        adj_counter[vnodes_tetra[i] - starting_node[rank]]++;
                                     }
                                 }
                             }
-                            if (elem_reqd)
-                            {
-                                Global_to_local_elem[element_count] = loc_element_count;
-                                elem[loc_element_count] = new GRID::GRID_Tetrahedron(vnodes_tetra[0], vnodes_tetra[1], vnodes_tetra[2], vnodes_tetra[3]);
-                                loc_element_count++; nelem_tetra++;
-                            }
-                            break;
+                        }
+                        if (elem_reqd)
+                        {
+                            Global_to_local_elem[element_count] = loc_element_count;
+                            elem[loc_element_count] = new GRID::GRID_Tetrahedron(vnodes_tetra[0], vnodes_tetra[1], vnodes_tetra[2], vnodes_tetra[3]);
+                            loc_element_count++; nelem_tetra++;
+                        }
+                        break;
 
-                        case TBOX::HEXAHEDRON:
+                    case TBOX::HEXAHEDRON:
 
-                            elem_line >> vnodes_hexa[0]; elem_line >> vnodes_hexa[1]; elem_line >> vnodes_hexa[2];
-                            elem_line >> vnodes_hexa[3]; elem_line >> vnodes_hexa[4]; elem_line >> vnodes_hexa[5];
-                            elem_line >> vnodes_hexa[6]; elem_line >> vnodes_hexa[7];
-                            for (unsigned long i = 0; i < TBOX::N_POINTS_HEXAHEDRON; i++)
+                        vnodes_hexa[0] = vnodes_elem[0]; vnodes_hexa[1] = vnodes_elem[1]; vnodes_hexa[2] = vnodes_elem[2];
+                        vnodes_hexa[3] = vnodes_elem[3]; vnodes_hexa[4] = vnodes_elem[4]; vnodes_hexa[5] = vnodes_elem[5];
+                        vnodes_hexa[6] = vnodes_elem[6]; vnodes_hexa[7] = vnodes_elem[7];
+                        for (unsigned long i = 0; i < TBOX::N_POINTS_HEXAHEDRON; i++)
+                        {
+                            if ((vnodes_hexa[i] >= starting_node[rank]) && (vnodes_hexa[i] < ending_node[rank]))
                             {
-                                if ((vnodes_hexa[i] >= starting_node[rank]) && (vnodes_hexa[i] < ending_node[rank]))
+                                elem_reqd = true;
+                                for (unsigned long j = 0; j < TBOX::N_POINTS_HEXAHEDRON; j++)
                                 {
-                                    elem_reqd = true;
-                                    for (unsigned long j = 0; j < TBOX::N_POINTS_HEXAHEDRON; j++)
+                                    if (i != j)
                                     {
-                                        if (i != j)
-                                        {
-                                            adjacent_elem[vnodes_hexa[i] - starting_node[rank]][adj_counter[vnodes_hexa[i] - starting_node[rank]]] = vnodes_hexa[j];
-                                            adj_counter[vnodes_hexa[i] - starting_node[rank]]++;
-                                        }
+                                        adjacent_elem[vnodes_hexa[i] - starting_node[rank]][adj_counter[vnodes_hexa[i] - starting_node[rank]]] = vnodes_hexa[j];
+                                        adj_counter[vnodes_hexa[i] - starting_node[rank]]++;
                                     }
                                 }
                             }
-                            if (elem_reqd)
-                            {
-                                Global_to_local_elem[element_count] = loc_element_count;
-                                elem[loc_element_count] = new GRID::GRID_Hexahedron(vnodes_hexa[0], vnodes_hexa[1], vnodes_hexa[2], vnodes_hexa[3],
-                                                                                    vnodes_hexa[4], vnodes_hexa[5], vnodes_hexa[6], vnodes_hexa[7]);
-                                loc_element_count++; nelem_hexa++;
-                            }
-                            break;
+                        }
+                        if (elem_reqd)
+                        {
+                            Global_to_local_elem[element_count] = loc_element_count;
+                            elem[loc_element_count] = new GRID::GRID_Hexahedron(vnodes_hexa[0], vnodes_hexa[1], vnodes_hexa[2], vnodes_hexa[3],
+                                                                                vnodes_hexa[4], vnodes_hexa[5], vnodes_hexa[6], vnodes_hexa[7]);
+                            loc_element_count++; nelem_hexa++;
+                        }
+                        break;
 
-                        case TBOX::PRISM:
+                    case TBOX::PRISM:
 
-                            elem_line >> vnodes_prism[0]; elem_line >> vnodes_prism[1]; elem_line >> vnodes_prism[2];
-                            elem_line >> vnodes_prism[3]; elem_line >> vnodes_prism[4]; elem_line >> vnodes_prism[5];
-                            for (unsigned long i = 0; i < TBOX::N_POINTS_PRISM; i++) {
-                                if ((vnodes_prism[i] >= starting_node[rank]) && (vnodes_prism[i] < ending_node[rank]))
+                        vnodes_prism[0] = vnodes_elem[0]; vnodes_prism[1] = vnodes_elem[1]; vnodes_prism[2] = vnodes_elem[2];
+                        vnodes_prism[3] = vnodes_elem[3]; vnodes_prism[4] = vnodes_elem[4]; vnodes_prism[5] = vnodes_elem[5];
+                        for (unsigned long i = 0; i < TBOX::N_POINTS_PRISM; i++) {
+                            if ((vnodes_prism[i] >= starting_node[rank]) && (vnodes_prism[i] < ending_node[rank]))
+                            {
+                                elem_reqd = true;
+                                for (unsigned long j = 0; j < TBOX::N_POINTS_PRISM; j++)
                                 {
-                                    elem_reqd = true;
-                                    for (unsigned long j = 0; j < TBOX::N_POINTS_PRISM; j++)
+                                    if (i != j)
                                     {
-                                        if (i != j)
-                                        {
-                                            adjacent_elem[vnodes_prism[i] - starting_node[rank]][adj_counter[vnodes_prism[i] - starting_node[rank]]] = vnodes_prism[j];
-                                            adj_counter[vnodes_prism[i] - starting_node[rank]]++;
-                                        }
+                                        adjacent_elem[vnodes_prism[i] - starting_node[rank]][adj_counter[vnodes_prism[i] - starting_node[rank]]] = vnodes_prism[j];
+                                        adj_counter[vnodes_prism[i] - starting_node[rank]]++;
                                     }
                                 }
                             }
-                            if (elem_reqd)
-                            {
-                                Global_to_local_elem[element_count] = loc_element_count;
-                                elem[loc_element_count] = new GRID::GRID_Prism(vnodes_prism[0], vnodes_prism[1], vnodes_prism[2], vnodes_prism[3], vnodes_prism[4], vnodes_prism[5]);
-                                loc_element_count++; nelem_prism++;
-                            }
-                            break;
+                        }
+                        if (elem_reqd)
+                        {
+                            Global_to_local_elem[element_count] = loc_element_count;
+                            elem[loc_element_count] = new GRID::GRID_Prism(vnodes_prism[0], vnodes_prism[1], vnodes_prism[2], vnodes_prism[3], vnodes_prism[4], vnodes_prism[5]);
+                            loc_element_count++; nelem_prism++;
+                        }
+                        break;
 
-                        case TBOX::PYRAMID:
-                            elem_line >> vnodes_pyramid[0]; elem_line >> vnodes_pyramid[1]; elem_line >> vnodes_pyramid[2];
-                            elem_line >> vnodes_pyramid[3]; elem_line >> vnodes_pyramid[4];
-                            for (unsigned long i = 0; i < TBOX::N_POINTS_PYRAMID; i++)
+                    case TBOX::PYRAMID:
+                        vnodes_pyramid[0] = vnodes_elem[0]; vnodes_pyramid[1] = vnodes_elem[1]; vnodes_pyramid[2] = vnodes_elem[2];
+                        vnodes_pyramid[3] = vnodes_elem[3]; vnodes_pyramid[4] = vnodes_elem[4];
+                        for (unsigned long i = 0; i < TBOX::N_POINTS_PYRAMID; i++)
+                        {
+                            if ((vnodes_pyramid[i] >= starting_node[rank]) && (vnodes_pyramid[i] < ending_node[rank]))
                             {
-                                if ((vnodes_pyramid[i] >= starting_node[rank]) && (vnodes_pyramid[i] < ending_node[rank]))
+                                elem_reqd = true;
+                                for (unsigned long j = 0; j < TBOX::N_POINTS_PYRAMID; j++)
                                 {
-                                    elem_reqd = true;
-                                    for (unsigned long j = 0; j < TBOX::N_POINTS_PYRAMID; j++)
+                                    if (i != j)
                                     {
-                                        if (i != j)
-                                        {
-                                            adjacent_elem[vnodes_pyramid[i] - starting_node[rank]][adj_counter[vnodes_pyramid[i] - starting_node[rank]]] = vnodes_pyramid[j];
-                                            adj_counter[vnodes_pyramid[i] - starting_node[rank]]++;
-                                        }
+                                        adjacent_elem[vnodes_pyramid[i] - starting_node[rank]][adj_counter[vnodes_pyramid[i] - starting_node[rank]]] = vnodes_pyramid[j];
+                                        adj_counter[vnodes_pyramid[i] - starting_node[rank]]++;
                                     }
                                 }
                             }
-                            if (elem_reqd)
-                            {
-                                Global_to_local_elem[element_count] = loc_element_count;
-                                elem[loc_element_count] = new GRID::GRID_Pyramid(vnodes_pyramid[0], vnodes_pyramid[1], vnodes_pyramid[2], vnodes_pyramid[3], vnodes_pyramid[4]);
-                                loc_element_count++; nelem_pyramid++;
-                            }
-                            break;
-                    }
-                    ielem_div++;
-                    element_count++;
+                        }
+                        if (elem_reqd)
+                        {
+                            Global_to_local_elem[element_count] = loc_element_count;
+                            elem[loc_element_count] = new GRID::GRID_Pyramid(vnodes_pyramid[0], vnodes_pyramid[1], vnodes_pyramid[2], vnodes_pyramid[3], vnodes_pyramid[4]);
+                            loc_element_count++; nelem_pyramid++;
+                        }
+                        break;
                 }
             }
         }
@@ -555,6 +516,8 @@ namespace ARIES
 
         if (rank == TBOX::MASTER_NODE)
         {
+            /*--- Go straight to the markers, found by the scan of the index ---*/
+            mesh_file.seekg(mesh_map.GetMarkerOffset());
 
             while (getline(mesh_file, text_line))
             {
@@ -58,15 +58,13 @@ namespace ARIES
             unsigned short iMGfine, iMGlevel, nMGlevel = config->GetnMGLevels();
 
             /*--- Update the multigrid structure after moving the finest grid,
-            including computing the grid velocities on the coarser levels. ---*/
+            including computing the grid velocities on the coarser levels. The
+            agglomeration does not change, so volumes, coordinates, normals and
+            grid velocities are restricted through the transfer maps of every level. ---*/
 
             for (iMGlevel = 1; iMGlevel <= nMGlevel; iMGlevel++) {
                 iMGfine = iMGlevel - 1;
-                geometry[iMGlevel]->SetControlVolume(config, geometry[iMGfine], UPDATE);
-                geometry[iMGlevel]->SetBoundControlVolume(config, geometry[iMGfine], UPDATE);
-                geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
-                if (config->GetGrid_Movement())
-                    geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine], config);
+                geometry[iMGlevel]->SetRestricted_Geometry(config, geometry[iMGfine]);
             }
 
         }
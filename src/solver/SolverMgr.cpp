@@ -15,6 +15,7 @@
  */
 
 #inlucde "SolverMgr.hpp"
+#include "AriesMPI.hpp"
 
 namespace ARIES
 {
@@ -31,6 +32,7 @@ namespace ARIES
     {
 
         int rank = MASTER_NODE;
+        double StartTime, StopTime;
 
 #ifdef HAVE_MPI
         MPI_Comm_rank(MPI_COMM_WORLD, &rank);
@@ -54,6 +56,9 @@ namespace ARIES
             historyFile_FSI.close();
         }
 
+        /*--- Wall time, not the CPU time of the process summed over the threads ---*/
+        StartTime = AriesMPI::Wtime();
+
         while (ExtIter < config_container[ZONE_0]->GetnExtIter()) {
 
             /*--- Perform some external iteration preprocessing. ---*/
@@ -93,6 +98,13 @@ namespace ARIES
 
         }
 
+        StopTime = AriesMPI::Wtime();
+
+        /*--- Leave the wall time and the element mix of every rank behind, the next
+        partitioning refits the element costs to them ---*/
+
+        geometry_container[ZONE_0][MESH_0]->SetPartition_Timing(StopTime - StartTime);
+
 
     
     }